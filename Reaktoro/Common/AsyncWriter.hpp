@@ -0,0 +1,182 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
+namespace Reaktoro {
+
+/// A class that writes items on a background thread.
+/// The items pushed by a single producer thread are stored in a bounded ring buffer and
+/// consumed in order by a writer thread. The ring buffer is lock-free: the producer and the
+/// writer only lock a mutex to sleep when the buffer is full or empty, respectively. The
+/// producer blocks while the buffer is full, and destroying the writer, or calling @ref close,
+/// waits until all pushed items have been written.
+template<typename T>
+class AsyncWriter
+{
+public:
+    /// Construct an AsyncWriter instance.
+    /// @param capacity The maximum number of items waiting to be written
+    /// @param write The function that writes an item, called on the writer thread
+    AsyncWriter(Index capacity, std::function<void(T&)> write)
+    : slots(std::max<Index>(capacity, 1)), write(write), worker([this] { run(); })
+    {}
+
+    /// Destroy this AsyncWriter instance after writing all pushed items.
+    ~AsyncWriter()
+    {
+        try { close(); } catch(...) {}
+    }
+
+    /// Push an item to be written, waiting while the buffer is full.
+    auto push(T item) -> void
+    {
+        const Index itail = tail.load(std::memory_order_relaxed);
+
+        if(itail - head.load() == slots.size())
+            wait(producer_waiting, [&] { return itail - head.load() < slots.size(); });
+
+        slots[itail % slots.size()] = std::move(item);
+
+        tail.store(itail + 1);
+
+        wake(consumer_waiting);
+    }
+
+    /// Wait until all pushed items have been written.
+    auto flush() -> void
+    {
+        const Index itail = tail.load(std::memory_order_relaxed);
+        if(head.load() != itail)
+            wait(producer_waiting, [&] { return head.load() == itail; });
+        rethrow();
+    }
+
+    /// Write all pushed items and stop the writer thread.
+    auto close() -> void
+    {
+        if(worker.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done = true;
+            }
+            condition.notify_all();
+            worker.join();
+        }
+        rethrow();
+    }
+
+private:
+    /// The loop of the writer thread.
+    auto run() -> void
+    {
+        for(Index ihead = head.load(); ; ihead = head.load())
+        {
+            if(ihead == tail.load())
+            {
+                wait(consumer_waiting, [&] { return ihead != tail.load() || done; });
+                if(ihead == tail.load())
+                    return;
+            }
+
+            T& item = slots[ihead % slots.size()];
+
+            // Keep writing after an error so that the producer never waits forever
+            if(!error)
+                try { write(item); }
+                catch(...) { error = std::current_exception(); }
+
+            item = T();
+
+            head.store(ihead + 1);
+
+            wake(producer_waiting);
+        }
+    }
+
+    /// Sleep until the given condition is satisfied, announced by the given flag.
+    template<typename Predicate>
+    auto wait(std::atomic<bool>& waiting, Predicate ready) -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        waiting.store(true);
+        condition.wait(lock, ready);
+        waiting.store(false);
+    }
+
+    /// Wake the thread sleeping with the given flag, if any.
+    auto wake(std::atomic<bool>& waiting) -> void
+    {
+        if(waiting.load())
+        {
+            { std::lock_guard<std::mutex> lock(mutex); }
+            condition.notify_all();
+        }
+    }
+
+    /// Rethrow the first exception thrown by the writer thread.
+    auto rethrow() -> void
+    {
+        if(error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+
+    /// The ring buffer of items waiting to be written.
+    std::vector<T> slots;
+
+    /// The function that writes an item.
+    std::function<void(T&)> write;
+
+    /// The number of items written, advanced by the writer thread only.
+    std::atomic<Index> head = {0};
+
+    /// The number of items pushed, advanced by the producer thread only.
+    std::atomic<Index> tail = {0};
+
+    /// The flags that indicate if the producer or the writer thread is sleeping.
+    std::atomic<bool> producer_waiting = {false}, consumer_waiting = {false};
+
+    /// The flag that indicates if no more items will be pushed.
+    bool done = false;
+
+    /// The first exception thrown by the writer thread.
+    std::exception_ptr error;
+
+    /// The mutex and condition variable used only to sleep while the buffer is full or empty.
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    /// The writer thread, declared last so that it starts after all other members are initialized.
+    std::thread worker;
+};
+
+} // namespace Reaktoro
@@ -380,12 +380,17 @@ public:
 	using Base = ChemicalVectorBase<VectorConstRef, decltype(zeros(0)), decltype(zeros(0)), decltype(identity(0,0))>;
 
     /// Construct a Composition instance with given composition vector.
-    Composition(VectorConstRef n) : Base(n, zeros(n.rows()), zeros(n.rows()), identity(n.rows(), n.rows())) {}
+    Composition(VectorConstRef n) : Composition(n, n.rows()) {}
+
+    /// Construct a Composition instance with given composition vector and number of species.
+    /// @param n The composition vector
+    /// @param nspecies The number of species for the molar derivatives, which is zero if these are not needed
+    Composition(VectorConstRef n, Index nspecies) : Base(n, zeros(n.rows()), zeros(n.rows()), identity(n.rows(), nspecies)) {}
 
     /// Return a ChemicalScalarBase with const reference to the chemical scalar in a given row.
-    auto operator[](Index irow) const -> ChemicalScalarBase<double, decltype(unitrow(val.size(), irow))>
+    auto operator[](Index irow) const -> ChemicalScalarBase<double, decltype(ddn.row(irow))>
     {
-        return { val[irow], 0.0, 0.0, unitrow(val.size(), irow) };
+        return { val[irow], 0.0, 0.0, ddn.row(irow) };
     }
 };
 
@@ -665,6 +670,7 @@ auto row(const ChemicalVectorBase<V,T,P,N>& vec, Index irow) -> ChemicalScalarBa
 template<typename V, typename T, typename P, typename N>
 auto row(ChemicalVectorBase<V,T,P,N>& vec, Index irow, Index icol, Index ncols) -> ChemicalScalarBase<decltype(vec.val[irow]), decltype(vec.ddn.row(irow).segment(icol, ncols))>
 {
+    if(vec.ddn.cols() == 0) icol = ncols = 0; // no molar derivatives in the view either
 	return {vec.val[irow], vec.ddT[irow], vec.ddP[irow], vec.ddn.row(irow).segment(icol, ncols)};
 }
 
@@ -672,6 +678,7 @@ auto row(ChemicalVectorBase<V,T,P,N>& vec, Index irow, Index icol, Index ncols)
 template<typename V, typename T, typename P, typename N>
 auto row(const ChemicalVectorBase<V,T,P,N>& vec, Index irow, Index icol, Index ncols) -> ChemicalScalarBase<decltype(vec.val[irow]), decltype(vec.ddn.row(irow).segment(icol, ncols))>
 {
+    if(vec.ddn.cols() == 0) icol = ncols = 0; // no molar derivatives in the view either
 	return {vec.val[irow], vec.ddT[irow], vec.ddP[irow], vec.ddn.row(irow).segment(icol, ncols)};
 }
 
@@ -693,6 +700,7 @@ auto rows(const ChemicalVectorBase<V,T,P,N>& vec, Index irow, Index nrows) -> Ch
 template<typename V, typename T, typename P, typename N>
 auto rows(ChemicalVectorBase<V,T,P,N>& vec, Index irow, Index icol, Index nrows, Index ncols) -> ChemicalVectorBase<decltype(rows(vec.val, irow, nrows)), decltype(rows(vec.ddT, irow, nrows)), decltype(rows(vec.ddP, irow, nrows)), decltype(block(vec.ddn, irow, icol, nrows, ncols))>
 {
+    if(vec.ddn.cols() == 0) icol = ncols = 0; // no molar derivatives in the view either
 	return {rows(vec.val, irow, nrows), rows(vec.ddT, irow, nrows), rows(vec.ddP, irow, nrows), block(vec.ddn, irow, icol, nrows, ncols)};
 }
 
@@ -700,6 +708,7 @@ auto rows(ChemicalVectorBase<V,T,P,N>& vec, Index irow, Index icol, Index nrows,
 template<typename V, typename T, typename P, typename N>
 auto rows(const ChemicalVectorBase<V,T,P,N>& vec, Index irow, Index icol, Index nrows, Index ncols) -> ChemicalVectorBase<decltype(rows(vec.val, irow, nrows)), decltype(rows(vec.ddT, irow, nrows)), decltype(rows(vec.ddP, irow, nrows)), decltype(block(vec.ddn, irow, icol, nrows, ncols))>
 {
+    if(vec.ddn.cols() == 0) icol = ncols = 0; // no molar derivatives in the view either
 	return {rows(vec.val, irow, nrows), rows(vec.ddT, irow, nrows), rows(vec.ddP, irow, nrows), block(vec.ddn, irow, icol, nrows, ncols)};
 }
 
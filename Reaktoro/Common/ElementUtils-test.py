@@ -0,0 +1,75 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import pytest
+from reaktoro import (
+    atomicMass,
+    charge,
+    elements,
+    molarMass,
+)
+
+
+@pytest.mark.parametrize("formula, expected", [
+    ("H2O",                  {"H": 2, "O": 1}),
+    ("CaCO3",                {"C": 1, "Ca": 1, "O": 3}),
+    ("Ca(HCO3)2",            {"C": 2, "Ca": 1, "H": 2, "O": 6}),
+    ("Ca(Al(OH)4)2",         {"Al": 2, "Ca": 1, "H": 8, "O": 8}),
+    ("K(Mg3)(AlSi3O10)(OH)2", {"Al": 1, "H": 2, "K": 1, "Mg": 3, "O": 12, "Si": 3}),
+    ("((CH3)3C)2O",          {"C": 8, "H": 18, "O": 1}),
+    ("CaSO4.2H2O",           {"Ca": 1, "H": 4, "O": 6, "S": 1}),
+    ("Fe+++",                {"Fe": 1}),
+    ("Fe[3+]",               {"Fe": 1}),
+    ("Fe(OH)2+",             {"Fe": 1, "H": 2, "O": 2}),
+    ("CO3--",                {"C": 1, "O": 3}),
+    ("CO2(aq)",              {"C": 1, "O": 2}),
+])
+def test_elements_of_formulas(formula, expected):
+    assert elements(formula) == expected
+    # The parsed compositions are memoized, so check the second call too
+    assert elements(formula) == expected
+    assert molarMass(formula) == pytest.approx(sum(n * atomicMass(e) for e, n in expected.items()), rel=1e-15)
+
+
+def test_molar_mass_of_charged_formulas():
+    assert molarMass("Fe+++") == atomicMass("Fe")
+    assert molarMass("Fe[3+]") == atomicMass("Fe")
+    assert molarMass("Fe(OH)2+") == molarMass("Fe(OH)2")
+
+
+@pytest.mark.parametrize("formula, expected", [
+    ("H2O",      0),
+    ("Na+",     +1),
+    ("Ca++",    +2),
+    ("Fe+++",   +3),
+    ("Fe+3",    +3),
+    ("Fe[3+]",  +3),
+    ("H[+]",    +1),
+    ("OH-",     -1),
+    ("CO3--",   -2),
+    ("CO3-2",   -2),
+    ("Cl[-]",   -1),
+    ("SO4[2-]", -2),
+])
+def test_charge_of_formulas(formula, expected):
+    assert charge(formula) == expected
+
+
+def test_unknown_element_symbols():
+    assert elements("XyZ2") == {"Xy": 1, "Z": 2}
+    with pytest.raises(RuntimeError):
+        molarMass("XyZ2")
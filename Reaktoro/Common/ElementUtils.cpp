@@ -19,16 +19,20 @@
 
 // C++ includes
 #include <algorithm>
-#include <cassert>
+#include <deque>
 #include <map>
-#include <stdexcept>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 using std::string;
 using std::map;
 using std::pair;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Common/OptimizationUtils.hpp>
 
 namespace Reaktoro {
 namespace internal {
@@ -66,25 +70,68 @@ const std::map<std::string, double> atomicWeights =
       {"Uut", 284.0},      {"Uuq", 289.0},    {"Uup", 288.0},     {"Uuh", 292.0}
 };
 
-auto parseElementAtom(string::iterator begin, string::iterator end) -> pair<string, string::iterator>
+/// The atomic weights of the known chemical elements in the order of @ref elements (in units of g/mol)
+const std::vector<double> atomic_weights = []
 {
-    assert(isupper(*begin) && "***Error*** `parseElementAtom` requires the first character to be uppercase.");
-    if(begin == end) return {"", begin};
-    auto endelement = std::find_if(begin + 1, end, [](char c){return isupper(c) || !isalpha(c);});
-    string element = string(begin, endelement);
-    return {element, endelement};
+    std::vector<double> weights;
+    for(const std::string& element : elements)
+        weights.push_back(atomicWeights.at(element));
+    return weights;
+}();
+
+/// The element symbols found in chemical formulas, with the known chemical elements first.
+/// A deque is used so that the interned symbols are not moved when new ones are added.
+std::deque<std::string> symbols(elements.begin(), elements.end());
+
+/// The indices of the interned element symbols
+std::unordered_map<std::string_view, Index> symbol_indices = []
+{
+    std::unordered_map<std::string_view, Index> indices;
+    for(Index i = 0; i < symbols.size(); ++i)
+        indices.emplace(symbols[i], i);
+    return indices;
+}();
+
+/// The mutex that protects the interned element symbols, which are shared among threads
+std::shared_mutex symbols_mutex;
+
+/// Return the index of an element symbol, interning the symbol if it has not been found before
+auto internSymbol(std::string_view symbol) -> Index
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(symbols_mutex);
+        auto iter = symbol_indices.find(symbol);
+        if(iter != symbol_indices.end())
+            return iter->second;
+    }
+    std::unique_lock<std::shared_mutex> lock(symbols_mutex);
+    auto iter = symbol_indices.find(symbol);
+    if(iter != symbol_indices.end())
+        return iter->second;
+    symbols.emplace_back(symbol);
+    return symbol_indices.emplace(symbols.back(), symbols.size() - 1).first->second;
 }
 
-auto parseNumAtoms(string::iterator begin, string::iterator end) -> pair<double, string::iterator>
+/// Return an interned element symbol
+auto symbol(Index index) -> const std::string&
 {
-    if(begin == end) return {1.0, begin};
-    if(!isdigit(*begin)) return {1.0, begin};
-    auto endnumber = std::find_if(begin, end, [](char c){return !isdigit(c);});
-    double number = atof(string(begin, endnumber).c_str());
-    return {number, endnumber};
+    std::shared_lock<std::shared_mutex> lock(symbols_mutex);
+    return symbols[index];
 }
 
-auto findMatchedParenthesis(string::iterator begin, string::iterator end) -> string::iterator
+/// The elemental composition of a chemical formula as pairs of interned element symbol and number of atoms
+using FormulaTerms = std::vector<std::pair<Index, double>>;
+
+auto parseNumAtoms(const char*& iter, const char* end) -> double
+{
+    if(iter == end || !isdigit(*iter)) return 1.0;
+    double number = 0.0;
+    for(; iter != end && isdigit(*iter); ++iter)
+        number = 10.0 * number + (*iter - '0');
+    return number;
+}
+
+auto findMatchedParenthesis(const char* begin, const char* end) -> const char*
 {
     if(begin == end) return end;
     int level = 0;
@@ -98,58 +145,57 @@ auto findMatchedParenthesis(string::iterator begin, string::iterator end) -> str
     return end;
 }
 
-auto parseFormula(string::iterator begin, string::iterator end, map<string, double>& result, double scalar) -> void
+auto addAtoms(FormulaTerms& terms, Index ielement, double natoms) -> void
 {
-    if(begin == end) return;
+    for(auto& term : terms)
+        if(term.first == ielement) { term.second += natoms; return; }
+    terms.emplace_back(ielement, natoms);
+}
 
-    if(*begin != '(' && *begin != '.' && !isupper(*begin))
-    {
-        parseFormula(begin + 1, end, result, scalar);
-    }
-    else if(*begin == '(')
+auto parseFormula(const char* begin, const char* end, FormulaTerms& terms, double scalar) -> void
+{
+    while(begin != end)
     {
-        string::iterator begin1 = begin + 1;
-        string::iterator end1   = findMatchedParenthesis(begin, end);
-
-        auto res = parseNumAtoms(end1 + 1, end);
-
-        const double number = res.first;
-
-        string::iterator begin2 = res.second;
-        string::iterator end2   = end;
-
-        parseFormula(begin1, end1, result, scalar * number);
-        parseFormula(begin2, end2, result, scalar);
+        if(*begin == '(')
+        {
+            const char* end1 = findMatchedParenthesis(begin, end);
+            const char* iter = (end1 == end) ? end : end1 + 1;
+            const double number = parseNumAtoms(iter, end);
+            parseFormula(begin + 1, end1, terms, scalar * number);
+            begin = iter;
+        }
+        else if(*begin == '.')
+        {
+            const char* iter = begin + 1;
+            scalar *= parseNumAtoms(iter, end);
+            begin = iter;
+        }
+        else if(isupper(*begin))
+        {
+            const char* iter = std::find_if(begin + 1, end, [](char c){return isupper(c) || !isalpha(c);});
+            const Index ielement = internSymbol(std::string_view(begin, iter - begin));
+            const double natoms = parseNumAtoms(iter, end);
+            addAtoms(terms, ielement, scalar * natoms);
+            begin = iter;
+        }
+        else ++begin;
     }
-    else if(*begin == '.')
-    {
-        auto res = parseNumAtoms(begin + 1, end);
-
-        const double number = res.first;
-
-        string::iterator begin1 = res.second;
-        string::iterator end1   = end;
-
-        parseFormula(begin1, end1, result, scalar * number);
-    }
-    else
-    {
-        auto res1 = parseElementAtom(begin, end);
-        auto res2 = parseNumAtoms(res1.second, end);
-
-        string element = res1.first;
-        double natoms  = res2.first;
-
-        if(result.count(element)) result[element] += scalar * natoms;
-        else result[element] = scalar * natoms;
-
-        string::iterator begin1 = res2.second;
-        string::iterator end1   = end;
+}
 
-        parseFormula(begin1, end1, result, scalar);
-    }
+/// Return the elemental composition of a chemical formula sorted by element symbol
+auto parseFormula(std::string formula) -> FormulaTerms
+{
+    FormulaTerms terms;
+    parseFormula(formula.data(), formula.data() + formula.size(), terms, 1.0);
+    std::sort(terms.begin(), terms.end(),
+        [](const auto& l, const auto& r) { return symbol(l.first) < symbol(r.first); });
+    return terms;
 }
 
+/// The elemental compositions of the chemical formulas parsed so far, since the same formulas are parsed many times
+const auto formulaTerms = memoize(std::function<FormulaTerms(std::string)>(
+    static_cast<FormulaTerms(*)(std::string)>(parseFormula)));
+
 } // namespace internal
 
 auto elements() -> std::vector<std::string>
@@ -160,9 +206,8 @@ auto elements() -> std::vector<std::string>
 auto elements(std::string formula) -> std::map<std::string, double>
 {
     std::map<std::string, double> result;
-
-    internal::parseFormula(formula.begin(), formula.end(), result, 1.0);
-
+    for(const auto& term : internal::formulaTerms(formula))
+        result.emplace_hint(result.end(), internal::symbol(term.first), term.second);
     return result;
 }
 
@@ -191,11 +236,29 @@ auto molarMass(const std::map<std::string, double>& elements) -> double
 
 auto molarMass(std::string formula) -> double
 {
-    return molarMass(elements(formula));
+    const auto gram_to_kilogram = 0.001;
+    double molar_mass = 0.0;
+    for(const auto& term : internal::formulaTerms(formula))
+        molar_mass += term.second * (term.first < internal::atomic_weights.size() ?
+            internal::atomic_weights[term.first] * gram_to_kilogram : atomicMass(internal::symbol(term.first)));
+    return molar_mass;
 }
 
 auto charge(const std::string& formula) -> double
 {
+    // Check if the charge is given in brackets, as in Fe[3+], H[+] and Cl[-]
+    if(!formula.empty() && formula.back() == ']')
+    {
+        const std::size_t ibracket = formula.find_last_of('[');
+        Assert(ibracket != std::string::npos && formula.size() - ibracket > 2,
+            "Cannot extract the electrical charge of the formula `" + formula + "`.",
+            "The formula has no charge such as [3+] or [-] inside the brackets.");
+        const char sign = formula[formula.size() - 2];
+        const std::string digits = formula.substr(ibracket + 1, formula.size() - ibracket - 3);
+        const double number = digits.empty() ? 1.0 : std::stod(digits);
+        return (sign == '-') ? -number : number;
+    }
+
     std::size_t ipos = formula.find_last_of('+');
     std::size_t ineg = formula.find_last_of('-');
     std::size_t imin = std::min(ipos, ineg);
@@ -205,8 +268,12 @@ auto charge(const std::string& formula) -> double
 
     int sign = (imin == ipos) ? +1 : -1;
 
+    // Count the repeated signs at the end of the formula, as in Fe+++ and CO3--
     if(imin + 1 == formula.size())
-        return sign;
+    {
+        const std::size_t ifirst = formula.find_last_not_of(formula[imin]);
+        return sign * double(imin - (ifirst == std::string::npos ? 0 : ifirst + 1) + 1);
+    }
 
     std::string digits = formula.substr(imin + 1);
 
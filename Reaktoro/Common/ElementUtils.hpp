@@ -56,6 +56,8 @@ auto molarMass(std::string formula) -> double;
 /// std::string formula3 = "OH-";   // species: OH-
 /// std::string formula4 = "CO3--"; // species: CO3--
 /// std::string formula5 = "H+";    // species: H+
+/// std::string formula6 = "Fe+3";  // species: Fe+++
+/// std::string formula7 = "Fe[3+]"; // species: Fe+++
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 /// The number 1 is optional when the species has one
 /// negative or positive electrical charge.
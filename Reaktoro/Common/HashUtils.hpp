@@ -0,0 +1,62 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Reaktoro {
+
+/// The initial value of a hash computed with @ref hashBytes.
+const std::uint64_t hash_seed = 0xcbf29ce484222325;
+
+/// Return the 64-bit FNV-1a hash of a block of bytes.
+/// Unlike std::hash, the result does not depend on the platform or the compiler,
+/// and it can be used to name files that are shared among different programs.
+/// @param data The pointer to the bytes
+/// @param size The number of bytes
+/// @param hash The hash of the bytes preceding this block, to hash many blocks in sequence
+inline auto hashBytes(const void* data, std::size_t size, std::uint64_t hash = hash_seed) -> std::uint64_t
+{
+    const auto bytes = static_cast<const unsigned char*>(data);
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+/// Return the 64-bit FNV-1a hash of a string, including its terminating null character.
+inline auto hashBytes(const std::string& str, std::uint64_t hash = hash_seed) -> std::uint64_t
+{
+    return hashBytes(str.c_str(), str.size() + 1, hash);
+}
+
+/// Return the 64-bit FNV-1a hash of a vector of numbers, including its size.
+inline auto hashBytes(const std::vector<double>& vec, std::uint64_t hash = hash_seed) -> std::uint64_t
+{
+    const std::uint64_t size = vec.size();
+    hash = hashBytes(&size, sizeof(size), hash);
+    return hashBytes(vec.data(), vec.size() * sizeof(double), hash);
+}
+
+} // namespace Reaktoro
@@ -92,10 +92,51 @@ auto interpolate(
         ddP[i] = BilinearInterpolator(temperatures, pressures, ddP_func);
     }
 
-    ThermoVector res(size);
+    auto func = [=](double T, double P)
+    {
+        ThermoVector res(size);
+        for(unsigned i = 0; i < size; ++i)
+        {
+            res.val[i] = val[i](T, P);
+            res.ddT[i] = ddT[i](T, P);
+            res.ddP[i] = ddP[i](T, P);
+        }
+        return res;
+    };
+
+    return func;
+}
+
+auto interpolate(
+    const std::vector<double>& temperatures,
+    const std::vector<double>& pressures,
+    const std::vector<std::vector<ThermoScalar>>& scalars) -> ThermoVectorFunction
+{
+    const unsigned size = scalars.size();
+
+    std::vector<BilinearInterpolator> val(size), ddT(size), ddP(size);
+
+    std::vector<double> vals, ddTs, ddPs;
+
+    for(unsigned i = 0; i < size; ++i)
+    {
+        vals.clear();
+        ddTs.clear();
+        ddPs.clear();
+        for(const ThermoScalar& scalar : scalars[i])
+        {
+            vals.push_back(scalar.val);
+            ddTs.push_back(scalar.ddT);
+            ddPs.push_back(scalar.ddP);
+        }
+        val[i] = BilinearInterpolator(temperatures, pressures, vals);
+        ddT[i] = BilinearInterpolator(temperatures, pressures, ddTs);
+        ddP[i] = BilinearInterpolator(temperatures, pressures, ddPs);
+    }
 
-    auto func = [=](double T, double P) mutable
+    auto func = [=](double T, double P)
     {
+        ThermoVector res(size);
         for(unsigned i = 0; i < size; ++i)
         {
             res.val[i] = val[i](T, P);
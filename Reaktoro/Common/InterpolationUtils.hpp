@@ -40,4 +40,9 @@ auto interpolate(
     const std::vector<double>& pressures,
     const std::vector<ThermoScalarFunction>& fs) -> ThermoVectorFunction;
 
+auto interpolate(
+    const std::vector<double>& temperatures,
+    const std::vector<double>& pressures,
+    const std::vector<std::vector<ThermoScalar>>& scalars) -> ThermoVectorFunction;
+
 } // namespace Reaktoro
@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <map>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
@@ -38,6 +39,9 @@ std::map<std::pair<std::string, double>, std::vector<std::string>> alternative_c
 /// The map with alternative names for neutral species
 std::map<std::string, std::vector<std::string>> alternative_neutral_names;
 
+/// The mutex that protects the maps of alternative names, which are shared among threads
+std::mutex alternative_names_mutex;
+
 } // namespace
 
 auto alternativeWaterNames() -> std::vector<std::string>&
@@ -67,6 +71,7 @@ auto alternativeChargedSpeciesNames(std::string name) -> std::vector<std::string
     alternatives.push_back(base + sign_charge);                   // e.g.: Ca+2
     alternatives.push_back(base + "[" + charge_sign + "]");       // e.g.: Ca[2+]
 
+    std::lock_guard<std::mutex> lock(alternative_names_mutex);
     auto res = alternative_charged_names.insert({{base, charge}, unique(alternatives)});
 
     return res.first->second; // return the iterator to the existing or just added alternative names
@@ -83,6 +88,7 @@ auto alternativeNeutralSpeciesNames(std::string name) -> std::vector<std::string
     alternatives.push_back(base + "@");    // e.g.: CO2@
     alternatives.push_back(base + ",aq");  // e.g.: CO2,aq
 
+    std::lock_guard<std::mutex> lock(alternative_names_mutex);
     auto res = alternative_neutral_names.insert({base, unique(alternatives)});
 
     return res.first->second; // return the iterator to the existing or just added alternative names
@@ -29,15 +29,13 @@ auto parseReaction(std::string reaction) -> std::map<std::string, double>
 {
     std::map<std::string, double> equation;
 
-    // Split the participating species in the reaction in words delimited by space
-    std::vector<std::string> words = split(reaction, " ");
-
-    // Create the pair entries
-    for(const std::string& word : words)
+    // Split the participating species in the reaction in words delimited by space, and
+    // each word such as `2:H2O` in its stoichiometric coefficient and species name
+    splitEach(reaction, " ", [&](std::string_view word)
     {
-        std::vector<std::string> pair = split(word, ":");
-        equation.emplace(pair[1], tofloat(pair[0]));
-    }
+        const auto pos = word.find(':');
+        equation.emplace(word.substr(pos + 1), tofloat(word.substr(0, pos)));
+    });
 
     return equation;
 }
@@ -0,0 +1,198 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Reaktoro {
+
+/// A class that keeps a separate copy of a value for each thread that uses it.
+/// This is used to share objects whose evaluation modifies internal scratch data,
+/// such as the closures of the chemical models of the phases, among many threads.
+/// The copies are kept in a pool. A thread takes a copy from the pool on its first
+/// use and returns it when the thread exits, so that the copy can be reused by the
+/// threads started later. The number of copies is thus bounded by the largest number
+/// of threads that used this instance at the same time. A custom copy function can be
+/// given for values that are not copied by their copy constructor, such as pointers.
+template<typename T>
+class PerThread
+{
+public:
+    /// Construct a PerThread instance with a default prototype value.
+    PerThread()
+    : PerThread(T())
+    {}
+
+    /// Construct a PerThread instance with given prototype value.
+    explicit PerThread(const T& prototype)
+    : pool(std::make_shared<Pool>(prototype, nullptr, false))
+    {}
+
+    /// Construct a PerThread instance with given prototype value and copy function.
+    /// @param prototype The value copied for each thread
+    /// @param copy The function that copies the prototype value
+    /// @param shared The flag that indicates if the prototype value is used by the first thread instead of a copy.
+    /// This requires the copy function to be safe to call while another thread uses the prototype value.
+    PerThread(const T& prototype, const std::function<T(const T&)>& copy, bool shared = false)
+    : pool(std::make_shared<Pool>(prototype, copy, shared))
+    {}
+
+    /// Construct a copy of a PerThread instance, without the copies owned by its threads.
+    PerThread(const PerThread& other)
+    : pool(other.pool->clone())
+    {}
+
+    /// Assign a PerThread instance to this, discarding the copies owned by the threads.
+    auto operator=(const PerThread& other) -> PerThread&
+    {
+        pool = other.pool->clone();
+        return *this;
+    }
+
+    /// Return the prototype value, which is copied for each thread.
+    auto prototype() const -> const T&
+    {
+        return pool->prototype;
+    }
+
+    /// Return the copy of the prototype value owned by the calling thread.
+    auto local() const -> T&
+    {
+        auto& leases = threadLeases();
+        auto iter = leases.find(pool.get());
+        if(iter != leases.end() && !iter->second.pool.expired())
+            return *iter->second.value;
+        leases.sweep();
+        return *leases.emplace(pool.get(), Lease{pool, pool->acquire()}).first->second.value;
+    }
+
+    /// Return the number of copies of the prototype value created for the threads.
+    auto size() const -> std::size_t
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        return pool->copies.size();
+    }
+
+private:
+    /// The pool of copies of the prototype value shared with the threads that use them.
+    struct Pool
+    {
+        Pool(const T& prototype, const std::function<T(const T&)>& copy, bool shared)
+        : prototype(prototype), copy(copy), shared(shared)
+        {
+            if(shared)
+                idle.push_back(&this->prototype);
+        }
+
+        /// Return a new pool with the same prototype value, which is copied if it is used by a thread.
+        auto clone() const -> std::shared_ptr<Pool>
+        {
+            return std::make_shared<Pool>(shared ? copy(prototype) : prototype, copy, shared);
+        }
+
+        /// Return a copy that is not used by any thread, creating one if needed.
+        auto acquire() -> T*
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(idle.size())
+                {
+                    T* value = idle.back();
+                    idle.pop_back();
+                    return value;
+                }
+            }
+            // Copy the prototype value without holding the lock, since the copy may be expensive
+            std::unique_ptr<T> value(new T(copy ? copy(prototype) : prototype));
+            std::lock_guard<std::mutex> lock(mutex);
+            copies.push_back(std::move(value));
+            return copies.back().get();
+        }
+
+        /// Return a copy to the pool, so that it can be used by another thread.
+        auto release(T* value) -> void
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            idle.push_back(value);
+        }
+
+        /// The prototype value copied for each thread.
+        T prototype;
+
+        /// The function that copies the prototype value, if its copy constructor is not used.
+        std::function<T(const T&)> copy;
+
+        /// The flag that indicates if the prototype value is used by a thread instead of a copy.
+        bool shared;
+
+        /// The copies of the prototype value.
+        std::vector<std::unique_ptr<T>> copies;
+
+        /// The values not used by any thread.
+        std::vector<T*> idle;
+
+        /// The mutex that protects the copies and the idle values.
+        std::mutex mutex;
+    };
+
+    /// The value of a pool used by a thread.
+    struct Lease
+    {
+        /// The pool that owns the value.
+        std::weak_ptr<Pool> pool;
+
+        /// The value used by the thread.
+        T* value;
+    };
+
+    /// The values used by a thread, which are returned to their pools when the thread exits.
+    struct Leases : std::unordered_map<const Pool*, Lease>
+    {
+        ~Leases()
+        {
+            for(auto& entry : *this)
+                if(auto pool = entry.second.pool.lock())
+                    pool->release(entry.second.value);
+        }
+
+        /// Remove the leases of the pools that were destroyed.
+        auto sweep() -> void
+        {
+            for(auto iter = this->begin(); iter != this->end();)
+                iter = iter->second.pool.expired() ? this->erase(iter) : std::next(iter);
+        }
+    };
+
+    /// Return the values used by the calling thread.
+    static auto threadLeases() -> Leases&
+    {
+        thread_local Leases leases;
+        return leases;
+    }
+
+    /// The pool of copies of the prototype value.
+    std::shared_ptr<Pool> pool;
+};
+
+} // namespace Reaktoro
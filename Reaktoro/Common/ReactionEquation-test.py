@@ -0,0 +1,53 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import pytest
+from reaktoro import ReactionEquation
+
+
+def test_reaction_equation_coefficients():
+    equation = ReactionEquation("Calcite + H+ = Ca++ + HCO3-")
+    assert equation.numSpecies() == 4
+    assert equation.stoichiometry("Calcite") == -1
+    assert equation.stoichiometry("H+") == -1
+    assert equation.stoichiometry("Ca++") == 1
+    assert equation.stoichiometry("HCO3-") == 1
+    assert equation.stoichiometry("CO2(aq)") == 0
+
+
+def test_reaction_equation_fractional_and_scientific_coefficients():
+    equation = ReactionEquation("0.5*O2(g) + 2*H+ + 2*e- = 1.0*H2O(l)")
+    assert equation.stoichiometry("O2(g)") == -0.5
+    assert equation.stoichiometry("H+") == -2
+    assert equation.stoichiometry("e-") == -2
+    assert equation.stoichiometry("H2O(l)") == 1
+
+    equation = ReactionEquation("2.5e-1*CO2(g) + 1.5E+1*H2O(l) = .25*CO2(aq) + 1e1*H2O(g)")
+    assert equation.stoichiometry("CO2(g)") == -0.25
+    assert equation.stoichiometry("CO2(aq)") == 0.25
+    assert equation.stoichiometry("H2O(l)") == -15
+    assert equation.stoichiometry("H2O(g)") == 10
+
+
+def test_reaction_equation_errors():
+    with pytest.raises(RuntimeError):
+        ReactionEquation("H2O(l) = H+ = OH-")
+
+    # A number that does not fit the parsing buffer is rejected instead of truncated
+    long_number = "0." + "0" * 70 + "1"
+    with pytest.raises(RuntimeError):
+        ReactionEquation(long_number + "*H2O(l) = H2O(g)")
@@ -19,6 +19,8 @@
 
 // C++ includes
 #include <sstream>
+#include <string_view>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
@@ -33,7 +35,8 @@ ReactionEquation::ReactionEquation(std::string equation)
 : equation_str(equation)
 {
     // Split the reaction equation into two words: reactants and products
-    auto two_words = split(equation_str, "=");
+    std::vector<std::string_view> two_words;
+    splitEach(equation_str, "=", [&](std::string_view word) { two_words.push_back(word); });
 
     // Assert the equation has a single equal sign `=`
     Assert(two_words.size() == 2,
@@ -41,33 +44,21 @@ ReactionEquation::ReactionEquation(std::string equation)
         "Expecting an equation with a single equal sign `=` separating "
         "reactants from products");
 
-    // The reactants and products as string
-    const auto& reactants_str = two_words[0];
-    const auto& products_str = two_words[1];
-
-    // Split the string representing the reactants and products at each `+` sign
-    auto reactants = split(reactants_str, " ");
-    auto products = split(products_str, " ");
-
-    // Iterave over all strings representing pair number and species name in the reactants
-    for(auto word : reactants)
-    {
-        if(word == "+") continue;
-        auto pair = split(word, "*");
-        auto number = pair.size() == 2 ? tofloat(pair[0]) : 1.0;
-        auto species = pair.size() == 2 ? pair[1] : pair[0];
-        equation_map.emplace(species, -number); // negative sign for reactants
-    }
-
-    // Iterave over all strings representing pair number and species name in the products
-    for(auto word : products)
+    // Add a pair number and species name such as `2*H2O` with the given sign, -1 for reactants and +1 for products
+    auto add = [&](std::string_view word, double sign)
     {
-        if(word == "+") continue;
-        auto pair = split(word, "*");
-        auto number = pair.size() == 2 ? tofloat(pair[0]) : 1.0;
-        auto species = pair.size() == 2 ? pair[1] : pair[0];
-        equation_map.emplace(species, number); // positive sign for products
-    }
+        if(word == "+") return;
+        std::string_view pair[2];
+        unsigned size = 0;
+        splitEach(word, "*", [&](std::string_view part) { if(size < 2) pair[size] = part; ++size; });
+        const double number = size == 2 ? tofloat(pair[0]) : 1.0;
+        const std::string_view species = size == 2 ? pair[1] : pair[0];
+        equation_map.emplace(species, sign * number);
+    };
+
+    // Split the string representing the reactants and products at each space and add the pairs number and species name
+    splitEach(two_words[0], " ", [&](std::string_view word) { add(word, -1.0); });
+    splitEach(two_words[1], " ", [&](std::string_view word) { add(word, +1.0); });
 }
 
 ReactionEquation::ReactionEquation(const std::map<std::string, double>& equation)
@@ -24,8 +24,12 @@
 #include <functional>
 #include <locale>
 #include <string>
+#include <string_view>
 #include <vector>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
 namespace Reaktoro {
 
 /// Return a string with lower case characters.
@@ -86,6 +90,21 @@ inline auto split(const std::string& str, const std::string& delims = " ") -> st
     return split(str, delims, {});
 }
 
+/// Call a function for every word of a string delimited by the specified delimiters.
+/// Unlike @ref split, the words are given as views of the string, so no new string is allocated.
+template<typename Function>
+auto splitEach(std::string_view str, std::string_view delims, Function&& f) -> void
+{
+    std::size_t start = 0, end = 0;
+    while(end != std::string_view::npos)
+    {
+        end = str.find_first_of(delims, start);
+        const std::string_view word = str.substr(start, end - start);
+        if(!word.empty()) f(word);
+        start = end + 1;
+    }
+}
+
 /// Split the string on every occurrence of the specified delimiters and trim each word
 inline auto splitrim(const std::string& str, const std::string& delims = " ") -> std::vector<std::string>
 {
@@ -102,9 +121,15 @@ inline auto join(const std::vector<std::string>& strs, std::string delim = " ")
 }
 
 /// Convert the string into a floating point number
-inline auto tofloat(const std::string& str) -> double
+inline auto tofloat(std::string_view str) -> double
 {
-    return atof(str.c_str());
+    // Copy the number to a null-terminated buffer on the stack, since the view may not end at a null character
+    char buffer[64];
+    Assert(str.size() < sizeof(buffer), "Could not convert `" << str << "` into a floating point number.",
+        "The number has more than " << sizeof(buffer) - 1 << " characters.");
+    std::copy_n(str.data(), str.size(), buffer);
+    buffer[str.size()] = '\0';
+    return atof(buffer);
 }
 
 /// Convert the string into a list of floating point numbers
@@ -0,0 +1,203 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+#include "ThreadPool.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Reaktoro {
+
+struct ThreadPool::Impl
+{
+    /// The tasks of a call to `run`.
+    struct Batch
+    {
+        /// The function that executes each task.
+        const std::function<void(unsigned)>& task;
+
+        /// The exceptions eventually thrown by each task.
+        std::vector<std::exception_ptr> errors;
+
+        /// The number of tasks not yet finished, protected by the mutex of the pool.
+        unsigned remaining;
+    };
+
+    /// A task waiting to be executed.
+    struct Job
+    {
+        /// The tasks to which this one belongs.
+        Batch* batch;
+
+        /// The index of the task.
+        unsigned itask;
+    };
+
+    /// The worker threads.
+    std::vector<std::thread> workers;
+
+    /// The tasks waiting to be executed.
+    std::deque<Job> jobs;
+
+    /// The flag that indicates if the workers should exit once there are no more tasks.
+    bool stopping = false;
+
+    /// The mutex that protects the tasks waiting to be executed and the number of unfinished tasks of each call.
+    std::mutex mutex;
+
+    /// The condition variable notified when tasks are added or the workers should exit.
+    std::condition_variable added;
+
+    /// The condition variable notified when all tasks of a call finish.
+    std::condition_variable finished;
+
+    Impl(unsigned num_workers)
+    {
+        workers.reserve(num_workers);
+        for(unsigned i = 0; i < num_workers; ++i)
+            workers.emplace_back([this]() { work(); });
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        added.notify_all();
+        for(auto& worker : workers)
+            worker.join();
+    }
+
+    /// Execute a task and notify the end of its call if it was the last one.
+    auto execute(const Job& job) -> void
+    {
+        try { job.batch->task(job.itask); }
+        catch(...) { job.batch->errors[job.itask] = std::current_exception(); }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(--job.batch->remaining == 0)
+            finished.notify_all();
+    }
+
+    /// Execute the tasks added to the pool until the workers should exit.
+    auto work() -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            added.wait(lock, [&]() { return stopping || !jobs.empty(); });
+            if(jobs.empty())
+                return;
+            const Job job = jobs.front();
+            jobs.pop_front();
+            lock.unlock();
+            execute(job);
+            lock.lock();
+        }
+    }
+
+    auto run(unsigned num_tasks, const std::function<void(unsigned)>& task) -> void
+    {
+        if(num_tasks == 0)
+            return;
+
+        if(num_tasks == 1)
+        {
+            task(0);
+            return;
+        }
+
+        Batch batch{task, std::vector<std::exception_ptr>(num_tasks), num_tasks};
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(unsigned itask = 1; itask < num_tasks; ++itask)
+                jobs.push_back({&batch, itask});
+        }
+        added.notify_all();
+
+        // Execute the first task in the calling thread
+        execute({&batch, 0});
+
+        // Execute the waiting tasks, of this or other calls, until the tasks of this call finish
+        std::unique_lock<std::mutex> lock(mutex);
+        while(batch.remaining)
+        {
+            if(jobs.empty())
+            {
+                finished.wait(lock);
+                continue;
+            }
+            const Job job = jobs.front();
+            jobs.pop_front();
+            lock.unlock();
+            execute(job);
+            lock.lock();
+        }
+        lock.unlock();
+
+        for(const auto& error : batch.errors)
+            if(error) std::rethrow_exception(error);
+    }
+};
+
+ThreadPool::ThreadPool(unsigned num_workers)
+: pimpl(new Impl(num_workers))
+{}
+
+ThreadPool::~ThreadPool()
+{}
+
+auto ThreadPool::shared() -> ThreadPool&
+{
+    // The pool is never destroyed, since joining its workers during the destruction
+    // of static objects can deadlock, e.g., when a shared library is unloaded
+    static ThreadPool* pool = new ThreadPool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+    return *pool;
+}
+
+auto ThreadPool::numWorkers() const -> unsigned
+{
+    return pimpl->workers.size();
+}
+
+auto ThreadPool::run(unsigned num_tasks, const std::function<void(unsigned)>& task) -> void
+{
+    pimpl->run(num_tasks, task);
+}
+
+auto numParallelTasks(unsigned requested, Index num_items) -> unsigned
+{
+    const Index num_tasks = requested ? requested : std::thread::hardware_concurrency();
+    return std::max<Index>(1, std::min(num_tasks, num_items));
+}
+
+auto parallelTaskRange(Index num_items, unsigned num_tasks, unsigned itask) -> std::pair<Index, Index>
+{
+    const Index length = (num_items + num_tasks - 1)/num_tasks;
+    const Index begin = std::min<Index>(itask * length, num_items);
+    const Index end = std::min<Index>(begin + length, num_items);
+    return {begin, end};
+}
+
+} // namespace Reaktoro
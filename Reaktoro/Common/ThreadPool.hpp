@@ -0,0 +1,79 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <memory>
+#include <utility>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
+namespace Reaktoro {
+
+/// A class that runs tasks in parallel on a pool of persistent worker threads.
+/// The tasks of a call to @ref run are executed by the workers and by the calling
+/// thread, which also executes pending tasks while it waits for the others. This
+/// allows nested calls to @ref run from within the tasks without deadlocks. The
+/// parallel calculations in Reaktoro use the pool returned by @ref shared, so that
+/// their threads, and the per-thread data kept by them, are reused across calls.
+class ThreadPool
+{
+public:
+    /// Construct a ThreadPool instance with given number of worker threads.
+    explicit ThreadPool(unsigned num_workers);
+
+    /// Disable the copy of ThreadPool instances.
+    ThreadPool(const ThreadPool&) = delete;
+
+    /// Destroy this ThreadPool instance after its workers finish their pending tasks.
+    virtual ~ThreadPool();
+
+    /// Disable the assignment of ThreadPool instances.
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+    /// Return the pool shared by the parallel calculations, with a worker for each hardware thread but one.
+    static auto shared() -> ThreadPool&;
+
+    /// Return the number of worker threads of the pool.
+    auto numWorkers() const -> unsigned;
+
+    /// Run a number of tasks in parallel and wait for them to finish.
+    /// The exception thrown by the first task that failed, if any, is rethrown after all tasks finish.
+    /// @param num_tasks The number of tasks
+    /// @param task The function that executes the task with given index
+    auto run(unsigned num_tasks, const std::function<void(unsigned)>& task) -> void;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+/// Return the number of parallel tasks among which a number of items are divided.
+/// @param requested The requested number of tasks, or zero for the number of hardware threads
+/// @param num_items The number of items, which bounds the number of tasks
+auto numParallelTasks(unsigned requested, Index num_items) -> unsigned;
+
+/// Return the contiguous range `[begin, end)` of the items of a task, with the items evenly divided among the tasks.
+/// @param num_items The number of items
+/// @param num_tasks The number of tasks
+/// @param itask The index of the task
+auto parallelTaskRange(Index num_items, unsigned num_tasks, unsigned itask) -> std::pair<Index, Index>;
+
+} // namespace Reaktoro
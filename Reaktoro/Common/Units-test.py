@@ -0,0 +1,76 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import numpy
+import pytest
+from reaktoro import (
+    UnitConverter,
+    convert,
+    converter,
+)
+
+
+def test_unit_converter_temperatures():
+    assert convert(25.0, "degC", "K") == pytest.approx(298.15)
+    assert convert(25.0, "celsius", "kelvin") == pytest.approx(298.15)
+    assert convert(212.0, "degF", "degC") == pytest.approx(100.0)
+    assert convert(32.0, "degF", "K") == pytest.approx(273.15)
+    assert convert(491.67, "degR", "K") == pytest.approx(273.15)
+    assert convert(0.0, "degR", "degF") == pytest.approx(-459.67)
+    assert convert(0.0, "K", "degR") == pytest.approx(0.0, abs=1e-12)
+
+    degC_to_K = converter("degC", "K")
+    assert degC_to_K.scale() == 1.0
+    assert degC_to_K.offset() == 273.15
+
+    degF_to_K = UnitConverter("degF", "K")
+    assert degF_to_K.scale() == pytest.approx(1.0/1.8)
+    assert degF_to_K.offset() == pytest.approx(273.15 - 32.0/1.8)
+    assert degF_to_K(-40.0) == pytest.approx(233.15)
+
+
+@pytest.mark.parametrize("units", [
+    ("degC", "K"),
+    ("degF", "degC"),
+    ("degR", "degF"),
+    ("fahrenheit", "rankine"),
+    ("bar", "Pa"),
+    ("kJ/mol", "cal/mol"),
+    ("g/cm3", "kg/m3"),
+])
+def test_unit_converter_round_trip(units):
+    forward = converter(units[0], units[1])
+    backward = converter(units[1], units[0])
+    for value in [-40.0, 0.0, 1.0, 25.0, 1.0e5]:
+        assert backward(forward(value)) == pytest.approx(value, rel=1e-14, abs=1e-10)
+        assert forward(value) == pytest.approx(convert(value, units[0], units[1]), rel=1e-14)
+
+
+def test_unit_converter_vectors():
+    T = numpy.array([0.0, 25.0, 100.0, 300.0])
+
+    assert convert(T, "degC", "K") == pytest.approx(T + 273.15)
+    assert UnitConverter("degC", "degF")(T) == pytest.approx(1.8*T + 32.0)
+    assert convert(numpy.array([1.0, 2.0]), "bar", "Pa") == pytest.approx([1.0e5, 2.0e5])
+
+
+def test_unit_converter_invalid_units():
+    with pytest.raises(RuntimeError):
+        UnitConverter("m", "kg")
+
+    with pytest.raises(RuntimeError):
+        converter("degC", "Pa")
@@ -15,6 +15,8 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+#include "Units.hpp"
+
 // C++ includes
 #include <algorithm>
 #include <cmath>
@@ -22,8 +24,11 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 using std::endl;
 using std::pow;
@@ -461,6 +466,24 @@ inline void checkDerivedUnit(const string& symbol)
     }
 }
 
+/// Return the scale and offset that convert a temperature from a unit to kelvin, as done by @ref toKelvin
+std::pair<double, double> toKelvinScaleOffset(const string& from)
+{
+    if(from == "K") return {1.0, 0.0};
+    const auto& unit = temperatureUnitsMap.at(from);
+    const auto inner = toKelvinScaleOffset(unit.symbol);
+    return {inner.first/unit.factor, inner.second - inner.first*unit.translate/unit.factor};
+}
+
+/// Return the scale and offset that convert a temperature from kelvin to a unit, as done by @ref fromKelvin
+std::pair<double, double> fromKelvinScaleOffset(const string& to)
+{
+    if(to == "K") return {1.0, 0.0};
+    const auto& unit = temperatureUnitsMap.at(to);
+    const auto inner = fromKelvinScaleOffset(unit.symbol);
+    return {unit.factor*inner.first, unit.factor*inner.second + unit.translate};
+}
+
 double convertTemperature(double value, const string& from, const string& to)
 {
     checkTemperatureUnit(from);
@@ -639,25 +662,72 @@ inline void checkConvertibleUnits(const DerivedUnit& from, const DerivedUnit& to
     }
 }
 
+/// The converters created so far for each pair of units
+map<std::pair<string, string>, UnitConverter> converters;
+
+/// The results of the convertibility checks done so far for each pair of units
+map<std::pair<string, string>, bool> convertibles;
+
+/// The mutex that protects the converters and the results of the convertibility checks
+std::shared_mutex converters_mutex;
+
 } // namespace internal
 
-double convert(double value, const string& from, const string& to)
+UnitConverter::UnitConverter()
+{}
+
+UnitConverter::UnitConverter(const string& from, const string& to)
 {
     if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
-        return internal::convertTemperature(value, from, to);
+    {
+        const auto tokelvin = internal::toKelvinScaleOffset(from);
+        const auto fromkelvin = internal::fromKelvinScaleOffset(to);
+        m_scale = fromkelvin.first * tokelvin.first;
+        m_offset = fromkelvin.first * tokelvin.second + fromkelvin.second;
+        return;
+    }
     auto parsed_from = internal::parseUnit(from);
     auto parsed_to   = internal::parseUnit(to);
     internal::checkConvertibleUnits(parsed_from, parsed_to, from, to);
-    return value * internal::factor(parsed_from)/internal::factor(parsed_to);
+    m_scale = internal::factor(parsed_from)/internal::factor(parsed_to);
+}
+
+auto converter(const string& from, const string& to) -> const UnitConverter&
+{
+    const auto key = std::make_pair(from, to);
+    {
+        std::shared_lock<std::shared_mutex> lock(internal::converters_mutex);
+        auto iter = internal::converters.find(key);
+        if(iter != internal::converters.end())
+            return iter->second;
+    }
+    // Parse the units without holding the lock, and do not keep a converter if the units are invalid
+    UnitConverter converter(from, to);
+    std::unique_lock<std::shared_mutex> lock(internal::converters_mutex);
+    return internal::converters.emplace(key, converter).first->second;
+}
+
+double convert(double value, const string& from, const string& to)
+{
+    return converter(from, to)(value);
 }
 
 bool convertible(const std::string& from, const std::string& to)
 {
     if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
         return true;
+    const auto key = std::make_pair(from, to);
+    {
+        std::shared_lock<std::shared_mutex> lock(internal::converters_mutex);
+        auto iter = internal::convertibles.find(key);
+        if(iter != internal::convertibles.end())
+            return iter->second;
+    }
     auto parsed_from = internal::parseUnit(from);
     auto parsed_to   = internal::parseUnit(to);
-    return dimension(parsed_from) == dimension(parsed_to);
+    const bool result = dimension(parsed_from) == dimension(parsed_to);
+    std::unique_lock<std::shared_mutex> lock(internal::converters_mutex);
+    return internal::convertibles.emplace(key, result).first->second;
 }
 
 } // namespace units
@@ -22,6 +22,51 @@
 
 namespace units {
 
+/// A class that converts numeric values from a unit to another.
+/// The unit strings are parsed and checked for compatible dimensions only once, when
+/// the converter is created, so that every conversion is a multiplication and an addition.
+/// Use it to convert many values between the same units, as in the setup of large problems.
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/// UnitConverter converter("celsius", "kelvin");
+/// double T = converter(25.0); // T is 298.15
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+class UnitConverter
+{
+public:
+    /// Construct a UnitConverter instance that does not change the values.
+    UnitConverter();
+
+    /// Construct a UnitConverter instance from a unit to another.
+    /// It throws an exception if the units are unknown or their dimensions do not match.
+    /// @param from The string representing the unit from which the conversion is made
+    /// @param to The string representing the unit to which the conversion is made
+    UnitConverter(const std::string& from, const std::string& to);
+
+    /// Return the factor by which the values are multiplied in the conversion.
+    auto scale() const -> double { return m_scale; }
+
+    /// Return the value added to the values after their multiplication by @ref scale, which is non-zero only for temperatures.
+    auto offset() const -> double { return m_offset; }
+
+    /// Convert a numeric value.
+    /// The conversion of vectors of numeric values is declared in UnitsVector.hpp.
+    auto operator()(double value) const -> double { return m_scale * value + m_offset; }
+
+private:
+    /// The factor by which the values are multiplied in the conversion
+    double m_scale = 1.0;
+
+    /// The value added to the values after their multiplication by the scale factor
+    double m_offset = 0.0;
+};
+
+/// Return the converter from a unit to another.
+/// The converters are created once for each pair of units and kept for
+/// the lifetime of the program, and this function can be called from many threads.
+/// @param from The string representing the unit from which the conversion is made
+/// @param to The string representing the unit to which the conversion is made
+auto converter(const std::string& from, const std::string& to) -> const UnitConverter&;
+
 /// Convert a numeric value from a unit to another
 /// @param value The value
 /// @param from The string representing the unit from which the conversion is made
@@ -0,0 +1,32 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "UnitsVector.hpp"
+
+namespace units {
+
+auto convert(Reaktoro::VectorConstRef values, const UnitConverter& converter) -> Reaktoro::Vector
+{
+    return (converter.scale() * values.array() + converter.offset()).matrix();
+}
+
+auto convert(Reaktoro::VectorConstRef values, const std::string& from, const std::string& to) -> Reaktoro::Vector
+{
+    return convert(values, converter(from, to));
+}
+
+} // namespace units
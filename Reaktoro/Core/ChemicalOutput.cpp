@@ -18,12 +18,22 @@
 #include "ChemicalOutput.hpp"
 
 // C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <cmath>
+#include <limits>
+#include <type_traits>
+#include <variant>
+
+// miniz includes
+#include <miniz/miniz.h>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AsyncWriter.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
@@ -34,6 +44,104 @@
 #include <Reaktoro/Core/ReactionSystem.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The identifier at the beginning of a file written by ChemicalOutput in binary format.
+/// The identifier is followed by the version of the format, the compression level, the number of
+/// columns and, for each column, its heading and quantity name. The rest of the file is a sequence
+/// of chunks, each with its number of rows, its number of bytes, and the values of its rows stored
+/// column by column as double-precision numbers. All numbers in the file are stored in little-endian
+/// byte order, regardless of the byte order of the machine that wrote the file. Compressed chunks are
+/// byte-shuffled before deflate compression.
+const char binary_magic[8] = {'R', 'K', 'T', 'O', 'U', 'T', 'B', 'N'};
+
+/// The version of the binary format of ChemicalOutput.
+const std::uint32_t binary_version = 1;
+
+/// Store the bytes of an unsigned integer in little-endian byte order.
+template<typename T>
+auto storeLittleEndian(T value, unsigned char* dst) -> void
+{
+    for(Index k = 0; k < sizeof(T); ++k)
+        dst[k] = static_cast<unsigned char>(value >> (8*k));
+}
+
+/// Load an unsigned integer from its bytes in little-endian byte order.
+template<typename T>
+auto loadLittleEndian(const unsigned char* src) -> T
+{
+    T value = 0;
+    for(Index k = 0; k < sizeof(T); ++k)
+        value |= static_cast<T>(src[k]) << (8*k);
+    return value;
+}
+
+/// Store the bytes of a double-precision number in little-endian byte order.
+auto storeDouble(double value, unsigned char* dst) -> void
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    storeLittleEndian(bits, dst);
+}
+
+/// Load a double-precision number from its bytes in little-endian byte order.
+auto loadDouble(const unsigned char* src) -> double
+{
+    const auto bits = loadLittleEndian<std::uint64_t>(src);
+    double value;
+    std::memcpy(&value, &bits, sizeof(double));
+    return value;
+}
+
+template<typename T>
+auto writeValue(std::ostream& out, T value) -> void
+{
+    unsigned char bytes[sizeof(T)];
+    storeLittleEndian(value, bytes);
+    out.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+}
+
+auto writeString(std::ostream& out, const std::string& str) -> void
+{
+    writeValue<std::uint32_t>(out, str.size());
+    out.write(str.data(), str.size());
+}
+
+template<typename T>
+auto readValue(std::istream& in) -> T
+{
+    unsigned char bytes[sizeof(T)] = {};
+    in.read(reinterpret_cast<char*>(bytes), sizeof(T));
+    return loadLittleEndian<T>(bytes);
+}
+
+auto readString(std::istream& in) -> std::string
+{
+    std::string str(readValue<std::uint32_t>(in), '\0');
+    in.read(&str[0], str.size());
+    return str;
+}
+
+/// Group the i-th bytes of all values together, which makes the values of a column compress better.
+auto shuffle(const unsigned char* src, unsigned char* dst, Index num_values, Index size) -> void
+{
+    for(Index i = 0; i < num_values; ++i)
+        for(Index k = 0; k < size; ++k)
+            dst[k*num_values + i] = src[i*size + k];
+}
+
+/// Revert the grouping of bytes performed by @ref shuffle.
+auto unshuffle(const unsigned char* src, unsigned char* dst, Index num_values, Index size) -> void
+{
+    for(Index i = 0; i < num_values; ++i)
+        for(Index k = 0; k < size; ++k)
+            dst[i*size + k] = src[k*num_values + i];
+}
+
+/// The number of rows that can wait to be written by the background writer of ChemicalOutput.
+const Index async_capacity = 1024;
+
+} // namespace
 
 struct ChemicalOutput::Impl
 {
@@ -64,6 +172,9 @@ struct ChemicalOutput::Impl
     /// The names of the quantities to be output.
     std::vector<std::string> data;
 
+    /// The functions that evaluate the quantities to be output, created when the output is opened (empty for the iteration number).
+    std::vector<ChemicalQuantity::Function> functions;
+
     /// The names of the quantities to appear as column header in the output.
     std::vector<std::string> headings;
 
@@ -88,6 +199,36 @@ struct ChemicalOutput::Impl
     /// The spacings between the columns
     std::vector<int> spacings;
 
+    /// The flag that indicates if the output file is written in binary format.
+    bool binary = false;
+
+    /// The compression level of the chunks in binary format.
+    int compression = 0;
+
+    /// The number of rows in a chunk in binary format.
+    Index chunksize = 1024;
+
+    /// The values of the buffered rows in binary format, stored row by row.
+    std::vector<double> buffer;
+
+    /// The bytes of the values of the chunk being written in binary format, stored column by column.
+    std::vector<unsigned char> chunk;
+
+    /// The bytes of the chunk being written in binary format, shuffled and compressed.
+    std::vector<unsigned char> bytes;
+
+    /// The type of the values in a row of the output.
+    using Value = std::variant<double, int, std::string>;
+
+    /// The values of the row being collected from the updates and attachments.
+    std::vector<Value> row;
+
+    /// The flag that indicates if the rows are written by a background thread.
+    bool asynchronous = false;
+
+    /// The background writer of the rows, active between open and close if asynchronous.
+    std::unique_ptr<AsyncWriter<std::vector<Value>>> writer;
+
     Impl()
     : quantity(system)
     {}
@@ -124,9 +265,17 @@ struct ChemicalOutput::Impl
         if(headings.empty())
             headings = data;
 
+        // Resolve the quantities once, so that updates do not parse their names
+        functions.clear();
+        for(auto word : data)
+            functions.push_back(word == "i" ? ChemicalQuantity::Function() : quantity.function(word));
+
         // Open the data file
+        auto mode = std::ofstream::out | std::ofstream::trunc;
+        if(binary)
+            mode |= std::ofstream::binary;
         if(!filename.empty())
-            datafile.open(filename, std::ofstream::out | std::ofstream::trunc);
+            datafile.open(filename, mode);
 
         // Check if scientific format should be used
         if(scientific)
@@ -145,7 +294,7 @@ struct ChemicalOutput::Impl
         for(auto word : headings)
         {
             auto space = spacings[icolumn];
-            if(datafile.is_open()) datafile << std::left << std::setw(space) << word;
+            if(datafile.is_open() && !binary) datafile << std::left << std::setw(space) << word;
             if(terminal)
             {
                 std::ios::fmtflags flags(std::cout.flags());
@@ -156,32 +305,145 @@ struct ChemicalOutput::Impl
             }
             ++icolumn;
         }
+
+        // Output the schema of the binary data file
+        row.clear();
+        buffer.clear();
+        if(datafile.is_open() && binary)
+        {
+            datafile.write(binary_magic, sizeof(binary_magic));
+            writeValue<std::uint32_t>(datafile, binary_version);
+            writeValue<std::uint32_t>(datafile, compression);
+            writeValue<std::uint32_t>(datafile, headings.size());
+            for(Index i = 0; i < headings.size(); ++i)
+            {
+                writeString(datafile, headings[i]);
+                writeString(datafile, i < data.size() ? data[i] : "");
+            }
+        }
+
+        // Start the background writer that formats and writes the rows
+        if(asynchronous)
+            writer.reset(new AsyncWriter<std::vector<Value>>(async_capacity,
+                [this](std::vector<Value>& values) { write(values); }));
     }
 
     auto close() -> void
     {
+        // Write the last row, even if some of its attachments are missing
+        if(!row.empty())
+            commit();
+
+        // Wait until the background writer has written all rows
+        if(writer)
+        {
+            auto finished = std::move(writer);
+            finished->close();
+        }
+
+        if(datafile.is_open() && binary)
+            flush();
         datafile.close();
     }
 
-    auto update(const ChemicalState& state, double t) -> void
+    /// Write the collected row, or pass it to the background writer.
+    auto commit() -> void
     {
-        // Output values on a new line
-        if(datafile.is_open()) datafile << std::endl;
+        if(writer) writer->push(std::move(row));
+        else write(row);
+        row.clear();
+    }
+
+    /// Write a row of values to the data file and terminal.
+    auto write(const std::vector<Value>& values) -> void
+    {
+        // Output values on a new line, without flushing the data file on every update
+        if(datafile.is_open() && !binary) datafile << '\n';
         if(terminal) std::cout << std::endl;
 
-        // Output the current chemical state to the data file.
-        quantity.update(state, t);
+        // Append the row to the buffer of the binary data file, writing the buffered rows if it is full
+        const Index num_columns = headings.size();
+        if(datafile.is_open() && binary)
+        {
+            buffer.resize(buffer.size() + num_columns, std::numeric_limits<double>::quiet_NaN());
+            for(Index i = 0; i < values.size() && i < num_columns; ++i)
+                buffer[buffer.size() - num_columns + i] = std::holds_alternative<int>(values[i]) ?
+                    std::get<int>(values[i]) : std::get<double>(values[i]);
+            if(buffer.size() >= chunksize * num_columns)
+                flush();
+        }
 
-        // For each quantity, ouput its value on each column
-        icolumn = 0;
-        for(auto word : data)
+        for(Index i = 0; i < values.size() && i < spacings.size(); ++i)
         {
-            auto space = spacings[icolumn];
-            auto val = (word == "i") ? iteration : quantity.value(word);
-            if(datafile.is_open()) datafile << std::left << std::setw(space) << val;
-            if(terminal) std::cout << std::left << std::setw(space) << val;
-            ++icolumn;
+            const auto space = spacings[i];
+            std::visit([&](const auto& value) {
+                if(datafile.is_open() && !binary) datafile << std::left << std::setw(space) << value;
+                if(terminal) std::cout << std::left << std::setw(space) << value;
+            }, values[i]);
         }
+    }
+
+    /// Write the buffered rows as a chunk in the binary data file.
+    auto flush() -> void
+    {
+        const Index num_columns = headings.size();
+        const Index num_rows = num_columns ? buffer.size()/num_columns : 0;
+
+        if(num_rows == 0)
+            return;
+
+        // Transpose the buffered rows so that the values of each column are contiguous
+        chunk.resize(buffer.size() * sizeof(double));
+        for(Index i = 0; i < num_rows; ++i)
+            for(Index j = 0; j < num_columns; ++j)
+                storeDouble(buffer[i*num_columns + j], &chunk[(j*num_rows + i) * sizeof(double)]);
+
+        const char* ptr = reinterpret_cast<const char*>(chunk.data());
+        mz_ulong num_bytes = chunk.size();
+
+        if(compression > 0)
+        {
+            std::vector<unsigned char> shuffled(num_bytes);
+            shuffle(chunk.data(), shuffled.data(), buffer.size(), sizeof(double));
+
+            mz_ulong num_compressed = mz_compressBound(num_bytes);
+            bytes.resize(num_compressed);
+
+            const int status = mz_compress2(bytes.data(), &num_compressed, shuffled.data(), num_bytes, std::min(compression, 9));
+
+            Assert(status == MZ_OK, "Cannot write the output file `" + filename + "`.",
+                "The compression of a chunk of the binary output file failed.");
+
+            ptr = reinterpret_cast<const char*>(bytes.data());
+            num_bytes = num_compressed;
+        }
+
+        writeValue<std::uint64_t>(datafile, num_rows);
+        writeValue<std::uint64_t>(datafile, num_bytes);
+        datafile.write(ptr, num_bytes);
+
+        buffer.clear();
+    }
+
+    auto update(const ChemicalState& state, double t) -> void
+    {
+        // Write the previous row, even if some of its attachments are missing
+        if(!row.empty())
+            commit();
+
+        // Evaluate the quantities at the current chemical state, without copying it
+        quantity.bind(state, t);
+
+        // For each quantity, collect its value on each column
+        for(const auto& function : functions)
+        {
+            auto val = function ? function() : iteration;
+            row.push_back(val);
+        }
+
+        // Write the row now if no attachments are expected
+        if(row.size() >= headings.size())
+            commit();
 
         // Update the iteration number
         ++iteration;
@@ -190,10 +452,16 @@ struct ChemicalOutput::Impl
     template<typename ValueType>
     auto attach(ValueType value) -> void
     {
-        auto space = spacings[icolumn];
-        if(datafile.is_open()) datafile << std::left << std::setw(space) << value;
-        if(terminal) std::cout << std::left << std::setw(space) << value;
-        ++icolumn;
+        if constexpr(!std::is_arithmetic<ValueType>::value)
+            Assert(!(datafile.is_open() && binary),
+                "Cannot attach the value `" + value + "` to the binary output file `" + filename + "`.",
+                "Attachments to an output file in binary format must be numbers.");
+
+        row.push_back(value);
+
+        // Write the row once all attachments have been collected
+        if(row.size() >= headings.size())
+            commit();
     }
 };
 
@@ -292,6 +560,26 @@ auto ChemicalOutput::terminal(bool enabled) -> void
     pimpl->terminal = enabled;
 }
 
+auto ChemicalOutput::asynchronous(bool enabled) -> void
+{
+    pimpl->asynchronous = enabled;
+}
+
+auto ChemicalOutput::binary(bool enabled) -> void
+{
+    pimpl->binary = enabled;
+}
+
+auto ChemicalOutput::compression(int level) -> void
+{
+    pimpl->compression = std::max(level, 0);
+}
+
+auto ChemicalOutput::chunksize(Index rows) -> void
+{
+    pimpl->chunksize = std::max<Index>(rows, 1);
+}
+
 auto ChemicalOutput::quantities() const -> std::vector<std::string>
 {
     return pimpl->data;
@@ -322,4 +610,85 @@ ChemicalOutput::operator bool() const
     return pimpl->terminal || pimpl->filename.size();
 }
 
+auto readChemicalOutput(std::string filename) -> ChemicalOutputData
+{
+    const std::string error = "Cannot read the output file `" + filename + "`.";
+
+    std::ifstream file(filename, std::ifstream::in | std::ifstream::binary);
+
+    Assert(file.is_open(), error, "The file could not be opened.");
+
+    char magic[sizeof(binary_magic)];
+    file.read(magic, sizeof(magic));
+
+    Assert(file && std::equal(magic, magic + sizeof(magic), binary_magic), error,
+        "The file was not written by ChemicalOutput in binary format.");
+
+    const auto version = readValue<std::uint32_t>(file);
+
+    Assert(version == binary_version, error,
+        "The version " + std::to_string(version) + " of the binary format is not supported.");
+
+    const auto compression = readValue<std::uint32_t>(file);
+    const auto num_columns = readValue<std::uint32_t>(file);
+
+    ChemicalOutputData data;
+    for(Index j = 0; j < num_columns; ++j)
+    {
+        data.headings.push_back(readString(file));
+        data.quantities.push_back(readString(file));
+    }
+
+    Assert(file, error, "The header of the file is incomplete.");
+
+    // The chunks of the file, each with its values stored column by column
+    std::vector<std::vector<double>> chunks;
+    Index num_rows = 0;
+
+    std::vector<unsigned char> bytes, shuffled;
+
+    while(file.peek() != std::ifstream::traits_type::eof())
+    {
+        const auto rows = readValue<std::uint64_t>(file);
+        const auto num_bytes = readValue<std::uint64_t>(file);
+
+        bytes.resize(num_bytes);
+        file.read(reinterpret_cast<char*>(bytes.data()), num_bytes);
+
+        Assert(file, error, "The file ends in the middle of a chunk.");
+
+        std::vector<double> chunk(rows * num_columns);
+        mz_ulong size = chunk.size() * sizeof(double);
+
+        if(compression > 0)
+        {
+            shuffled.resize(size);
+            const int status = mz_uncompress(shuffled.data(), &size, bytes.data(), num_bytes);
+            Assert(status == MZ_OK && size == chunk.size() * sizeof(double), error,
+                "The decompression of a chunk of the file failed.");
+            bytes.resize(size);
+            unshuffle(shuffled.data(), bytes.data(), chunk.size(), sizeof(double));
+        }
+        else Assert(num_bytes == size, error, "The size of a chunk of the file does not match its number of rows.");
+
+        for(Index i = 0; i < chunk.size(); ++i)
+            chunk[i] = loadDouble(&bytes[i * sizeof(double)]);
+
+        num_rows += rows;
+        chunks.push_back(std::move(chunk));
+    }
+
+    data.values.resize(num_rows, num_columns);
+
+    Index offset = 0;
+    for(const auto& chunk : chunks)
+    {
+        const Index rows = chunk.size()/std::max<Index>(num_columns, 1);
+        data.values.middleRows(offset, rows) = Eigen::Map<const Matrix>(chunk.data(), rows, num_columns);
+        offset += rows;
+    }
+
+    return data;
+}
+
 } // namespace Reaktoro
@@ -23,6 +23,10 @@
 #include <sstream>
 #include <string>
 
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
 namespace Reaktoro {
 
 // Forward declarations
@@ -95,6 +99,25 @@ public:
     /// Enable or disable the output to the terminal.
     auto terminal(bool enabled) -> void;
 
+    /// Enable or disable writing the output on a background thread.
+    /// The values of the quantities are still evaluated in the calling thread of @ref update,
+    /// but they are formatted and written by a background thread. The update waits only if many
+    /// rows are still waiting to be written, and @ref close waits until all rows are written.
+    auto asynchronous(bool enabled) -> void;
+
+    /// Enable or disable the output to the file in binary format.
+    /// The binary format stores the values of the quantities as double-precision numbers,
+    /// grouped by column in chunks of rows, and can be read with @ref readChemicalOutput.
+    /// Attachments in binary format must be numbers.
+    auto binary(bool enabled) -> void;
+
+    /// Set the compression level of the chunks in the binary format.
+    /// @param level The compression level, from 0 (no compression) to 9 (best compression)
+    auto compression(int level) -> void;
+
+    /// Set the number of rows buffered before a chunk is written in the binary format.
+    auto chunksize(Index rows) -> void;
+
     /// Return the name of the quantities in the output file.
     auto quantities() const -> std::vector<std::string>;
 
@@ -119,4 +142,21 @@ private:
     std::shared_ptr<Impl> pimpl;
 };
 
+/// The data in a file written by ChemicalOutput in binary format.
+struct ChemicalOutputData
+{
+    /// The headings of the columns.
+    std::vector<std::string> headings;
+
+    /// The names of the quantities in the columns, empty for attachments.
+    std::vector<std::string> quantities;
+
+    /// The values in the file, with one row per update and one column per heading.
+    Matrix values;
+};
+
+/// Read a file written by ChemicalOutput in binary format.
+/// @param filename The name of the binary output file
+auto readChemicalOutput(std::string filename) -> ChemicalOutputData;
+
 } // namespace Reaktoro
@@ -26,6 +26,7 @@
 #include <boost/format.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AsyncWriter.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
@@ -155,6 +156,15 @@ struct ChemicalPlot::Impl
     /// The iteration number for every update call
     Index iteration = 0;
 
+    /// The functions that evaluate the quantities along the x and y axes, created when the plot is opened (empty for the iteration number).
+    std::vector<ChemicalQuantity::Function> functions;
+
+    /// The flag that indicates if the data is written and the plot refreshed by a background thread.
+    bool asynchronous = false;
+
+    /// The background writer of the rows of the data file, active between open and close if asynchronous.
+    std::unique_ptr<AsyncWriter<std::vector<double>>> writer;
+
     /// The counter of ChemicalPlot instances
     static unsigned counter;
 
@@ -198,6 +208,12 @@ struct ChemicalPlot::Impl
         plotname = name + ".plt";
         endname  = name + ".end";
 
+        // Resolve the quantities once, so that updates do not parse their names
+        functions.clear();
+        functions.push_back(quantity.function(x));
+        for(auto item : y)
+            functions.push_back(std::get<1>(item) == "i" ? ChemicalQuantity::Function() : quantity.function(std::get<1>(item)));
+
         // Open the data and gnuplot script files
         datafile.open(dataname);
         plotfile.open(plotname);
@@ -280,10 +296,22 @@ struct ChemicalPlot::Impl
 
         // Flush the plot file to ensure its correct state before the plot starts
         plotfile.flush();
+
+        // Start the background writer that writes the rows of the data file and starts Gnuplot
+        if(asynchronous)
+            writer.reset(new AsyncWriter<std::vector<double>>(1024,
+                [this](std::vector<double>& values) { write(values); }));
     }
 
     auto close() -> void
     {
+        // Wait until the background writer has written all rows
+        if(writer)
+        {
+            auto finished = std::move(writer);
+            finished->close();
+        }
+
         if(pipe != nullptr)
         {
             // Create the file that signals Gnuplot to stop rereading the input script
@@ -305,15 +333,29 @@ struct ChemicalPlot::Impl
 
     auto update(const ChemicalState& state, double t) -> void
     {
-        // Output the current chemical state to the data file.
-        quantity.update(state, t);
-        datafile << std::left << std::setw(20) << quantity.value(x);
-        for(auto item : y)
+        // Collect the values of the quantities in the current chemical state, without copying it
+        quantity.bind(state, t);
+        std::vector<double> values;
+        values.reserve(functions.size());
+        for(const auto& function : functions)
         {
-            std::string qstr = std::get<1>(item);
-            auto val = (qstr == "i") ? iteration : quantity.value(qstr);
-            datafile << std::left << std::setw(20) << val;
+            auto val = function ? function() : iteration;
+            values.push_back(val);
         }
+
+        // Output the values to the data file, or pass them to the background writer
+        if(writer) writer->push(std::move(values));
+        else write(values);
+
+        // Update the iteration number
+        ++iteration;
+    }
+
+    /// Write a row of values to the data file and start Gnuplot if not yet started.
+    auto write(const std::vector<double>& values) -> void
+    {
+        for(auto val : values)
+            datafile << std::left << std::setw(20) << val;
         datafile << std::endl;
 
         // Open the Gnuplot plot after the first data has been output to the data file.
@@ -323,9 +365,6 @@ struct ChemicalPlot::Impl
             std::string command = ("gnuplot -persist -e \"current=''\" " + plotname + " >> gnuplot.log 2>&1");
             pipe = popen(command.c_str(), "w");
         }
-
-        // Update the iteration number
-        ++iteration;
     }
 };
 
@@ -452,6 +491,11 @@ auto ChemicalPlot::frequency(unsigned frequency) -> void
     pimpl->frequency = frequency;
 }
 
+auto ChemicalPlot::asynchronous(bool enabled) -> void
+{
+    pimpl->asynchronous = enabled;
+}
+
 auto ChemicalPlot::operator<<(std::string command) -> ChemicalPlot&
 {
     pimpl->config.append(command + "\n");
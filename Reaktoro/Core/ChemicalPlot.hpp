@@ -167,6 +167,10 @@ public:
     /// Set the refresh rate of the real-time plot.
     auto frequency(unsigned frequency) -> void;
 
+    /// Enable or disable writing the data file and starting Gnuplot on a background thread.
+    /// The values of the quantities are still evaluated in the calling thread of @ref update.
+    auto asynchronous(bool enabled) -> void;
+
     /// Inject a gnuplot command to the script file.
     auto operator<<(std::string command) -> ChemicalPlot&;
 
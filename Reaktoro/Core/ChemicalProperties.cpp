@@ -28,9 +28,14 @@ ChemicalProperties::ChemicalProperties()
 {}
 
 ChemicalProperties::ChemicalProperties(const ChemicalSystem& system)
+: ChemicalProperties(system, true)
+{}
+
+ChemicalProperties::ChemicalProperties(const ChemicalSystem& system, bool derivatives)
 : system(system), num_species(system.numSpecies()), num_phases(system.numPhases()),
-  T(NAN), P(NAN), n(zeros(num_species)), x(num_species),
-  tres(num_phases, num_species), cres(num_phases, num_species)
+  num_derivatives(derivatives ? num_species : 0),
+  T(NAN), P(NAN), n(zeros(num_species)), x(num_species, num_derivatives),
+  tres(num_phases, num_species), cres(num_phases, num_species, derivatives)
 {}
 
 auto ChemicalProperties::update(double T_, double P_) -> void
@@ -60,7 +65,7 @@ auto ChemicalProperties::update(VectorConstRef n_) -> void
     {
         const auto size = system.numSpeciesInPhase(iphase);
         const auto np = rows(n, offset, size);
-        const auto npc = Composition(np);
+        const auto npc = Composition(np, num_derivatives ? size : 0);
         auto xp = rows(x, offset, offset, size, size);
         if(size == 1) {
             xp = 1.0;
@@ -89,6 +94,14 @@ auto ChemicalProperties::update(double T_, double P_, VectorConstRef n_, const T
     n = n_;
     tres = tres_;
     cres = cres_;
+    num_derivatives = cres.derivatives() ? num_species : 0;
+    if(x.ddn.cols() != num_derivatives)
+        x.resize(num_species, num_derivatives);
+}
+
+auto ChemicalProperties::derivatives() const -> bool
+{
+    return cres.derivatives();
 }
 
 auto ChemicalProperties::temperature() const -> Temperature
@@ -103,7 +116,7 @@ auto ChemicalProperties::pressure() const -> Pressure
 
 auto ChemicalProperties::composition() const -> Composition
 {
-    return Composition(n);
+    return Composition(n, num_derivatives);
 }
 
 auto ChemicalProperties::thermoModelResult() const -> const ThermoModelResult&
@@ -197,7 +210,7 @@ auto ChemicalProperties::standardPartialMolarHeatCapacitiesConstV() const -> The
 
 auto ChemicalProperties::phaseMolarGibbsEnergies() const -> ChemicalVector
 {
-    ChemicalVector res(num_phases, num_species);
+    ChemicalVector res(num_phases, num_derivatives);
     Index ispecies = 0;
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
@@ -214,7 +227,7 @@ auto ChemicalProperties::phaseMolarGibbsEnergies() const -> ChemicalVector
 
 auto ChemicalProperties::phaseMolarEnthalpies() const -> ChemicalVector
 {
-    ChemicalVector res(num_phases, num_species);
+    ChemicalVector res(num_phases, num_derivatives);
     Index ispecies = 0;
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
@@ -231,7 +244,7 @@ auto ChemicalProperties::phaseMolarEnthalpies() const -> ChemicalVector
 
 auto ChemicalProperties::phaseMolarVolumes() const -> ChemicalVector
 {
-    ChemicalVector res(num_phases, num_species);
+    ChemicalVector res(num_phases, num_derivatives);
     Index ispecies = 0;
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
@@ -274,7 +287,7 @@ auto ChemicalProperties::phaseMolarHelmholtzEnergies() const -> ChemicalVector
 
 auto ChemicalProperties::phaseMolarHeatCapacitiesConstP() const -> ChemicalVector
 {
-    ChemicalVector res(num_phases, num_species);
+    ChemicalVector res(num_phases, num_derivatives);
     Index ispecies = 0;
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
@@ -291,7 +304,7 @@ auto ChemicalProperties::phaseMolarHeatCapacitiesConstP() const -> ChemicalVecto
 
 auto ChemicalProperties::phaseMolarHeatCapacitiesConstV() const -> ChemicalVector
 {
-    ChemicalVector res(num_phases, num_species);
+    ChemicalVector res(num_phases, num_derivatives);
     Index ispecies = 0;
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
@@ -353,9 +366,9 @@ auto ChemicalProperties::phaseDensities() const -> ChemicalVector
 
 auto ChemicalProperties::phaseMasses() const -> ChemicalVector
 {
-    const auto nc = Composition(n);
+    const auto nc = Composition(n, num_derivatives);
     const auto mm = Reaktoro::molarMasses(system.species());
-    ChemicalVector res(num_phases, num_species);
+    ChemicalVector res(num_phases, num_derivatives);
     Index ispecies = 0;
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
@@ -370,8 +383,8 @@ auto ChemicalProperties::phaseMasses() const -> ChemicalVector
 
 auto ChemicalProperties::phaseAmounts() const -> ChemicalVector
 {
-    const auto nc = Composition(n);
-    ChemicalVector res(num_phases, num_species);
+    const auto nc = Composition(n, num_derivatives);
+    ChemicalVector res(num_phases, num_derivatives);
     Index ispecies = 0;
     for(Index iphase = 0; iphase < num_phases; ++iphase)
     {
@@ -38,6 +38,13 @@ public:
     /// Construct a ChemicalProperties instance with given ChemicalSystem.
     ChemicalProperties(const ChemicalSystem& system);
 
+    /// Construct a ChemicalProperties instance with given ChemicalSystem.
+    /// @param system The chemical system
+    /// @param derivatives The flag that indicates if the derivatives with respect to species amounts are computed.
+    /// If false, only the values and the temperature and pressure derivatives of the chemical properties
+    /// are computed, which is considerably faster for systems with many species.
+    ChemicalProperties(const ChemicalSystem& system, bool derivatives);
+
     /// Update the thermodynamic properties of the chemical system.
     /// @param T The temperature in the system (in units of K)
     /// @param P The pressure in the system (in units of Pa)
@@ -61,6 +68,9 @@ public:
     /// @param cres The result of the ChemicalModel function of the chemical system.
     auto update(double T, double P, VectorConstRef n, const ThermoModelResult& tres, const ChemicalModelResult& cres) -> void;
 
+    /// Return true if the derivatives with respect to species amounts are computed.
+    auto derivatives() const -> bool;
+
     /// Return the temperature of the system (in units of K).
     auto temperature() const -> Temperature;
 
@@ -203,6 +213,9 @@ private:
     /// The number of phases in the system
     Index num_phases;
 
+    /// The number of derivatives with respect to species amounts, which is zero if these are not computed
+    Index num_derivatives;
+
     /// The temperature of the system (in units of K)
     Temperature T;
 
@@ -190,7 +190,7 @@ auto ChemicalProperty::pE(const ChemicalSystem& system, const ReactionEquation&
     ChemicalPropertyFunction f = [=](const ChemicalProperties& properties)
     {
         // The pE of the aqueous phase
-        ChemicalScalar pe(num_species);
+        ChemicalScalar pe(properties.derivatives() ? num_species : 0);
 
         const auto T = properties.temperature();
         const auto RT = universalGasConstant * T;
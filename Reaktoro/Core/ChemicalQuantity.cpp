@@ -31,6 +31,7 @@
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalProperty.hpp>
 #include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Core/Utils.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
 namespace Reaktoro {
@@ -153,27 +154,28 @@ struct ChemicalQuantity::Impl
     /// The reactions in the chemical system
     ReactionSystem reactions;
 
-    /// The chemical state of the system
+    /// The chemical state of the system, copied in method update
     ChemicalState state;
 
+    /// The chemical state referenced in method bind, used instead of the copied one if not null
+    const ChemicalState* bound = nullptr;
+
     /// The thermodynamic properties of the chemical system at (*T*, *P*, **n**)
+    /// (without derivatives with respect to species amounts, unless there are reactions whose rates may use them)
     ChemicalProperties properties;
 
     /// The progress variable at which the chemical state is referred (if time, in units of s)
     double tag;
 
-    /// The temperature of the chemical system (in units of K).
-    double T;
-
-    /// The pressure of the chemical system (in units of Pa).
-    double P;
-
-    /// The molar amounts of the species in the chemical system (in units of mol).
-    Vector n;
-
     /// The rates of the reactions in the chemical system (in units of mol/s).
     ChemicalVector rates;
 
+    /// The flag that indicates if the properties are up to date with the chemical state
+    bool properties_updated = false;
+
+    /// The flag that indicates if the rates are up to date with the chemical state
+    bool rates_updated = false;
+
     /// All created chemical quantity functions from formatted strings
     std::map<std::string, Function> function_map;
 
@@ -181,13 +183,13 @@ struct ChemicalQuantity::Impl
 
     /// Construct a custom Impl instance with given ChemicalSystem object
     explicit Impl(const ChemicalSystem& system)
-    : system(system), state(system)
+    : system(system), state(system), properties(system, false)
     {
     }
 
     /// Construct a custom Impl instance with given ReactionSystem object
     Impl(const ReactionSystem& reactions)
-    : system(reactions.system()), state(system), reactions(reactions)
+    : system(reactions.system()), reactions(reactions), state(system), properties(system)
     {
     }
 
@@ -202,21 +204,53 @@ struct ChemicalQuantity::Impl
     {
         // Update the chemical state of the system
         state = state_;
+        bound = nullptr;
 
         // Update the progress variable
         tag = t_;
 
-        // Update the temperature, pressure and molar composition of the system
-        T = state.temperature();
-        P = state.pressure();
-        n = state.speciesAmounts();
+        // The properties and rates are computed only when first needed by a quantity
+        properties_updated = false;
+        rates_updated = false;
+    }
 
-        // Update the thermodynamic properties of the system
-        properties = system.properties(T, P, n);
+    /// Update the chemical quantity instance with a reference to a chemical state
+    auto bind(const ChemicalState& state_, double t_) -> void
+    {
+        bound = &state_;
+        tag = t_;
+        properties_updated = false;
+        rates_updated = false;
+    }
 
-        // Update the rates of the reactions
-        if(!reactions.reactions().empty())
-            rates = reactions.rates(properties);
+    /// Return the current chemical state, either copied or referenced
+    auto currentState() const -> const ChemicalState&
+    {
+        return bound ? *bound : state;
+    }
+
+    /// Return the thermodynamic properties of the system, updated at the current chemical state if needed
+    auto currentProperties() -> const ChemicalProperties&
+    {
+        if(!properties_updated)
+        {
+            const ChemicalState& current = currentState();
+            properties.update(current.temperature(), current.pressure(), current.speciesAmounts());
+            properties_updated = true;
+        }
+        return properties;
+    }
+
+    /// Return the rates of the reactions, updated at the current chemical state if needed
+    auto currentRates() -> const ChemicalVector&
+    {
+        if(!rates_updated)
+        {
+            if(!reactions.reactions().empty())
+                reactions.rates(currentProperties(), rates);
+            rates_updated = true;
+        }
+        return rates;
     }
 
     auto function(const ChemicalQuantity& quantity, std::string str) -> Function
@@ -272,17 +306,17 @@ auto ChemicalQuantity::reactions() const -> const ReactionSystem&
 
 auto ChemicalQuantity::state() const -> const ChemicalState&
 {
-    return pimpl->state;
+    return pimpl->currentState();
 }
 
 auto ChemicalQuantity::properties() const -> const ChemicalProperties&
 {
-    return pimpl->properties;
+    return pimpl->currentProperties();
 }
 
 auto ChemicalQuantity::rates() const -> const ChemicalVector&
 {
-    return pimpl->rates;
+    return pimpl->currentRates();
 }
 
 auto ChemicalQuantity::tag() const -> double
@@ -302,6 +336,12 @@ auto ChemicalQuantity::update(const ChemicalState& state, double t) -> ChemicalQ
     return *this;
 }
 
+auto ChemicalQuantity::bind(const ChemicalState& state, double t) -> ChemicalQuantity&
+{
+    pimpl->bind(state, t);
+    return *this;
+}
+
 auto ChemicalQuantity::value(std::string str) const -> double
 {
     return pimpl->value(*this, str);
@@ -684,12 +724,14 @@ auto phaseAmount(const ChemicalQuantity& quantity, std::string arguments) -> std
     const ChemicalSystem& system = quantity.system();
     const std::string phase = args.argument(0);
     const Index iphase = system.indexPhaseWithError(phase);
+    const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
+    const Index size = system.numSpeciesInPhase(iphase);
     const std::string units = args.argument("units", "mol");
     const double factor = units::convert(1.0, "mol", units);
     auto func = [=]() -> double
     {
-        const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.phaseAmounts().val[iphase];
+        const ChemicalState& state = quantity.state();
+        const double val = state.speciesAmounts().segment(ifirst, size).sum();
         return factor * val;
     };
     return func;
@@ -701,12 +743,14 @@ auto phaseMass(const ChemicalQuantity& quantity, std::string arguments) -> std::
     const ChemicalSystem& system = quantity.system();
     const std::string phase = args.argument(0);
     const Index iphase = system.indexPhaseWithError(phase);
+    const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
+    const Vector molar_masses = rows(Reaktoro::molarMasses(system.species()), ifirst, system.numSpeciesInPhase(iphase));
     const std::string units = args.argument("units", "kg");
     const double factor = units::convert(1.0, "kg", units);
     auto func = [=]() -> double
     {
-        const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.phaseMasses().val[iphase];
+        const ChemicalState& state = quantity.state();
+        const double val = molar_masses.dot(state.speciesAmounts().segment(ifirst, molar_masses.size()));
         return factor * val;
     };
     return func;
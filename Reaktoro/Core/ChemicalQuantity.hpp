@@ -39,6 +39,11 @@ class ReactionSystem;
 /// can be calculated at a chemical state whose temperature, pressure, and
 /// mole amounts of all species are known.
 ///
+/// The chemical properties and reaction rates are only computed, once per
+/// update, when a quantity that depends on them is first evaluated. The
+/// functions returned by method @ref function resolve the names and units of
+/// a quantity once, and can be kept and evaluated after every update.
+///
 /// In the example below, the volume of a phase named Gaseous and the pH
 /// of the aqueous phase (assuming both phases were defined in the chemical
 /// system) are retrieved:
@@ -141,6 +146,11 @@ public:
     /// Update the state of this ChemicalQuantity instance.
     auto update(const ChemicalState& state, double t) -> ChemicalQuantity&;
 
+    /// Update the state of this ChemicalQuantity instance with a reference to a chemical state.
+    /// Unlike @ref update, the chemical state is not copied, and it must remain alive and
+    /// unchanged while quantities are evaluated, until the next call to update or bind.
+    auto bind(const ChemicalState& state, double t) -> ChemicalQuantity&;
+
     /// Return the value of the quantity given as a formatted string.
     auto value(std::string str) const -> double;
 
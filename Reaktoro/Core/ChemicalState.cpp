@@ -227,8 +227,7 @@ struct ChemicalState::Impl
             "The given volume is negative.");
         Assert(index < system.numPhases(), "Cannot set the volume of the phase.",
             "The given phase index is out of range.");
-        ChemicalProperties properties = system.properties(T, P, n);
-        const Vector v = properties.phaseVolumes().val;
+        const Vector v = properties(false).phaseVolumes().val;
         const double scalar = (v[index] != 0.0) ? volume/v[index] : 0.0;
         scaleSpeciesAmountsInPhase(index, scalar);
     }
@@ -253,7 +252,7 @@ struct ChemicalState::Impl
 
     auto scaleFluidVolume(double volume) -> void
     {
-        const auto& fluid_volume = properties().fluidVolume();
+        const auto& fluid_volume = properties(false).fluidVolume();
         const auto& factor = fluid_volume.val ? volume/fluid_volume.val : 0.0;
         const auto& ifluidspecies = system.indicesFluidSpecies();
         scaleSpeciesAmounts(factor, ifluidspecies);
@@ -267,7 +266,7 @@ struct ChemicalState::Impl
 
     auto scaleSolidVolume(double volume) -> void
     {
-        const auto& solid_volume = properties().solidVolume();
+        const auto& solid_volume = properties(false).solidVolume();
         const auto& factor = solid_volume.val ? volume/solid_volume.val : 0.0;
         const auto& isolidspecies = system.indicesSolidSpecies();
         scaleSpeciesAmounts(factor, isolidspecies);
@@ -283,8 +282,7 @@ struct ChemicalState::Impl
     {
         Assert(volume >= 0.0, "Cannot set the volume of the chemical state.",
             "The given volume is negative.");
-        ChemicalProperties properties = system.properties(T, P, n);
-        const Vector v = properties.phaseVolumes().val;
+        const Vector v = properties(false).phaseVolumes().val;
         const double vtotal = sum(v);
         const double scalar = (vtotal != 0.0) ? volume/vtotal : 0.0;
         scaleSpeciesAmounts(scalar);
@@ -411,9 +409,9 @@ struct ChemicalState::Impl
         return units::convert(phaseAmount(name), "mol", units);
     }
 
-    auto properties() const -> ChemicalProperties
+    auto properties(bool derivatives) const -> ChemicalProperties
     {
-        ChemicalProperties res(system);
+        ChemicalProperties res(system, derivatives);
         res.update(T, P, n);
         return res;
     }
@@ -770,7 +768,12 @@ auto ChemicalState::phaseStabilityIndices() const -> Vector
 
 auto ChemicalState::properties() const -> ChemicalProperties
 {
-    return pimpl->properties();
+    return pimpl->properties(true);
+}
+
+auto ChemicalState::properties(bool derivatives) const -> ChemicalProperties
+{
+    return pimpl->properties(derivatives);
 }
 
 auto ChemicalState::output(std::ostream& out, int precision) const -> void
@@ -784,7 +787,7 @@ auto ChemicalState::output(std::ostream& out, int precision) const -> void
     const auto& n = state.speciesAmounts();
     const auto& y = state.elementDualPotentials();
     const auto& z = state.speciesDualPotentials();
-    const ChemicalProperties properties = state.properties();
+    const ChemicalProperties properties = state.properties(false);
     const Vector molar_fractions = properties.moleFractions().val;
     const Vector activity_coeffs = exp(properties.lnActivityCoefficients().val);
     const Vector activities = exp(properties.lnActivities().val);
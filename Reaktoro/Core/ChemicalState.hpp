@@ -368,6 +368,10 @@ public:
     /// Return the chemical properties of the system.
     auto properties() const -> ChemicalProperties;
 
+    /// Return the chemical properties of the system.
+    /// @param derivatives The flag that indicates if the derivatives with respect to species amounts are computed
+    auto properties(bool derivatives) const -> ChemicalProperties;
+
     /// Output the ChemicalState instance to a stream.
     auto output(std::ostream& out, int precision = 6) const -> void;
         
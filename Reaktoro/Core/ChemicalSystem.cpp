@@ -20,10 +20,14 @@
 // C++ includes
 #include <iostream>
 #include <iomanip>
+#include <map>
 #include <set>
+#include <unordered_map>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/NamingUtils.hpp>
+#include <Reaktoro/Common/PerThread.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
@@ -72,6 +76,30 @@ auto collectSpecies(const std::vector<Phase>& phases) -> std::vector<Species>
     return list;
 }
 
+/// Return the alternative names of an aqueous species, such as Ca+2 and Ca[2+] for Ca++, or CO2 and CO2@ for CO2(aq).
+auto alternativeAqueousSpeciesNames(const Species& species) -> std::vector<std::string>
+{
+    const std::string name = species.name();
+
+    if(isAlternativeWaterName(name))
+        return alternativeWaterNames();
+
+    if(species.charge() == 0.0)
+        return alternativeNeutralSpeciesNames(name);
+
+    // Skip the charged species whose names do not follow the conventions Ca++, Ca+2, or Ca[2+]
+    if(name.find_first_of("-+[") == std::string::npos)
+        return {};
+    try
+    {
+        if(chargeInSpeciesName(name) == species.charge())
+            return alternativeChargedSpeciesNames(name);
+    }
+    catch(...) {}
+
+    return {};
+}
+
 } // namespace
 
 struct ChemicalSystem::Impl
@@ -91,15 +119,31 @@ struct ChemicalSystem::Impl
     /// The chemical model of the system
     ChemicalModel chemical_model;
 
+    /// The copies of the chemical model of the system owned by each thread that evaluates it
+    PerThread<ChemicalModel> chemical_model_copies;
+
     /// The formula matrix of the system
     Matrix formula_matrix;
 
+    /// The indices of the elements in the system keyed by their names
+    std::unordered_map<std::string, Index> element_indices;
+
+    /// The indices of the species in the system keyed by their names
+    std::unordered_map<std::string, Index> species_indices;
+
+    /// The indices of the aqueous species keyed by their unambiguous alternative names
+    std::unordered_map<std::string, Index> species_alternative_indices;
+
+    /// The indices of the phases in the system keyed by their names
+    std::unordered_map<std::string, Index> phase_indices;
+
     Impl()
     {}
 
     Impl(const std::vector<Phase>& phaselist)
     {
         initializePhasesSpeciesElements(phaselist);
+        initializeNameIndices();
         initializeFormulaMatrix();
         initializeThermoModel();
         initializeChemicalModel();
@@ -108,9 +152,10 @@ struct ChemicalSystem::Impl
     Impl(const std::vector<Phase>& phaselist, const ThermoModel& tm, const ChemicalModel& cm)
     {
         initializePhasesSpeciesElements(phaselist);
+        initializeNameIndices();
         initializeFormulaMatrix();
         thermo_model = tm;
-        chemical_model = cm;
+        initializeChemicalModel(cm);
     }
 
     auto initializePhasesSpeciesElements(const std::vector<Phase>& phaselist) -> void
@@ -120,14 +165,56 @@ struct ChemicalSystem::Impl
         elements = collectElements(species);
     }
 
+    auto initializeNameIndices() -> void
+    {
+        // The first entry with a given name is kept, as in a linear search
+        for(Index i = 0; i < elements.size(); ++i)
+            element_indices.emplace(elements[i].name(), i);
+        for(Index i = 0; i < species.size(); ++i)
+            species_indices.emplace(species[i].name(), i);
+        for(Index i = 0; i < phases.size(); ++i)
+            phase_indices.emplace(phases[i].name(), i);
+
+        // Collect the alternative names of the aqueous species, discarding those shared by
+        // different species and those that are already the names of species in the system
+        std::set<std::string> ambiguous;
+        Index offset = 0;
+        for(const Phase& phase : phases)
+        {
+            if(phase.name() == "Aqueous")
+            {
+                for(Index i = 0; i < phase.numSpecies(); ++i)
+                {
+                    for(const std::string& alternative : alternativeAqueousSpeciesNames(phase.species(i)))
+                    {
+                        if(species_indices.count(alternative))
+                            continue;
+                        auto res = species_alternative_indices.emplace(alternative, offset + i);
+                        if(!res.second && res.first->second != offset + i)
+                            ambiguous.insert(alternative);
+                    }
+                }
+            }
+            offset += phase.numSpecies();
+        }
+        for(const std::string& alternative : ambiguous)
+            species_alternative_indices.erase(alternative);
+    }
+
     auto initializeFormulaMatrix() -> void
     {
         const auto num_elements = elements.size();
         const auto num_species = species.size();
-        formula_matrix.resize(num_elements, num_species);
+
+        // The indices of the elements, so that each species only visits its own elements
+        std::map<std::string, Index> element_indices;
+        for(unsigned j = 0; j < num_elements; ++j)
+            element_indices.emplace(elements[j].name(), j);
+
+        formula_matrix = zeros(num_elements, num_species);
         for(unsigned i = 0; i < num_species; ++i)
-            for(unsigned j = 0; j < num_elements; ++j)
-                formula_matrix(j, i) = species[i].elementCoefficient(elements[j].name());
+            for(const auto& pair : species[i].elements())
+                formula_matrix(element_indices.at(pair.first.name()), i) = pair.second;
     }
 
     auto initializeThermoModel() -> void
@@ -148,19 +235,42 @@ struct ChemicalSystem::Impl
 
     auto initializeChemicalModel() -> void
     {
-        chemical_model = [&](ChemicalModelResult& res, double T, double P, VectorConstRef n)
+        // The chemical models of the phases, captured by value below so that each
+        // copy of the chemical model of the system owns its own scratch data
+        std::vector<PhaseChemicalModel> phase_models;
+        std::vector<Index> sizes;
+        for(const Phase& phase : phases)
         {
-            const Index num_phases = phases.size();
+            phase_models.push_back(phase.chemicalModel());
+            sizes.push_back(phase.numSpecies());
+        }
+
+        ChemicalModel model = [=](ChemicalModelResult& res, double T, double P, VectorConstRef n) mutable
+        {
+            const Index num_phases = phase_models.size();
             Index offset = 0;
             for(Index iphase = 0; iphase < num_phases; ++iphase)
             {
-                const Index size = phases[iphase].numSpecies();
+                const Index size = sizes[iphase];
                 const auto np = n.segment(offset, size);
                 auto cp = res.phaseProperties(iphase, offset, size);
-                phases[iphase].properties(cp, T, P, np);
+                phase_models[iphase](cp, T, P, np);
                 offset += size;
             }
         };
+
+        initializeChemicalModel(model);
+    }
+
+    auto initializeChemicalModel(const ChemicalModel& model) -> void
+    {
+        // Evaluate the chemical model on the copy owned by the calling thread, so
+        // that many threads can evaluate it concurrently
+        chemical_model_copies = PerThread<ChemicalModel>(model);
+        chemical_model = [&](ChemicalModelResult& res, double T, double P, VectorConstRef n)
+        {
+            chemical_model_copies.local()(res, T, P, n);
+        };
     }
 };
 
@@ -264,7 +374,8 @@ auto ChemicalSystem::formulaMatrix() const -> MatrixConstRef
 
 auto ChemicalSystem::indexElement(std::string name) const -> Index
 {
-    return index(name, elements());
+    const auto iter = pimpl->element_indices.find(name);
+    return iter != pimpl->element_indices.end() ? iter->second : numElements();
 }
 
 auto ChemicalSystem::indexElementWithError(std::string name) const -> Index
@@ -280,7 +391,8 @@ auto ChemicalSystem::indexElementWithError(std::string name) const -> Index
 
 auto ChemicalSystem::indexSpecies(std::string name) const -> Index
 {
-    return index(name, species());
+    const auto iter = pimpl->species_indices.find(name);
+    return iter != pimpl->species_indices.end() ? iter->second : numSpecies();
 }
 
 auto ChemicalSystem::indexSpeciesWithError(std::string name) const -> Index
@@ -294,7 +406,13 @@ auto ChemicalSystem::indexSpeciesWithError(std::string name) const -> Index
 
 auto ChemicalSystem::indexSpeciesAny(const std::vector<std::string>& names) const -> Index
 {
-    return indexAny(names, species());
+    for(const std::string& name : names)
+    {
+        const auto iter = pimpl->species_indices.find(name);
+        if(iter != pimpl->species_indices.end())
+            return iter->second;
+    }
+    return numSpecies();
 }
 
 auto ChemicalSystem::indexSpeciesAnyWithError(const std::vector<std::string>& names) const -> Index
@@ -307,9 +425,28 @@ auto ChemicalSystem::indexSpeciesAnyWithError(const std::vector<std::string>& na
     return index;
 }
 
+auto ChemicalSystem::indexSpeciesAlternative(std::string name) const -> Index
+{
+    const Index index = indexSpecies(name);
+    if(index < numSpecies())
+        return index;
+    const auto iter = pimpl->species_alternative_indices.find(name);
+    return iter != pimpl->species_alternative_indices.end() ? iter->second : numSpecies();
+}
+
+auto ChemicalSystem::indexSpeciesAlternativeWithError(std::string name) const -> Index
+{
+    const Index index = indexSpeciesAlternative(name);
+    Assert(index < numSpecies(),
+        "Could not get the index of species `" + name + "`.",
+        "There is no species in the system with this name or alternative name.");
+    return index;
+}
+
 auto ChemicalSystem::indexPhase(std::string name) const -> Index
 {
-    return index(name, phases());
+    const auto iter = pimpl->phase_indices.find(name);
+    return iter != pimpl->phase_indices.end() ? iter->second : numPhases();
 }
 
 auto ChemicalSystem::indexPhaseWithError(std::string name) const -> Index
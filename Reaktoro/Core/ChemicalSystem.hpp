@@ -32,6 +32,11 @@ class ChemicalProperties;
 class ThermoProperties;
 
 /// A class to represent a system and its attributes and properties.
+/// A ChemicalSystem instance is immutable after construction and its copies share the
+/// same underlying data, so that many solvers can hold the same system without copying it.
+/// The system can also be used by many threads concurrently: its chemical model is evaluated
+/// on copies of the chemical models of the phases owned by each thread, since these may keep
+/// scratch data between calls. The thermodynamic models of the phases are shared by all threads.
 /// @see Species, Phase
 /// @ingroup Core
 class ChemicalSystem
@@ -115,8 +120,11 @@ public:
     /// @param name The name of the element
     auto indexElementWithError(std::string name) const -> Index;
 
-    /// Return the index of a species in the system
+    /// Return the index of a species in the system.
+    /// The lookup takes constant time, but the indices of the species
+    /// used in a loop can be obtained once with @ref indicesSpecies.
     /// @param name The name of the species
+    /// @return The index of the species if found, or the number of species otherwise.
     auto indexSpecies(std::string name) const -> Index;
 
     /// Return the index of a species in the system.
@@ -134,6 +142,21 @@ public:
     /// @return The index of the species if found, or a runtime exception otherwise.
     auto indexSpeciesAnyWithError(const std::vector<std::string>& names) const -> Index;
 
+    /// Return the index of a species in the system by its name or, if it is an aqueous species, by an alternative name.
+    /// The alternative names follow the conventions Ca++, Ca+2, Ca[2+] for charged species,
+    /// CO2(aq), CO2, CO2@ for neutral species, and H2O(l), H2O, H2O@ for water. The name of a
+    /// species takes precedence over the alternative names of the other species, and the
+    /// alternative names shared by more than one aqueous species are not recognized.
+    /// @param name The name or the alternative name of the species
+    /// @return The index of the species if found, or the number of species otherwise.
+    auto indexSpeciesAlternative(std::string name) const -> Index;
+
+    /// Return the index of a species in the system by its name or, if it is an aqueous species, by an alternative name.
+    /// @param name The name or the alternative name of the species
+    /// @return The index of the species if found, or a runtime exception otherwise.
+    /// @see indexSpeciesAlternative
+    auto indexSpeciesAlternativeWithError(std::string name) const -> Index;
+
     /// Return the index of a phase in the system
     /// @param name The name of the phase
     auto indexPhase(std::string name) const -> Index;
@@ -67,6 +67,9 @@ struct Reaction::Impl
     /// The function for the kinetic rate of the reaction (in units of mol/s)
     ReactionRateFunction rate;
 
+    /// The function for the kinetic rate of the reaction written into a given result, if set
+    ReactionRateRefFunction rate_ref;
+
     Impl()
     {}
 
@@ -122,6 +125,19 @@ auto Reaction::setEquilibriumConstant(const ThermoScalarFunction& lnk) -> void
 auto Reaction::setRate(const ReactionRateFunction& function) -> void
 {
     pimpl->rate = function;
+    pimpl->rate_ref = {};
+}
+
+auto Reaction::setRate(const ReactionRateRefFunction& function) -> void
+{
+    const Index num_species = pimpl->system.numSpecies();
+    pimpl->rate = [=](const ChemicalProperties& properties)
+    {
+        ChemicalScalar res(num_species);
+        function(properties, res);
+        return res;
+    };
+    pimpl->rate_ref = function;
 }
 
 auto Reaction::name() const -> std::string
@@ -179,7 +195,7 @@ auto Reaction::lnEquilibriumConstant(const ChemicalProperties& properties) const
     if(pimpl->lnk) return pimpl->lnk(T, P);
 
     // Calculate the equilibrium constant using the standard Gibbs energies of the species
-    const ThermoVector G0 = properties.standardPartialMolarGibbsEnergies();
+    const ThermoVectorConstRef G0 = properties.standardPartialMolarGibbsEnergies();
     const ThermoScalar RT = universalGasConstant * Temperature(T);
 
     ThermoScalar res;
@@ -222,6 +238,14 @@ auto Reaction::rate(const ChemicalProperties& properties) const -> ChemicalScala
     return pimpl->rate(properties);
 }
 
+auto Reaction::rate(const ChemicalProperties& properties, ChemicalScalarRef res) const -> void
+{
+    if(pimpl->rate_ref)
+        pimpl->rate_ref(properties, res);
+    else
+        res = rate(properties);
+}
+
 auto operator<(const Reaction& lhs, const Reaction& rhs) -> bool
 {
     return lhs.name() < rhs.name();
@@ -24,6 +24,7 @@
 #include <vector>
 
 // Reaktoro includes
+#include <Reaktoro/Common/ChemicalScalar.hpp>
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Common/ReactionEquation.hpp>
@@ -43,6 +44,13 @@ class ChemicalProperties;
 /// @ingroup Core
 using ReactionRateFunction = std::function<ChemicalScalar(const ChemicalProperties&)>;
 
+/// The function signature of the rate of a reaction (in units of mol/s) written into a given result.
+/// @param properties The thermodynamic properties of the chemical system at (*T*, *P*, **n**)
+/// @param res The rate of the reaction and its partial derivatives (in units of mol/s)
+/// @see Reaction
+/// @ingroup Core
+using ReactionRateRefFunction = std::function<void(const ChemicalProperties&, ChemicalScalarRef)>;
+
 /// The function signature of the rates of a collection of reactions (in units of mol/s).
 /// @param properties The thermodynamic properties of the chemical system at (*T*, *P*, **n**)
 /// @see Reaction
@@ -83,6 +91,10 @@ public:
     /// Set the rate function of the reaction (in units of mol/s).
     auto setRate(const ReactionRateFunction& function) -> void;
 
+    /// Set the rate function of the reaction (in units of mol/s) that writes into a given result.
+    /// This avoids the allocation of a ChemicalScalar instance in every evaluation of the rate.
+    auto setRate(const ReactionRateRefFunction& function) -> void;
+
     /// Return the name of the reaction.
     auto name() const -> std::string;
 
@@ -135,6 +147,11 @@ public:
     /// @param properties The thermodynamic properties of the chemical system at (*T*, *P*, **n**)
     auto rate(const ChemicalProperties& properties) const -> ChemicalScalar;
 
+    /// Calculate the rate of the reaction (in units of mol/s) into a given result.
+    /// @param properties The thermodynamic properties of the chemical system at (*T*, *P*, **n**)
+    /// @param res The rate of the reaction and its partial derivatives (in units of mol/s)
+    auto rate(const ChemicalProperties& properties, ChemicalScalarRef res) const -> void;
+
 private:
     struct Impl;
 
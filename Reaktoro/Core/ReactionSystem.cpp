@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/PerThread.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
@@ -52,13 +53,16 @@ struct ReactionSystem::Impl
     /// The stoichiometric matrix of the reactions w.r.t. to all species in the system
     Matrix stoichiometric_matrix;
 
+    /// The copies of the reactions owned by each thread that evaluates their rates
+    PerThread<std::vector<Reaction>> reactions_copies;
+
     /// Construct a defaut ReactionSystem::Impl instance
     Impl()
     {}
 
     /// Construct a ReactionSystem::Impl instance with given reactions
     Impl(const ChemicalSystem& system, const std::vector<Reaction>& reactions)
-    : system(system), reactions(reactions)
+    : system(system), reactions(reactions), reactions_copies(reactions)
     {
         // Initialize the stoichiometric matrix of the reactions
         stoichiometric_matrix = Reaktoro::stoichiometricMatrix(system, reactions);
@@ -152,13 +156,24 @@ auto ReactionSystem::lnReactionQuotients(const ChemicalProperties& properties) c
 }
 
 auto ReactionSystem::rates(const ChemicalProperties& properties) const -> ChemicalVector
+{
+    ChemicalVector res(numReactions(), system().numSpecies());
+    rates(properties, res);
+    return res;
+}
+
+auto ReactionSystem::rates(const ChemicalProperties& properties, ChemicalVector& res) const -> void
 {
     const unsigned num_reactions = numReactions();
     const unsigned num_species = system().numSpecies();
-    ChemicalVector res(num_reactions, num_species);
+    if(res.val.rows() != num_reactions || res.ddn.cols() != num_species)
+        res.resize(num_reactions, num_species);
+    const auto& reactions = pimpl->reactions_copies.local();
     for(unsigned i = 0; i < num_reactions; ++i)
-        res[i] = reaction(i).rate(properties);
-    return res;
+    {
+        auto row = res[i];
+        reactions[i].rate(properties, row);
+    }
 }
 
 } // namespace Reaktoro
@@ -35,7 +35,8 @@ class Reaction;
 /// A class that represents a system of chemical reactions.
 /// The ReactionSystem class is a collection of Reaction instances. It provides
 /// convenient methods that calculates the equilibrium constants, reaction quotients,
-/// and rates of the reactions.
+/// and rates of the reactions. Similarly to ChemicalSystem, its copies share the same
+/// underlying data, and the rates are evaluated on copies of the reactions owned by each thread.
 /// @see Reaction, ChemicalSystem, ChemicalSystem
 /// @ingroup Core
 class ReactionSystem
@@ -89,6 +90,11 @@ public:
     /// @param properties The thermodynamic properties of the system
     auto rates(const ChemicalProperties& properties) const -> ChemicalVector;
 
+    /// Calculate the kinetic rates of the reactions in a preallocated vector.
+    /// @param properties The thermodynamic properties of the system
+    /// @param[out] res The kinetic rates of the reactions (resized only if its dimensions differ)
+    auto rates(const ChemicalProperties& properties, ChemicalVector& res) const -> void;
+
 private:
     struct Impl;
 
@@ -50,6 +50,40 @@ struct SmartEquilibriumOptions
     double abstol = 1e-14;
 };
 
+/// The options for the batch equilibrium calculations.
+struct BatchEquilibriumOptions
+{
+    /// The number of threads used to solve a batch of equilibrium problems.
+    /// A value of zero uses as many threads as the number of hardware threads. The problems
+    /// are solved by the calling thread together with the workers of ThreadPool::shared. Note
+    /// that multi-threaded batch calculations require the thermodynamic and chemical
+    /// models of the chemical system to be safe for concurrent evaluation.
+    unsigned threads = 1;
+
+    /// The boolean flag that indicates if the problems in a batch should be reordered by similarity.
+    /// The problems are then solved in order of increasing temperature, pressure, and element
+    /// amounts, so that a problem whose chemical state is uninitialized can be warm-started
+    /// from the solution of its most similar predecessor instead of a simplex cold-start.
+    bool reorder = true;
+};
+
+/// The options for the pruning of inactive phases in equilibrium calculations.
+struct PruningEquilibriumOptions
+{
+    /// The boolean flag that indicates if stably inactive phases should be pruned from the optimisation problem.
+    /// A phase is inactive if all its equilibrium species are at their lower bounds with positive dual
+    /// potentials (e.g., an undersaturated mineral). Such phases are removed from the optimisation problem
+    /// at the start of each optimisation pass, and their stability is checked again once the reduced problem
+    /// converges. If a pruned phase turns out to be stable, the full problem is solved instead.
+    bool active = false;
+
+    /// The molar amount of a species, relative to the parameter ε, below which it is considered at its lower bound.
+    double amount = 1e6;
+
+    /// The dual potential of a species (in units of RT) above which it is considered stably inactive.
+    double potential = 1e-2;
+};
+
 /// The options for the equilibrium calculations
 struct EquilibriumOptions
 {
@@ -73,6 +107,20 @@ struct EquilibriumOptions
     /// a chemical state that works well as initial guess for all equilibrium algorithms.
     bool warmstart = true;
 
+    /// The boolean flag that indicates if the initial guess should be predicted from the last equilibrium state.
+    /// Setting this flag to true will cause an equilibrium calculation whose chemical state is the result
+    /// of the last equilibrium calculation of the solver (e.g., in equilibrium paths, kinetic paths, and
+    /// temperature or pressure ramps) to extrapolate the molar amounts of the species to the new temperature,
+    /// pressure, and amounts of elements, using the sensitivity derivatives of the last equilibrium state.
+    bool predictor = false;
+
+    /// The boolean flag that indicates if the simplex method should be used for the cold-start approximations.
+    /// Setting this flag to true will cause the linear programming problem of a cold-start approximation to
+    /// be solved with a simplex method that keeps its last optimal basis, so that subsequent cold-starts at the
+    /// same temperature and pressure but different amounts of elements (e.g., the cells of a reactive transport
+    /// calculation) are re-optimized with a few dual simplex pivots instead of a full solution.
+    bool simplex = false;
+
     /// The calculation mode of the Hessian of the Gibbs energy function
     GibbsHessian hessian = GibbsHessian::ApproximationDiagonal;
 
@@ -87,6 +135,12 @@ struct EquilibriumOptions
 
     /// The options for the smart equilibrium calculation.
     SmartEquilibriumOptions smart;
+
+    /// The options for the batch equilibrium calculation.
+    BatchEquilibriumOptions batch;
+
+    /// The options for the pruning of inactive phases in the equilibrium calculation.
+    PruningEquilibriumOptions pruning;
 };
 
 } // namespace Reaktoro
@@ -183,8 +183,9 @@ struct EquilibriumPath::Impl
             ode.integrate(t, ne);
         }
 
-        // Update the output with the final state
+        // Update the output with the final state and write the output file
         if(output) output.update(state_f, 1.0);
+        if(output) output.close();
 
         // Update the plots with the final state
         for(auto& plot : plots) plot.update(state_f, 1.0);
@@ -40,7 +40,8 @@ class Partition;
 struct EquilibriumPathOptions
 {
     /// The options for the chemical equilibrium calculations.
-    EquilibriumOptions equilibrium;
+    /// Consecutive equilibrium states along the path are close, so their initial guesses are predicted by default.
+    EquilibriumOptions equilibrium = []{ EquilibriumOptions options; options.predictor = true; return options; }();
 
     /// The options for the ODE solver
     ODEOptions ode;
@@ -17,11 +17,18 @@
 
 #include "EquilibriumResult.hpp"
 
+// C++ includes
+#include <algorithm>
+
 namespace Reaktoro {
 
 auto EquilibriumResult::operator+=(const EquilibriumResult& other) -> EquilibriumResult&
 {
     optimum += other.optimum;
+    predictor.predictions += other.predictor.predictions;
+    predictor.iterations_saved += other.predictor.iterations_saved;
+    pruning.passes += other.pruning.passes;
+    pruning.species = std::max(pruning.species, other.pruning.species);
     return *this;
 }
 
@@ -29,6 +29,28 @@ struct SmartEquilibriumResult
     bool succeeded = false;
 };
 
+/// A type used to describe the result of the prediction of equilibrium initial guesses.
+struct EquilibriumPredictorResult
+{
+    /// The number of equilibrium calculations whose initial guess was predicted from the last equilibrium state.
+    unsigned predictions = 0;
+
+    /// The number of iterations saved by the predicted initial guesses.
+    /// The savings are measured with respect to the number of iterations of the last equilibrium
+    /// calculation performed without prediction, and are negative if more iterations were needed.
+    int iterations_saved = 0;
+};
+
+/// A type used to describe the result of the pruning of inactive phases in equilibrium calculations.
+struct EquilibriumPruningResult
+{
+    /// The number of optimisation passes performed without the equilibrium species in the pruned phases.
+    unsigned passes = 0;
+
+    /// The largest number of equilibrium species pruned in an optimisation pass.
+    unsigned species = 0;
+};
+
 /// A type used to describe the result of an equilibrium calculation
 /// @see ChemicalState
 struct EquilibriumResult
@@ -39,6 +61,12 @@ struct EquilibriumResult
     /// The boolean flag that indicates if smart equilibrium calculation was used.
     SmartEquilibriumResult smart;
 
+    /// The result of the prediction of the initial guess from the last equilibrium state.
+    EquilibriumPredictorResult predictor;
+
+    /// The result of the pruning of inactive phases from the optimisation passes.
+    EquilibriumPruningResult pruning;
+
     /// Apply an addition assignment to this instance
     auto operator+=(const EquilibriumResult& other) -> EquilibriumResult&;
 };
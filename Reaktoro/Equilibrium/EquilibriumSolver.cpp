@@ -17,11 +17,16 @@
 
 #include "EquilibriumSolver.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <numeric>
+
 // Reaktoro includes
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -38,6 +43,7 @@
 #include <Reaktoro/Optimization/OptimumResult.hpp>
 #include <Reaktoro/Optimization/OptimumSolver.hpp>
 #include <Reaktoro/Optimization/OptimumSolverRefiner.hpp>
+#include <Reaktoro/Optimization/OptimumSolverSimplex.hpp>
 #include <Reaktoro/Optimization/OptimumState.hpp>
 
 namespace Reaktoro {
@@ -56,6 +62,9 @@ struct EquilibriumSolver::Impl
     /// The solver for the optimisation calculations
     OptimumSolver solver;
 
+    /// The simplex solver for the cold-start approximations, which keeps its last optimal basis
+    OptimumSolverSimplex simplex;
+
     /// The chemical properties of the chemical system
     ChemicalProperties properties;
 
@@ -125,6 +134,45 @@ struct EquilibriumSolver::Impl
     /// The formula matrix of the inert species
     Matrix Ai;
 
+    /// The temperature of the last successful equilibrium calculation (in units of K)
+    double Tlast = 0.0;
+
+    /// The pressure of the last successful equilibrium calculation (in units of Pa)
+    double Plast = 0.0;
+
+    /// The molar amounts of the elements in the equilibrium partition at the last successful equilibrium calculation
+    Vector belast;
+
+    /// The molar amounts of the equilibrium species at the last successful equilibrium calculation
+    Vector nelast;
+
+    /// The boolean flag that indicates if the last equilibrium calculation can be used for prediction
+    bool predictable = false;
+
+    /// The boolean flag that indicates if the sensitivities correspond to the last equilibrium calculation
+    bool sensitive = false;
+
+    /// The number of iterations of the last equilibrium calculation performed without prediction
+    unsigned unpredicted_iterations = 0;
+
+    /// The local indices of the equilibrium species in each phase of the chemical system
+    std::vector<Indices> iphases;
+
+    /// The local indices of the equilibrium species that remain in the optimisation problem after pruning
+    Indices iactive;
+
+    /// The local indices of the equilibrium species in the pruned phases
+    Indices ipruned;
+
+    /// The optimisation problem without the equilibrium species in the pruned phases
+    OptimumProblem pruned_problem;
+
+    /// The state of the optimisation calculation without the equilibrium species in the pruned phases
+    OptimumState pruned_state;
+
+    /// The boolean flag that indicates if the last optimisation calculation was performed with pruned phases
+    bool pruned = false;
+
     /// Construct a default Impl instance
     Impl()
     {}
@@ -150,6 +198,9 @@ struct EquilibriumSolver::Impl
         // Set the partition of the chemical system
         partition = partition_;
 
+        // The last equilibrium state can no longer be used for prediction
+        predictable = false;
+
         // Initialize the number of species and elements in the equilibrium partition
         Ne = partition.numEquilibriumSpecies();
         Ee = partition.numEquilibriumElements();
@@ -169,6 +220,21 @@ struct EquilibriumSolver::Impl
 
         // Initialize the formula matrix of the inert species
         Ai = cols(A, iis);
+
+        // Initialize the local indices of the equilibrium species in each phase
+        iphases.assign(system.numPhases(), Indices());
+        for(Index j = 0; j < Ne; ++j)
+            iphases[system.indexPhaseWithSpecies(ies[j])].push_back(j);
+    }
+
+    /// Set the options of the equilibrium solver
+    auto setOptions(const EquilibriumOptions& options_) -> void
+    {
+        // Set the options of the equilibrium solver
+        options = options_;
+
+        // The optimisation method may have changed, and so the last equilibrium state can no longer be used for prediction
+        predictable = false;
     }
 
     /// Update the OptimumOptions instance with given EquilibriumOptions instance
@@ -302,6 +368,123 @@ struct EquilibriumSolver::Impl
         optimum_state.z = z(ies);
     }
 
+    /// Determine the equilibrium species in the phases that are stably inactive in the current optimum state
+    auto prune() -> bool
+    {
+        // Auxiliary references to the molar amounts and dual potentials of the equilibrium species
+        const auto& x = optimum_state.x;
+        const auto& z = optimum_state.z;
+
+        // The thresholds of molar amount and dual potential for a species to be stably inactive
+        const double xmax = options.pruning.amount * options.epsilon;
+        const double zmin = options.pruning.potential;
+
+        iactive.clear();
+        ipruned.clear();
+
+        // Prune the phases whose equilibrium species are all at their lower bounds with positive dual potentials
+        for(const Indices& iphase : iphases)
+        {
+            const bool inactive = std::all_of(iphase.begin(), iphase.end(),
+                [&](Index j) { return x[j] <= xmax && z[j] >= zmin; });
+            Indices& indices = inactive ? ipruned : iactive;
+            indices.insert(indices.end(), iphase.begin(), iphase.end());
+        }
+
+        // Do not prune any phase if an element would no longer be present in the remaining species
+        if(!ipruned.empty() && (cols(Ae, iactive).cwiseAbs().rowwise().sum().array() == 0.0).any())
+            ipruned.clear();
+
+        return !ipruned.empty();
+    }
+
+    /// Update the optimisation problem and state without the equilibrium species in the pruned phases
+    auto updatePrunedOptimum() -> void
+    {
+        // The molar amounts of the equilibrium species, with those in the pruned phases kept constant
+        Vector ne = optimum_state.x;
+
+        // The molar amounts of the equilibrium species in the pruned phases
+        const Vector xp = ne(ipruned);
+
+        // The Gibbs energy function of all equilibrium species
+        const ObjectiveFunction objective = optimum_problem.objective;
+
+        // The local indices of the equilibrium species that remain in the optimisation problem
+        const Indices iactive = this->iactive;
+
+        // The result of the objective evaluation
+        ObjectiveResult res;
+
+        // The Gibbs energy function to be minimized with respect to the remaining equilibrium species
+        pruned_problem.objective = [=](VectorConstRef na) mutable
+        {
+            // Set the molar amounts of the remaining equilibrium species
+            ne(iactive) = na;
+
+            // Evaluate the Gibbs energy function of all equilibrium species
+            const ObjectiveResult& full = objective(ne);
+
+            // Set the objective result restricted to the remaining equilibrium species
+            res.val = full.val;
+            res.grad = full.grad(iactive);
+            res.hessian.mode = full.hessian.mode;
+            if(full.hessian.mode == Hessian::Dense)
+                res.hessian.dense = submatrix(full.hessian.dense, iactive, iactive);
+            else res.hessian.diagonal = full.hessian.diagonal(iactive);
+
+            return res;
+        };
+
+        pruned_problem.c.resize(0);
+        pruned_problem.n = iactive.size();
+        pruned_problem.A = cols(Ae, iactive);
+        pruned_problem.b = be - cols(Ae, ipruned) * xp;
+        pruned_problem.l = optimum_problem.l(iactive);
+
+        pruned_state.x = optimum_state.x(iactive);
+        pruned_state.y = optimum_state.y;
+        pruned_state.z = optimum_state.z(iactive);
+    }
+
+    /// Update the optimum state from that without the equilibrium species in the pruned phases
+    /// @return True if the pruned phases remain unstable, false otherwise
+    auto updateOptimumStateFromPruned() -> bool
+    {
+        // Update the molar amounts and dual potentials of the remaining equilibrium species
+        optimum_state.x(iactive) = pruned_state.x;
+        optimum_state.y = pruned_state.y;
+        optimum_state.z(iactive) = pruned_state.z;
+
+        // Evaluate the Gibbs energy function of all equilibrium species at the updated molar amounts
+        const ObjectiveResult& res = optimum_problem.objective(optimum_state.x);
+
+        // The molar amounts of the equilibrium species in the pruned phases
+        const Vector xp = optimum_state.x(ipruned);
+
+        // Compute the dual potentials of the equilibrium species in the pruned phases
+        const Vector zp = res.grad(ipruned) - tr(cols(Ae, ipruned)) * optimum_state.y;
+
+        // Update the dual potentials of the pruned species, ensuring they are positive for the interior-point methods
+        optimum_state.z(ipruned) = zp.cwiseMax(options.epsilon * inv(xp));
+
+        // Return true if all pruned species have non-negative dual potentials
+        return zp.minCoeff() >= 0.0;
+    }
+
+    /// Return the sensitivity of the molar amounts of the equilibrium species computed with the last optimisation calculation
+    auto dxdp(VectorConstRef dgdp, VectorConstRef dbdp) -> Vector
+    {
+        // Check if the last optimisation calculation was performed with all equilibrium species
+        if(!pruned)
+            return solver.dxdp(dgdp, dbdp);
+
+        // The molar amounts of the equilibrium species in the pruned phases remain at their lower bounds
+        Vector res = zeros(Ne);
+        res(iactive) = solver.dxdp(dgdp(iactive), dbdp);
+        return res;
+    }
+
     /// Initialize the chemical state from a optimum state
     auto updateChemicalState(ChemicalState& state) -> void
     {
@@ -389,11 +572,20 @@ struct EquilibriumSolver::Impl
         // Update the optimum options
         updateOptimumOptions();
 
-        // Set the method for the optimisation calculation
-        solver.setMethod(options.method);
+        // Solve the linear programming problem with the simplex solver, re-optimizing from its last optimal basis if possible
+        if(options.simplex)
+            result.optimum = simplex.solve(optimum_problem, optimum_state, optimum_options);
+        else
+        {
+            // Set the method for the optimisation calculation
+            solver.setMethod(options.method);
+
+            // Solve the linear programming problem
+            result.optimum = solver.solve(optimum_problem, optimum_state, optimum_options);
+        }
 
-        // Solve the linear programming problem
-        result.optimum = solver.solve(optimum_problem, optimum_state, optimum_options);
+        // The optimisation solver no longer holds the last equilibrium state, which can no longer be used for prediction
+        predictable = false;
 
         // Update the molar amounts of the equilibrium species
         n(ies) = optimum_state.x;
@@ -446,6 +638,46 @@ struct EquilibriumSolver::Impl
         return zero || !options.warmstart;
     }
 
+    /// Return true if the initial guess of an equilibrium calculation can be predicted from the last equilibrium state.
+    auto predictable_from_last(const ChemicalState& state) -> bool
+    {
+        if(!options.predictor || !predictable)
+            return false;
+
+        // Check if the chemical state is the result of the last equilibrium calculation
+        const auto& ns = state.speciesAmounts();
+        for(Index i = 0; i < Ne; ++i)
+            if(ns[ies[i]] != nelast[i])
+                return false;
+        return true;
+    }
+
+    /// Extrapolate the molar amounts of the equilibrium species from the last equilibrium state.
+    auto predict(ChemicalState& state, double T, double P) -> void
+    {
+        // Compute the sensitivities of the last equilibrium state, if not yet computed
+        if(!sensitive)
+            sensitivity();
+
+        // The first-order prediction of the change in the molar amounts of the equilibrium species
+        const Vector dne = sensitivities.dndT * (T - Tlast) +
+                           sensitivities.dndP * (P - Plast) +
+                           sensitivities.dndb * (be - belast);
+
+        // Prevent the predicted amounts from decreasing below a fraction of the last amounts
+        const Vector ne = (nelast + dne).cwiseMax(0.1 * nelast);
+
+        // Scale the dual potentials of the equilibrium species to preserve their complementarity with the amounts
+        z = state.speciesDualPotentials();
+        z(ies) = z(ies).cwiseProduct(nelast).cwiseQuotient(ne);
+
+        // Update the chemical state with the predicted amounts and dual potentials of the species
+        n = state.speciesAmounts();
+        n(ies) = ne;
+        state.setSpeciesAmounts(n);
+        state.setSpeciesDualPotentials(z);
+    }
+
     /// Solve the equilibrium problem, passing all elements that has on chemical system
     auto solve_with_all_element_amounts(ChemicalState& state, double T, double P, VectorConstRef b) -> EquilibriumResult
     {
@@ -475,12 +707,20 @@ struct EquilibriumSolver::Impl
         state.setTemperature(T);
         state.setPressure(P);
 
+        // The result of the equilibrium calculation
+        EquilibriumResult result;
+
         // Check if a simplex cold-start approximation must be performed
-        if(coldstart(state))
+        const bool cold = coldstart(state);
+        if(cold)
             initialguess(state, T, P, be);
 
-        // The result of the equilibrium calculation
-        EquilibriumResult result;
+        // Otherwise, check if the initial guess can be predicted from the last equilibrium state
+        else if(predictable_from_last(state))
+        {
+            predict(state, T, P);
+            result.predictor.predictions = 1;
+        }
 
         // Update the optimum options
         updateOptimumOptions();
@@ -497,12 +737,35 @@ struct EquilibriumSolver::Impl
         // Set the maximum number of iterations in each optimization pass
         optimum_options.max_iterations = 10;
 
+        // The boolean flag that indicates if stably inactive phases can still be pruned in this calculation
+        bool pruning = options.pruning.active;
+
         // Start the several opmization passes (stop if convergence attained)
         auto counter = 0;
         while(counter < options.optimum.max_iterations)
         {
+            // Check if stably inactive phases can be pruned (not in the first pass after a simplex cold-start)
+            pruned = pruning && (counter || !cold) && prune();
+
+            // Solve the optimisation problem without the pruned phases
+            if(pruned)
+            {
+                updatePrunedOptimum();
+
+                result.optimum += solver.solve(pruned_problem, pruned_state, optimum_options);
+                result.pruning.passes += 1;
+                result.pruning.species = std::max<unsigned>(result.pruning.species, ipruned.size());
+
+                // Solve the optimisation problem with all species in the next passes if a pruned phase became stable
+                if(!updateOptimumStateFromPruned())
+                {
+                    result.optimum.succeeded = false;
+                    pruning = false;
+                }
+            }
+
             // Solve the optimisation problem
-            result.optimum += solver.solve(optimum_problem, optimum_state, optimum_options);
+            else result.optimum += solver.solve(optimum_problem, optimum_state, optimum_options);
 
             // Exit this loop if last solve succeeded
             if(result.optimum.succeeded)
@@ -514,9 +777,129 @@ struct EquilibriumSolver::Impl
         // Update the chemical state from the optimum state
         updateChemicalState(state);
 
+        // Compare the number of iterations with that of the last calculation performed without prediction
+        if(result.predictor.predictions)
+            result.predictor.iterations_saved = int(unpredicted_iterations) - int(result.optimum.iterations);
+        else unpredicted_iterations = result.optimum.iterations;
+
+        // Store the last equilibrium state for the prediction of the next initial guess
+        predictable = options.predictor && result.optimum.succeeded;
+        sensitive = false;
+        if(predictable)
+        {
+            Tlast = T;
+            Plast = P;
+            belast = be;
+            nelast = optimum_state.x;
+        }
+
         return result;
     }
 
+    /// Return the order in which the problems of a batch should be solved
+    auto batchOrder(VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> Indices
+    {
+        Indices order(T.size());
+        std::iota(order.begin(), order.end(), 0);
+
+        if(!options.batch.reorder)
+            return order;
+
+        // Sort the problems lexicographically in temperature, pressure, and element amounts
+        auto less = [&](Index i, Index j)
+        {
+            if(T[i] != T[j]) return T[i] < T[j];
+            if(P[i] != P[j]) return P[i] < P[j];
+            for(Index k = 0; k < Ee; ++k)
+                if(be(i, k) != be(j, k))
+                    return be(i, k) < be(j, k);
+            return i < j;
+        };
+
+        std::sort(order.begin(), order.end(), less);
+
+        return order;
+    }
+
+    /// Solve the problems of a batch with indices in the range [begin, end) of a given order
+    auto solveBatchRange(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef be,
+        const Indices& order, Index begin, Index end, std::vector<EquilibriumResult>& results) -> void
+    {
+        // The molar amounts of the elements of the current problem
+        Vector bi;
+
+        // The index of the last successfully solved problem in this range
+        Index ilast = states.size();
+
+        for(Index k = begin; k < end; ++k)
+        {
+            const Index i = order[k];
+
+            ChemicalState& state = states[i];
+
+            bi = tr(be.row(i));
+
+            // Warm-start an uninitialized state from the last solution, scaled by the amounts of elements
+            if(options.warmstart && ilast < states.size() && coldstart(state))
+            {
+                const ChemicalState& last = states[ilast];
+
+                const double blast = be.row(ilast).lpNorm<1>();
+                const double scale = blast > 0.0 ? bi.lpNorm<1>()/blast : 1.0;
+
+                n = state.speciesAmounts();
+                n(ies) = scale * last.speciesAmounts()(ies);
+
+                state.setSpeciesAmounts(n);
+                state.setElementDualPotentials(last.elementDualPotentials());
+                state.setSpeciesDualPotentials(last.speciesDualPotentials());
+            }
+
+            results[i] = solve(state, T[i], P[i], bi);
+
+            if(results[i].optimum.succeeded)
+                ilast = i;
+        }
+    }
+
+    /// Solve a batch of independent equilibrium problems
+    auto solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> std::vector<EquilibriumResult>
+    {
+        const Index num_problems = states.size();
+
+        // Check the dimensions of the given temperatures, pressures and element amounts
+        Assert(T.size() == Eigen::Index(num_problems) && P.size() == Eigen::Index(num_problems),
+            "Cannot proceed with method EquilibriumSolver::solve.",
+            "The number of given temperatures and pressures does not "
+            "match the number of chemical states in the batch.");
+        Assert(be.rows() == Eigen::Index(num_problems) && be.cols() == Eigen::Index(Ee),
+            "Cannot proceed with method EquilibriumSolver::solve.",
+            "The dimensions of the given matrix of molar amounts of the "
+            "elements do not match the number of chemical states in the batch "
+            "and the number of elements in the equilibrium partition.");
+
+        // The results of the equilibrium calculations in the original order of the problems
+        std::vector<EquilibriumResult> results(num_problems);
+
+        // The order in which the problems are solved, grouping similar problems together
+        const Indices order = batchOrder(T, P, be);
+
+        // The number of parallel tasks among which the ordered problems are divided in contiguous ranges
+        const unsigned threads = numParallelTasks(options.batch.threads, num_problems);
+
+        // The workspaces of the additional tasks, each a copy of this one
+        std::vector<Impl> workspaces(threads - 1, *this);
+
+        ThreadPool::shared().run(threads, [&](unsigned ithread)
+        {
+            Impl& impl = ithread ? workspaces[ithread - 1] : *this;
+            const auto range = parallelTaskRange(num_problems, threads, ithread);
+            impl.solveBatchRange(states, T, P, be, order, range.first, range.second, results);
+        });
+
+        return results;
+    }
+
     /// Return the sensitivity of the equilibrium state.
     auto sensitivity() -> const EquilibriumSensitivity&
     {
@@ -528,40 +911,45 @@ struct EquilibriumSolver::Impl
         sensitivities.dndP = zeros(Ne);
         sensitivities.dndb = zeros(Ne, Ee);
 
-        sensitivities.dndT = solver.dxdp(ue.ddT, zerosEe);
-        sensitivities.dndP = solver.dxdp(ue.ddP, zerosEe);
+        sensitivities.dndT = dxdp(ue.ddT, zerosEe);
+        sensitivities.dndP = dxdp(ue.ddP, zerosEe);
         for(Index j = 0; j < Ee; ++j)
         {
             unitjEe = unit(Ee, j);
-            sensitivities.dndb.col(j) = solver.dxdp(zerosNe, unitjEe);
+            sensitivities.dndb.col(j) = dxdp(zerosNe, unitjEe);
         }
 
+        sensitive = true;
+
         return sensitivities;
     }
 
     /// Compute the sensitivity of the species amounts with respect to temperature.
     auto dndT() -> VectorConstRef
     {
+        sensitive = false;
         const auto& ieq_species = partition.indicesEquilibriumSpecies();
         zerosEe = zeros(Ee);
         sensitivities.dndT = zeros(N);
-        sensitivities.dndT(ieq_species) = solver.dxdp(ue.ddT, zerosEe);
+        sensitivities.dndT(ieq_species) = dxdp(ue.ddT, zerosEe);
         return sensitivities.dndT;
     }
 
     /// Compute the sensitivity of the species amounts with respect to pressure.
     auto dndP() -> VectorConstRef
     {
+        sensitive = false;
         const auto& ieq_species = partition.indicesEquilibriumSpecies();
         zerosEe = zeros(Ee);
         sensitivities.dndP = zeros(N);
-        sensitivities.dndP(ieq_species) = solver.dxdp(ue.ddP, zerosEe);
+        sensitivities.dndP(ieq_species) = dxdp(ue.ddP, zerosEe);
         return sensitivities.dndP;
     }
 
     /// Compute the sensitivity of the species amounts with respect to element amounts.
     auto dndb() -> VectorConstRef
     {
+        sensitive = false;
         const auto& ieq_species = partition.indicesEquilibriumSpecies();
         const auto& ieq_elements = partition.indicesEquilibriumElements();
         zerosEe = zeros(Ee);
@@ -571,7 +959,7 @@ struct EquilibriumSolver::Impl
         for(Index j : ieq_elements)
         {
             unitjEe = unit(Ee, j);
-            sensitivities.dndb.col(j)(ieq_species) = solver.dxdp(zerosNe, unitjEe);
+            sensitivities.dndb.col(j)(ieq_species) = dxdp(zerosNe, unitjEe);
         }
         return sensitivities.dndb;
     }
@@ -604,7 +992,7 @@ auto EquilibriumSolver::operator=(EquilibriumSolver other) -> EquilibriumSolver&
 
 auto EquilibriumSolver::setOptions(const EquilibriumOptions& options) -> void
 {
-    pimpl->options = options;
+    pimpl->setOptions(options);
 }
 
 auto EquilibriumSolver::setPartition(const Partition& partition) -> void
@@ -649,6 +1037,11 @@ auto EquilibriumSolver::solve(ChemicalState& state, const EquilibriumProblem& pr
     return pimpl->solve_with_all_element_amounts(state, problem.temperature(), problem.pressure(), problem.elementAmounts());
 }
 
+auto EquilibriumSolver::solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> std::vector<EquilibriumResult>
+{
+    return pimpl->solve(states, T, P, be);
+}
+
 auto EquilibriumSolver::properties() const -> const ChemicalProperties&
 {
     return pimpl->properties;
@@ -17,6 +17,7 @@
 
 // C++ includes
 #include <memory>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Math/Matrix.hpp>
@@ -96,6 +97,16 @@ public:
     /// @param state[in,out] The initial guess and the final state of the equilibrium calculation
     auto solve(ChemicalState& state) -> EquilibriumResult;
 
+    /// Solve a batch of independent equilibrium problems.
+    /// The problems are solved with the workspace of this solver, reordered by similarity
+    /// and distributed among threads as specified in @ref BatchEquilibriumOptions.
+    /// @param states[in,out] The initial guesses and the final states of the equilibrium calculations
+    /// @param T The temperatures of the equilibrium problems (in units of K)
+    /// @param P The pressures of the equilibrium problems (in units of Pa)
+    /// @param be The molar amounts of the elements in the equilibrium partition, one row per problem
+    /// @return The results of the equilibrium calculations, in the same order as `states`
+    auto solve(std::vector<ChemicalState>& states, VectorConstRef T, VectorConstRef P, MatrixConstRef be) -> std::vector<EquilibriumResult>;
+
     /// Return the chemical properties of the calculated equilibrium state.
     auto properties() const -> const ChemicalProperties&;
 
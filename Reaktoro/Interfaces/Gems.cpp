@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <map>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -116,12 +117,19 @@ struct Gems::Impl
     /// The unique names of the species
     std::vector<std::string> species_names;
 
+    /// The name of the file used to initialize the GEMS TNode instance
+    std::string filename;
+
+    /// The mutex that protects the temperature, pressure and species amounts read by method clone
+    std::mutex mutex;
+
     /// Construct a default Impl instance
     Impl()
     {}
 
     /// Construct a default Impl instance
     Impl(std::string filename)
+    : filename(filename)
     {
         // Initialize the GEMS `node` member
         node = std::make_shared<TNode>();
@@ -307,23 +315,45 @@ auto Gems::properties(ChemicalModelResult& res, double T, double P, VectorConstR
             node()->DC_V0(offset, P, T) :
             node()->Ph_Volume(iphase)/node()->Ph_Mole(iphase);
 
-        // Set d(ln(a))/dn to d(ln(x))/dn, where x is mole fractions
-        res.lnActivities().ddn.block(offset, offset, size, size) = -1.0/sum(np) * ones(size, size);
-        res.lnActivities().ddn.block(offset, offset, size, size).diagonal() += 1.0/np;
+        // Set d(ln(a))/dn to d(ln(x))/dn, where x is mole fractions, if the molar derivatives are computed
+        if(res.derivatives())
+        {
+            res.lnActivities().ddn.block(offset, offset, size, size) = -1.0/sum(np) * ones(size, size);
+            res.lnActivities().ddn.block(offset, offset, size, size).diagonal() += 1.0/np;
+        }
 
         offset += size;
     }
 }
 
 auto Gems::clone() const -> std::shared_ptr<Interface>
+{
+    // The GEMS TNode instance cannot be copied, so the clone initializes a new one
+    // from the same file, and then copies the options and the state of this instance
+    if(pimpl->filename.empty())
+        return std::make_shared<Gems>();
+    auto copy = std::make_shared<Gems>(pimpl->filename);
+    copy->setOptions(pimpl->options);
+    std::unique_lock<std::mutex> lock(pimpl->mutex);
+    const double T = pimpl->T;
+    const double P = pimpl->P;
+    const Vector n = pimpl->n;
+    lock.unlock();
+    copy->set(T, P, n);
+    return copy;
+}
+
+auto Gems::share() const -> std::shared_ptr<Interface>
 {
     return std::make_shared<Gems>(*this);
 }
 
 auto Gems::set(double T, double P) -> void
 {
+    std::unique_lock<std::mutex> lock(pimpl->mutex);
     pimpl->T = T;
     pimpl->P = P;
+    lock.unlock();
 
     node()->setTemperature(T);
     node()->setPressure(P);
@@ -331,9 +361,11 @@ auto Gems::set(double T, double P) -> void
 
 auto Gems::set(double T, double P, VectorConstRef n) -> void
 {
+    std::unique_lock<std::mutex> lock(pimpl->mutex);
     pimpl->T = T;
     pimpl->P = P;
     pimpl->n = n;
+    lock.unlock();
 
     node()->setTemperature(T);
     node()->setPressure(P);
@@ -97,6 +97,9 @@ public:
     /// Return a clone of this Gems instance
     virtual auto clone() const -> std::shared_ptr<Interface>;
 
+    /// Return a copy of this Gems instance that shares its GEMS instance.
+    virtual auto share() const -> std::shared_ptr<Interface>;
+
     /// Set the temperature and pressure of the Gems instance.
     /// @param T The temperature (in units of K)
     /// @param P The pressure (in units of Pa)
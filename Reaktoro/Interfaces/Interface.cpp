@@ -23,6 +23,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/PerThread.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Element.hpp>
@@ -57,6 +58,11 @@ auto speciesInPhase(const Interface& interface, std::vector<Species> species, In
 Interface::~Interface()
 {}
 
+auto Interface::share() const -> std::shared_ptr<Interface>
+{
+    return clone();
+}
+
 auto Interface::formulaMatrix() const -> Matrix
 {
     const unsigned E = numElements();
@@ -125,9 +131,13 @@ auto Interface::system() const -> ChemicalSystem
     const unsigned nspecies = numSpecies();
     const unsigned nphases = numPhases();
 
-    // Create a clone of the abstract Interface instance
-    // to be used in the lambda functions below.
-    std::shared_ptr<Interface> interface = clone();
+    // Create the pool of copies of the Interface instance, one for each thread that
+    // evaluates the lambda functions below, since these evaluations modify its state.
+    // The first thread uses a copy that shares the state of this instance, and the
+    // clones for the other threads are created from it only when they first need one,
+    // while it may be in use, which method clone must support.
+    auto pool = std::make_shared<PerThread<std::shared_ptr<Interface>>>(share(),
+        [](const std::shared_ptr<Interface>& prototype) { return prototype->clone(); }, true);
 
     // Create the Element instances
     std::vector<Element> elements(nelements);
@@ -143,7 +153,7 @@ auto Interface::system() const -> ChemicalSystem
     {
         species[i].setName(speciesName(i));
         species[i].setFormula(speciesName(i));
-        species[i].setElements(elementsInSpecies(*interface, elements, i));
+        species[i].setElements(elementsInSpecies(*this, elements, i));
     }
 
     // Create the Phase instances
@@ -165,7 +175,7 @@ auto Interface::system() const -> ChemicalSystem
         };
 
         phases[i].setName(phaseName(i));
-        phases[i].setSpecies(speciesInPhase(*interface, species, i));
+        phases[i].setSpecies(speciesInPhase(*this, species, i));
         phases[i].setThermoModel(phase_thermo_model);
         phases[i].setChemicalModel(phase_chemical_model);
     }
@@ -173,13 +183,13 @@ auto Interface::system() const -> ChemicalSystem
     // Create the ThermoModel function for the chemical system
     ThermoModel thermo_model = [=](ThermoModelResult& res, Temperature T, Pressure P) -> void
     {
-        interface->properties(res, T, P);
+        pool->local()->properties(res, T, P);
     };
 
     // Create the ChemicalModel function for the chemical system
     ChemicalModel chemical_model = [=](ChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) -> void
     {
-        interface->properties(res, T, P, n);
+        pool->local()->properties(res, T, P, n);
     };
 
     // Create the ChemicalSystem instance
@@ -88,8 +88,15 @@ public:
     virtual auto properties(ChemicalModelResult& res, double T, double P, VectorConstRef n) -> void = 0;
 
     /// Return a clone of this Interface instance.
+    /// The clone must be independent of this instance, so that both can be used concurrently,
+    /// and it must be possible to create it while another thread uses this instance.
     virtual auto clone() const -> std::shared_ptr<Interface> = 0;
 
+    /// Return a copy of this Interface instance that shares its state with this instance.
+    /// By default, this is a clone of this instance. Derived classes whose clones are
+    /// expensive should return a shallow copy instead.
+    virtual auto share() const -> std::shared_ptr<Interface>;
+
     /// Return the formula matrix of the species
     auto formulaMatrix() const -> Matrix;
 
@@ -109,6 +116,11 @@ public:
     auto indexFirstSpeciesInPhase(Index iphase) const -> Index;
 
     /// Return a ChemicalSystem instance created from an instance of a class derived from Interface.
+    /// The models of the chemical system are evaluated on the copy of this instance returned by
+    /// method @ref share in the first thread that evaluates them. Each other thread that evaluates
+    /// them at the same time uses a clone, which is created with method @ref clone on its first use.
+    /// The clones of the threads that exit are reused by later threads. Thus, the chemical system
+    /// can be used by many threads concurrently, and no clone is created if it is used by one thread.
     auto system() const -> ChemicalSystem;
 
     /// Return a ChemicalState instance created from an instance of a class derived from Interface.
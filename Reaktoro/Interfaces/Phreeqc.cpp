@@ -18,7 +18,10 @@
 #include "Phreeqc.hpp"
 
 // C++ includes
+#include <fstream>
+#include <limits>
 #include <map>
+#include <sstream>
 
 // Eigen includes
 #include <Reaktoro/deps/eigen3/Eigen/Dense>
@@ -93,9 +96,20 @@ struct Phreeqc::Impl
     // The current molar amounts of all species in PHREEQC (in units of mol)
     Vector n;
 
+    // The temperature and pressure of the last update of the thermodynamic properties (in units of K and Pa)
+    double T_thermo = std::numeric_limits<double>::quiet_NaN();
+    double P_thermo = std::numeric_limits<double>::quiet_NaN();
+
+    // The ionic strength of the last update of the standard properties with T, P, and I corrections (in units of molal)
+    double I_chemical = std::numeric_limits<double>::quiet_NaN();
+
     // The name of the database file loaded into this instance
     std::string database;
 
+    // The PHREEQC input scripts executed in this instance, in order of execution, with
+    // the contents of the input script files read at the time they were executed
+    std::vector<std::string> inputs;
+
     // The set of elements composing the species
     std::vector<element*> elements;
 
@@ -336,9 +350,23 @@ auto Phreeqc::Impl::load(std::string filename) -> void
 
 auto Phreeqc::Impl::execute(std::string input, std::string output) -> void
 {
+    // Read the input script if given as a file name (without the newline char \n),
+    // so that clones of this instance execute it even if the file changes later
+    std::string script = input;
+    if(input.find('\n') == std::string::npos)
+    {
+        std::ifstream file(input);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        if(file) script = contents.str() + "\n";
+    }
+
     // Execute the given input script file
     PhreeqcUtils::execute(phreeqc, input, output);
 
+    // Register the executed input script for the creation of clones of this instance
+    inputs.push_back(script);
+
     // Initialize the data members after executing the PHREEQC script
     initialize();
 }
@@ -378,6 +406,9 @@ auto Phreeqc::Impl::initialize() -> void
     // Initialize the critical properties of the gases
     initializeCriticalPropertiesGaseousSpecies();
 
+    // Ensure the thermodynamic properties are updated after executing a PHREEQC script
+    T_thermo = P_thermo = std::numeric_limits<double>::quiet_NaN();
+
     // Initialize the chemical state
     initializeChemicalState();
 }
@@ -699,8 +730,9 @@ auto Phreeqc::Impl::set(double T, double P) -> void
     // Update the pressure member (in units of atm)
     phreeqc.patm_x = P * pascal_to_atm;
 
-    // Update the thermodynamic properties (T and P dependent)
-    updateThermoProperties();
+    // Update the thermodynamic properties (T and P dependent) only if T or P have changed
+    if(T != T_thermo || P != P_thermo)
+        updateThermoProperties();
 }
 
 auto Phreeqc::Impl::set(double T, double P, const Vector& n) -> void
@@ -721,8 +753,9 @@ auto Phreeqc::Impl::set(double T, double P, const Vector& n) -> void
     // Update the amounts of the species
     setSpeciesAmounts(n);
 
-    // Update the thermodynamic properties (T and P dependent)
-    updateThermoProperties();
+    // Update the thermodynamic properties (T and P dependent) only if T or P have changed
+    if(T != T_thermo || P != P_thermo)
+        updateThermoProperties();
 
     // Update the thermodynamic properties (T, P, and n dependent)
     updateChemicalProperties();
@@ -752,20 +785,40 @@ auto Phreeqc::Impl::updateThermoProperties() -> void
 
     // Update the ln activity constants
     ln_activity_constants = lnActivityConstants();
+
+    // Register the temperature and pressure of these thermodynamic properties
+    T_thermo = T;
+    P_thermo = P;
+
+    // The equilibrium constants in PHREEQC no longer have ionic strength corrections
+    I_chemical = std::numeric_limits<double>::quiet_NaN();
 }
 
 auto Phreeqc::Impl::updateChemicalProperties() -> void
 {
-    // Update equilibrium constants of reactions with T, P, and I corrections.
-    // This Phreeqc::k_temp call also updates density and dielectric
-    // properties of water at the given T and P conditions.
-    phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
+    // Update the standard properties with T, P, and I corrections only if the
+    // ionic strength has changed, since T and P have not changed since then
+    if(I != I_chemical)
+    {
+        // Ensure Phreeqc::k_temp does not skip the ionic strength corrections
+        // when the ionic strength has changed only slightly since its last call,
+        // so that the results are the same as those without this caching
+        phreeqc.current_mu = std::numeric_limits<double>::quiet_NaN();
 
-    // Update the standard Gibbs energies of the species with T, P, and I corrections
-    standard_molar_gibbs_energies_TPI = speciesMolarGibbsEnergies();
+        // Update equilibrium constants of reactions with T, P, and I corrections.
+        // This Phreeqc::k_temp call also updates density and dielectric
+        // properties of water at the given T and P conditions.
+        phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
 
-    // Update the standard molar volumes of the species with T, P, and I corrections
-    standard_molar_volumes_TPI = speciesMolarVolumes();
+        // Update the standard Gibbs energies of the species with T, P, and I corrections
+        standard_molar_gibbs_energies_TPI = speciesMolarGibbsEnergies();
+
+        // Update the standard molar volumes of the species with T, P, and I corrections
+        standard_molar_volumes_TPI = speciesMolarVolumes();
+
+        // Register the ionic strength of these standard properties
+        I_chemical = I;
+    }
 
     updateAqueousProperties();
 
@@ -1319,6 +1372,10 @@ auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorCon
     res.lnActivityCoefficients().val = pimpl->ln_activity_coefficients;
     res.lnActivities().val = pimpl->ln_activities;
 
+    // Skip the molar derivatives of the activities if these are not computed
+    if(!res.derivatives())
+        return;
+
     // The number of phases
     const Index num_phases = numPhases();
 
@@ -1332,15 +1389,29 @@ auto Phreeqc::properties(ChemicalModelResult& res, double T, double P, VectorCon
         // The species amounts in the current phase
         const auto np = n.segment(offset, size);
 
-        // Set d(ln(a))/dn to d(ln(x))/dn, where x is mole fractions
-        res.lnActivities().ddn.block(offset, offset, size, size) = -1.0/sum(np) * ones(size, size);
-        res.lnActivities().ddn.block(offset, offset, size, size).diagonal() += 1.0/np;
+        // Set d(ln(a))/dn to d(ln(x))/dn, where x is mole fractions, which is
+        // the constant -1/sum(np) plus the diagonal 1/np, written in place
+        auto block = res.lnActivities().ddn.block(offset, offset, size, size);
+        block.setConstant(-1.0/np.sum());
+        block.diagonal().array() += np.array().inverse();
 
         offset += size;
     }
 }
 
 auto Phreeqc::clone() const -> std::shared_ptr<Interface>
+{
+    // The PHREEQC instance cannot be copied together with the state of its species
+    // and phases, so the clone loads the same database and executes the same scripts
+    if(pimpl->database.empty())
+        return std::make_shared<Phreeqc>();
+    auto copy = std::make_shared<Phreeqc>(pimpl->database);
+    for(const std::string& input : pimpl->inputs)
+        copy->execute(input);
+    return copy;
+}
+
+auto Phreeqc::share() const -> std::shared_ptr<Interface>
 {
     return std::make_shared<Phreeqc>(*this);
 }
@@ -89,9 +89,15 @@ public:
     /// @param n The amounts of the species (in units of mol)
     virtual auto properties(ChemicalModelResult& res, double T, double P, VectorConstRef n) -> void;
 
-    /// Return a clone of this Phreeqc instance
+    /// Return a clone of this Phreeqc instance.
+    /// The clone is an independent instance created by loading the same database and
+    /// executing the same input scripts. Changes made directly to the PHREEQC instance
+    /// returned by method @ref phreeqc are not reproduced in the clone.
     virtual auto clone() const -> std::shared_ptr<Interface>;
 
+    /// Return a copy of this Phreeqc instance that shares its PHREEQC instance.
+    virtual auto share() const -> std::shared_ptr<Interface>;
+
     /// Set the temperature and pressure of the interfaced code.
     /// This method should be used to update all thermodynamic properties
     /// that depend only on temperature and pressure, such as standard thermodynamic
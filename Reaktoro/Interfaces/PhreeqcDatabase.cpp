@@ -17,16 +17,24 @@
 
 #include "PhreeqcDatabase.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <array>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/Element.hpp>
 #include <Reaktoro/Thermodynamics/Core/Database.hpp>
+#include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
 #include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
 #include <Reaktoro/Thermodynamics/Species/GaseousSpecies.hpp>
 #include <Reaktoro/Thermodynamics/Species/MineralSpecies.hpp>
+#include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
 // Phreeqc includes
 #include <Reaktoro/Interfaces/PhreeqcLegacy.hpp>
@@ -39,7 +47,7 @@ auto createElement(const PhreeqcElement* e) -> Element
 {
 	Element element;
 	element.setName(e->name);
-	element.setMolarMass(e->gfw);
+	element.setMolarMass(e->gfw * 1e-3); // from g/mol to kg/mol
 	return element;
 }
 
@@ -62,17 +70,218 @@ auto elementsInPhase(const PhreeqcPhase* p) -> std::map<Element, double>
 template<typename SpeciesType>
 auto speciesThermoParamsPhreeqc(const SpeciesType& species) -> SpeciesThermoParamsPhreeqc
 {
+	// The log K expression of the reaction in the database, which includes the
+	// log K expressions added with `-add_logk`, or the one of the species otherwise
+	const auto logk = species->rxn ? species->rxn->logk : species->logk;
+
 	SpeciesThermoParamsPhreeqc params;
 	params.reaction.equation = PhreeqcUtils::reactionEquation(species);
-	params.reaction.log_k = species->logk[logK_T0];
-	params.reaction.delta_h = species->logk[delta_h];
+	params.reaction.log_k = logk[logK_T0];
+	params.reaction.delta_h = logk[delta_h];
 	params.reaction.analytic = {
-		species->logk[T_A1],
-		species->logk[T_A2],
-		species->logk[T_A3],
-		species->logk[T_A4],
-		species->logk[T_A5],
-		species->logk[T_A6]};
+		logk[T_A1],
+		logk[T_A2],
+		logk[T_A3],
+		logk[T_A4],
+		logk[T_A5],
+		logk[T_A6]};
+	return params;
+}
+
+/// The coefficients of the analytical expression of log K of a reaction,
+/// @f$\log_{10}K=A_{1}+A_{2}T+A_{3}/T+A_{4}\log_{10}T+A_{5}/T^{2}+A_{6}T^{2}@f$.
+using LogKCoefficients = std::array<double, 6>;
+
+/// Return the coefficients of the analytical expression of log K of a reaction.
+/// The Van't Hoff equation is written in the same form, with only @f$A_1@f$ and @f$A_3@f$.
+auto logKCoefficients(const SpeciesThermoParamsPhreeqc& params) -> LogKCoefficients
+{
+	const auto& A = params.reaction.analytic;
+	if(A.size() == 6 && std::any_of(A.begin(), A.end(), [](double a) { return a != 0.0; }))
+		return {A[0], A[1], A[2], A[3], A[4], A[5]};
+
+	// The delta_h of the reaction converted to log K units (in units of K), using the
+	// value of the universal gas constant in PHREEQC, 8.31470 J/(mol*K), as in method `k_calc`
+	const double ln10 = 2.302585092994046;
+	const double R = 8.31470;
+	const double dh = params.reaction.delta_h * 1000.0/(R * ln10);
+	return {params.reaction.log_k + dh/298.15, 0.0, -dh, 0.0, 0.0, 0.0};
+}
+
+/// The parameters of the activity coefficient of an aqueous species in the ion-association model of PHREEQC.
+struct AqueousSpeciesActivityParams
+{
+	/// The kind of activity coefficient equation (0: neutral, 1: Davies, 2: WATEQ Debye-Huckel, 3: ideal).
+	int gflag = 0;
+
+	/// The ion-size parameter `a` of the WATEQ Debye-Huckel equation (in units of angstrom).
+	double dha = 0.0;
+
+	/// The parameter `b` of the WATEQ Debye-Huckel equation, or of the neutral species.
+	double dhb = 0.0;
+};
+
+/// A parameter of the Pitzer or SIT model of PHREEQC for the interaction of two or three aqueous species.
+struct AqueousInteractionParam
+{
+	/// The kind of the parameter (e.g., TYPE_B0, TYPE_THETA, TYPE_SIT_EPSILON).
+	pitz_param_type type = TYPE_Other;
+
+	/// The names of the two or three interacting species.
+	std::vector<std::string> species;
+
+	/// The coefficients of the temperature dependence of the parameter.
+	std::array<double, 6> a = {};
+
+	/// The parameter alpha of the B1 and B2 parameters of the Pitzer model.
+	double alpha = 0.0;
+
+	/// The coefficients of the lambda and mu parameters in the activity coefficients of the species.
+	std::array<double, 3> ln_coef = {};
+
+	/// The coefficient of the lambda and mu parameters in the osmotic coefficient.
+	double os_coef = 0.0;
+};
+
+/// Return the parameters of the Pitzer or SIT model in a list of PHREEQC parameters.
+auto aqueousInteractionParams(pitz_param** params, int count) -> std::vector<AqueousInteractionParam>
+{
+	std::vector<AqueousInteractionParam> res;
+	for(int i = 0; i < count; ++i)
+	{
+		// The higher-order electrostatic terms are added by the Pitzer model itself
+		if(params[i]->type == TYPE_ETHETA || params[i]->type == TYPE_ALPHAS)
+			continue;
+		AqueousInteractionParam param;
+		param.type = params[i]->type;
+		for(const char* species : params[i]->species)
+			if(species) param.species.push_back(species);
+		std::copy(params[i]->a, params[i]->a + 6, param.a.begin());
+		param.alpha = params[i]->alpha;
+		std::copy(params[i]->ln_coef, params[i]->ln_coef + 3, param.ln_coef.begin());
+		param.os_coef = params[i]->os_coef;
+		res.push_back(param);
+	}
+	return res;
+}
+
+/// Return the value of a parameter of the Pitzer or SIT model at a temperature (in units of K), as in method `calc_pitz_param`.
+auto aqueousInteractionParamValue(const std::array<double, 6>& a, Temperature T) -> ThermoScalar
+{
+	const double TR = 298.15;
+	return a[0] + a[1]*(1.0/T - 1.0/TR) + a[2]*log(T/TR) + a[3]*(T - TR) +
+		a[4]*(T*T - TR*TR) + a[5]*(1.0/(T*T) - 1.0/(TR*TR));
+}
+
+/// Return the integral J(x) of the higher-order electrostatic terms of the Pitzer model and
+/// its first and second derivatives, using the Chebyshev approximation of method `ETHETA_PARAMS`.
+auto pitzerJ(double x) -> std::array<double, 3>
+{
+	static const double ak[42] = {
+		1.925154014814667e0, -.060076477753119e0, -.029779077456514e0,
+		-.007299499690937e0, 0.000388260636404e0, 0.000636874599598e0,
+		0.000036583601823e0, -.000045036975204e0, -.000004537895710e0,
+		0.000002937706971e0, 0.000000396566462e0, -.000000202099617e0,
+		-.000000025267769e0, 0.000000013522610e0, 0.000000001229405e0,
+		-.000000000821969e0, -.000000000050847e0, 0.000000000046333e0,
+		0.000000000001943e0, -.000000000002563e0, -.000000000010991e0,
+		0.628023320520852e0, 0.462762985338493e0, 0.150044637187895e0,
+		-.028796057604906e0, -.036552745910311e0, -.001668087945272e0,
+		0.006519840398744e0, 0.001130378079086e0, -.000887171310131e0,
+		-.000242107641309e0, 0.000087294451594e0, 0.000034682122751e0,
+		-.000004583768938e0, -.000003548684306e0, -.000000250453880e0,
+		0.000000216991779e0, 0.000000080779570e0, 0.000000004558555e0,
+		-.000000006944757e0, -.000000002849257e0, 0.000000000237816e0
+	};
+
+	// The Chebyshev variable z(x) and its first and second derivatives
+	const double* a = x <= 1.0 ? ak : ak + 21;
+	double z, dz, d2z;
+	if(x <= 1.0)
+	{
+		const double p = std::pow(x, 0.2);
+		z = 4.0*p - 2.0;
+		dz = 0.8*p/x;
+		d2z = -0.64*p/(x*x);
+	}
+	else
+	{
+		const double p = std::pow(x, -0.1);
+		z = (40.0*p - 22.0)/9.0;
+		dz = -4.0*p/(9.0*x);
+		d2z = 4.4*p/(9.0*x*x);
+	}
+
+	// The Clenshaw recurrence of the series and of its first and second derivatives with respect to z
+	double b[23] = {}, d[23] = {}, e[23] = {};
+	for(int i = 20; i >= 0; --i)
+	{
+		b[i] = z*b[i + 1] - b[i + 2] + a[i];
+		d[i] = b[i + 1] + z*d[i + 1] - d[i + 2];
+		e[i] = 2.0*d[i + 1] + z*e[i + 1] - e[i + 2];
+	}
+
+	const double J = x/4.0 - 1.0 + 0.5*(b[0] - b[2]);
+	const double dJ = 0.25 + 0.5*(d[0] - d[2])*dz;
+	const double d2J = 0.5*((e[0] - e[2])*dz*dz + (d[0] - d[2])*d2z);
+	return {J, dJ, d2J};
+}
+
+/// Calculate the higher-order electrostatic term of the Pitzer model for two ions of unlike charges, and
+/// its derivative with respect to ionic strength, as in method `ETHETAS`.
+auto pitzerETheta(double zj, double zk, const ThermoScalar& A0, const ChemicalScalar& I, ChemicalScalar& etheta, ChemicalScalar& ethetap) -> void
+{
+	const ChemicalScalar xcon = 6.0 * A0 * sqrt(I);
+	const double zz = zj * zk;
+
+	// The terms J(x) and x*J'(x), with x = xcon*z, and their derivatives
+	auto jay = [&](double z, ChemicalScalar& J, ChemicalScalar& JP)
+	{
+		const ChemicalScalar x = z * xcon;
+		const auto j = pitzerJ(x.val);
+		J = j[1] * x;
+		J.val = j[0];
+		JP = (j[1] + x.val*j[2]) * x;
+		JP.val = x.val*j[1];
+	};
+
+	ChemicalScalar Jjk, Jjj, Jkk, JPjk, JPjj, JPkk;
+	jay(zz, Jjk, JPjk);
+	jay(zj*zj, Jjj, JPjj);
+	jay(zk*zk, Jkk, JPkk);
+
+	const ChemicalScalar J = Jjk - 0.5*Jjj - 0.5*Jkk;
+	const ChemicalScalar JP = JPjk - 0.5*JPjj - 0.5*JPkk;
+
+	etheta = zz * J/(4.0*I);
+	ethetap = zz * JP/(8.0*I*I) - etheta/I;
+}
+
+/// The parameters A and B of the Debye-Huckel equation.
+struct DebyeHuckelParams
+{
+	/// The parameter A of the Debye-Huckel equation in log10 units (in units of (kg/mol)^0.5).
+	ThermoScalar A;
+
+	/// The parameter B of the Debye-Huckel equation (in units of 1/(angstrom*(mol/kg)^0.5)).
+	ThermoScalar B;
+};
+
+/// Return the parameters of the Debye-Huckel equation calculated as in method `calc_dielectrics`,
+/// with the density and dielectric constant of water used in PHREEQC.
+auto debyeHuckelParams(Temperature T, Pressure P) -> DebyeHuckelParams
+{
+	// The constants `pi` and `AVOGADRO` are defined in the PHREEQC headers
+	const double ln10 = 2.302585092994046;
+
+	const ThermoScalar rho = PhreeqcUtils::waterDensity(T, P)/1000; // in units of g/cm3
+	const ThermoScalar epsilon = PhreeqcUtils::waterDielectricConstant(T, P);
+	const ThermoScalar e2_DkT = 1.671008e-3/(epsilon * T);
+	const ThermoScalar DH_B = sqrt(8*pi*AVOGADRO*e2_DkT*rho/1e3);
+
+	DebyeHuckelParams params;
+	params.A = DH_B*e2_DkT/(2*ln10);
+	params.B = DH_B/1e8;
 	return params;
 }
 
@@ -230,6 +439,27 @@ struct PhreeqcDatabase::Impl
 	/// The map from a master species to the product species composed by it
 	std::vector<std::set<std::string>> from_master_to_product_species;
 
+	/// The activity coefficient parameters of the aqueous species in the database
+	std::map<std::string, AqueousSpeciesActivityParams> activity_params;
+
+	/// The standard molar volumes of the mineral species in the database (in units of m3/mol)
+	std::map<std::string, double> mineral_molar_volumes;
+
+	/// The flag that indicates if the database uses the Pitzer model instead of the ion-association model
+	bool pitzer = false;
+
+	/// The flag that indicates if the database uses the SIT model instead of the ion-association model
+	bool sit = false;
+
+	/// The parameters of the Pitzer or SIT model in the database
+	std::vector<AqueousInteractionParam> interaction_params;
+
+	/// The flag that indicates if the activity coefficients of the Pitzer model use the MacInnes convention
+	bool macinnes = false;
+
+	/// The flag that indicates if the Pitzer model includes the higher-order electrostatic terms
+	bool etheta = false;
+
 	auto load(std::string filename) -> void
 	{
 		// Clear current state
@@ -240,6 +470,9 @@ struct PhreeqcDatabase::Impl
 		master_species.clear();
 		idx_master_species.clear();
 		from_master_to_product_species.clear();
+		activity_params.clear();
+		mineral_molar_volumes.clear();
+		interaction_params.clear();
 
 		// Initialize the phreeqc instance
 		int errors = phreeqc.do_initialize();
@@ -308,6 +541,572 @@ struct PhreeqcDatabase::Impl
 				gaseous_species.push_back(createGaseousSpecies(phreeqc.phases[i]));
 			else
 				mineral_species.push_back(createMineralSpecies(phreeqc.phases[i]));
+
+		// Initialize the activity coefficient parameters of the aqueous species
+		for(int i = 0; i < phreeqc.count_s; ++i)
+			activity_params[phreeqc.s[i]->name] = {phreeqc.s[i]->gflag, phreeqc.s[i]->dha, phreeqc.s[i]->dhb};
+
+		// Initialize the standard molar volumes of the mineral species
+		for(int i = 0; i < phreeqc.count_phases; ++i)
+			if(!PhreeqcUtils::isGaseousSpecies(phreeqc.phases[i]))
+				mineral_molar_volumes[phreeqc.phases[i]->name] = convertCubicCentimeterToCubicMeter(phreeqc.phases[i]->logk[vm0]);
+
+		// Initialize the parameters of the Pitzer or SIT model of the database (e.g., pitzer.dat, sit.dat)
+		pitzer = phreeqc.pitzer_model;
+		sit = phreeqc.sit_model;
+		if(pitzer)
+			interaction_params = aqueousInteractionParams(phreeqc.pitz_params, phreeqc.count_pitz_param);
+		if(sit)
+			interaction_params = aqueousInteractionParams(phreeqc.sit_params, phreeqc.count_sit_param);
+		macinnes = pitzer && phreeqc.ICON;
+		etheta = pitzer && phreeqc.use_etheta;
+	}
+
+	/// Return the reaction parameters of a species in the database, if any.
+	auto reactionParams(std::string name) const -> const SpeciesThermoParamsPhreeqc*
+	{
+		auto params = [](const auto& species) -> const SpeciesThermoParamsPhreeqc*
+		{
+			const auto& phreeqc = species.thermoData().phreeqc;
+			return phreeqc && !phreeqc->reaction.equation.empty() ? &phreeqc.value() : nullptr;
+		};
+
+		Index i = index(name, aqueous_species);
+		if(i < aqueous_species.size()) return params(aqueous_species[i]);
+
+		i = index(name, gaseous_species);
+		if(i < gaseous_species.size()) return params(gaseous_species[i]);
+
+		i = index(name, mineral_species);
+		if(i < mineral_species.size()) return params(mineral_species[i]);
+
+		RuntimeError("Could not find the species `" + name + "` in PhreeqcDatabase.",
+			"There is no such species in the database.");
+		return nullptr;
+	}
+
+	/// Return the coefficients of the analytical expression of the sum of ln K of the
+	/// reactions that give the standard molar Gibbs energy of a species, @f$G^{\circ}=RT\sum_{r}c_{r}\ln K_{r}@f$.
+	/// The master species, which have empty reaction equations, have zero standard molar Gibbs energy.
+	auto gibbsEnergyCoefficients(std::string name, std::map<std::string, LogKCoefficients>& cache) const -> LogKCoefficients
+	{
+		auto iter = cache.find(name);
+		if(iter != cache.end())
+			return iter->second;
+
+		LogKCoefficients res = {};
+
+		if(const auto params = reactionParams(name))
+		{
+			// Using G_{j}^{\circ}=-\frac{1}{\nu_{j}}\left[\sum_{i\neq j}\nu_{i}G_{i}^{\circ}+RT\ln K\right]
+			const double stoichiometry = params->reaction.equation.stoichiometry(name);
+			const LogKCoefficients logk = logKCoefficients(*params);
+			for(unsigned k = 0; k < res.size(); ++k)
+				res[k] = logk[k];
+			for(auto pair : params->reaction.equation)
+			{
+				if(pair.first == name) continue;
+				const LogKCoefficients other = gibbsEnergyCoefficients(pair.first, cache);
+				for(unsigned k = 0; k < res.size(); ++k)
+					res[k] += pair.second * other[k];
+			}
+			for(unsigned k = 0; k < res.size(); ++k)
+				res[k] /= -stoichiometry;
+		}
+
+		return cache[name] = res;
+	}
+
+	auto thermoModel(const std::vector<std::string>& species) const -> PhaseThermoModel
+	{
+		// The natural log of 10 and the universal gas constant (in units of J/(mol*K))
+		const double ln10 = 2.302585092994046;
+		const double R = universalGasConstant;
+
+		// The number of species in the phase
+		const Index num_species = species.size();
+
+		// The coefficients of the analytical expressions of G/(RT ln 10) of the species
+		Matrix M = zeros(num_species, 6);
+
+		// The standard molar volumes of the species (in units of m3/mol), except that of water
+		Vector V = zeros(num_species);
+
+		// The index of the water species, whose standard molar volume follows from the density of water in PHREEQC
+		Index iwater = num_species;
+
+		// The ln activity constants of the species, with ln(P) added for the gaseous ones
+		Vector ln_c = zeros(num_species);
+		Vector is_gas = zeros(num_species);
+
+		std::map<std::string, LogKCoefficients> cache;
+		for(Index i = 0; i < num_species; ++i)
+		{
+			const std::string& name = species[i];
+			const LogKCoefficients coeffs = gibbsEnergyCoefficients(name, cache);
+			for(unsigned k = 0; k < coeffs.size(); ++k)
+				M(i, k) = coeffs[k];
+
+			if(isAlternativeWaterName(name))
+				iwater = i;
+			else if(index(name, aqueous_species) < aqueous_species.size())
+				ln_c[i] = std::log(1.0/waterMolarMass);
+			else if(index(name, gaseous_species) < gaseous_species.size())
+				is_gas[i] = 1.0;
+			else if(mineral_molar_volumes.count(name))
+				V[i] = mineral_molar_volumes.at(name);
+		}
+
+		PhaseThermoModel model = [=](PhaseThermoModelResult& res, Temperature T, Pressure P)
+		{
+			// The basis functions of the analytical expression of log K and their temperature derivatives
+			const double t = T.val;
+			Vector b(6), b1(6), b2(6), b3(6);
+			b  << 1.0, t, 1.0/t, std::log10(t), 1.0/(t*t), t*t;
+			b1 << 0.0, 1.0, -1.0/(t*t), 1.0/(t*ln10), -2.0/(t*t*t), 2.0*t;
+			b2 << 0.0, 0.0, 2.0/(t*t*t), -1.0/(t*t*ln10), 6.0/(t*t*t*t), 2.0;
+			b3 << 0.0, 0.0, -6.0/(t*t*t*t), 2.0/(t*t*t*ln10), -24.0/(t*t*t*t*t), 0.0;
+
+			// The sum of ln K of the reactions of the species, f = G/(RT), and its temperature derivatives
+			const Vector f  = ln10 * (M * b);
+			const Vector f1 = ln10 * (M * b1);
+			const Vector f2 = ln10 * (M * b2);
+			const Vector f3 = ln10 * (M * b3);
+
+			auto& G  = res.standard_partial_molar_gibbs_energies;
+			auto& H  = res.standard_partial_molar_enthalpies;
+			auto& Cp = res.standard_partial_molar_heat_capacities_cp;
+			auto& Cv = res.standard_partial_molar_heat_capacities_cv;
+
+			// Using G = RTf, H = -RT^2 f' (Gibbs-Helmholtz), Cp = dH/dT
+			G.val = R*t*f;
+			G.ddT = R*(f + t*f1);
+			G.ddP.setZero();
+			H.val = -R*t*t*f1;
+			H.ddT = -R*(2*t*f1 + t*t*f2);
+			H.ddP.setZero();
+			Cp.val = H.ddT;
+			Cp.ddT = -R*(2*f1 + 4*t*f2 + t*t*f3);
+			Cp.ddP.setZero();
+			Cv.val = Cp.val;
+			Cv.ddT = Cp.ddT;
+			Cv.ddP.setZero();
+
+			res.standard_partial_molar_volumes.val = V;
+			res.standard_partial_molar_volumes.ddT.setZero();
+			res.standard_partial_molar_volumes.ddP.setZero();
+			if(iwater < num_species)
+				res.standard_partial_molar_volumes[iwater] = waterMolarMass/PhreeqcUtils::waterDensity(T, P);
+
+			res.ln_activity_constants.val = ln_c + is_gas * std::log(P.val * 1e-5);
+			res.ln_activity_constants.ddT.setZero();
+			res.ln_activity_constants.ddP = is_gas / P.val;
+		};
+
+		return model;
+	}
+
+	auto aqueousChemicalModel(const AqueousMixture& mixture) const -> PhaseChemicalModel
+	{
+		if(pitzer) return pitzerChemicalModel(mixture);
+		if(sit) return sitChemicalModel(mixture);
+
+		// The natural log of 10
+		const double ln10 = 2.302585092994046;
+
+		// The factor in the activity of water, 1 - 0.017*sum(m), used in PHREEQC (in units of kg/mol)
+		const double aw_factor = 0.017;
+
+		// The number of species and the index of the water species
+		const Index num_species = mixture.numSpecies();
+		const Index iwater = mixture.indexWater();
+
+		// The activity coefficient parameters and the squared charges of the species
+		std::vector<AqueousSpeciesActivityParams> params(num_species);
+		Vector z2 = zeros(num_species);
+		for(Index i = 0; i < num_species; ++i)
+		{
+			const AqueousSpecies& species = mixture.species(i);
+			const auto iter = activity_params.find(species.name());
+			Assert(iter != activity_params.end(), "Could not create the aqueous chemical model of the PHREEQC database.",
+				"The aqueous species `" + species.name() + "` is not in the database.");
+			params[i] = iter->second;
+			Assert(i == iwater || params[i].gflag <= 3, "Could not create the aqueous chemical model of the PHREEQC database.",
+				"The activity coefficient model of species `" + species.name() + "` (e.g., LLNL) is only supported by the PHREEQC engine.");
+			z2[i] = species.charge() * species.charge();
+		}
+
+		// Define the chemical model function of the aqueous phase, which keeps no state between calls
+		PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n)
+		{
+			// Evaluate the state of the aqueous mixture
+			const AqueousMixtureState state = mixture.state(T, P, n, res.derivatives);
+
+			// Auxiliary constant references
+			const auto& I = state.Ie; // ionic strength
+			const auto& x = state.x;  // mole fractions of the species
+			const auto& m = state.m;  // molalities of the species
+
+			// The Debye-Huckel parameters A and B
+			const DebyeHuckelParams dh = debyeHuckelParams(T, P);
+			const ThermoScalar& A = dh.A;
+			const ThermoScalar& B = dh.B;
+
+			// The ionic strength terms common to all species
+			const ChemicalScalar sqrtI = sqrt(I);
+			const ChemicalScalar davies = -ln10 * A * (sqrtI/(1.0 + sqrtI) - 0.3*I);
+
+			auto& ln_g = res.ln_activity_coefficients;
+			auto& ln_a = res.ln_activities;
+
+			for(Index i = 0; i < num_species; ++i)
+			{
+				if(i == iwater) continue;
+				switch(params[i].gflag)
+				{
+				case 0: ln_g[i] = ln10 * params[i].dhb * I; break;
+				case 1: ln_g[i] = z2[i] * davies; break;
+				case 2: ln_g[i] = ln10 * (-A*z2[i]*sqrtI/(1.0 + params[i].dha*B*sqrtI) + params[i].dhb*I); break;
+				default: ln_g[i] = ChemicalScalar(I.ddn.size()); break;
+				}
+			}
+
+			ln_a = ln_g + log(m);
+
+			// The activity of water, 1 - 0.017*sum(m), with the molalities of the solutes only
+			const ChemicalScalar msolutes = sum(m) - m[iwater];
+			ln_a[iwater] = log(1.0 - aw_factor * msolutes);
+			ln_g[iwater] = ln_a[iwater] - log(x[iwater]);
+		};
+
+		return model;
+	}
+
+	/// Return the parameters of the Pitzer or SIT model whose species are all in a list, and the indices of these species in the list.
+	auto interactionParams(const std::vector<std::string>& names, std::vector<Indices>& indices) const -> std::vector<AqueousInteractionParam>
+	{
+		std::vector<AqueousInteractionParam> res;
+		indices.clear();
+		for(const AqueousInteractionParam& param : interaction_params)
+		{
+			Indices ispecies;
+			for(const std::string& name : param.species)
+				ispecies.push_back(index(name, names));
+			if(std::any_of(ispecies.begin(), ispecies.end(), [&](Index i) { return i >= names.size(); }))
+				continue;
+			res.push_back(param);
+			indices.push_back(ispecies);
+		}
+		return res;
+	}
+
+	auto pitzerChemicalModel(const AqueousMixture& mixture) const -> PhaseChemicalModel
+	{
+		// The number of species and the index of the water species
+		const Index num_species = mixture.numSpecies();
+		const Index iwater = mixture.indexWater();
+
+		// The names and charges of the species, with the chloride ion used in the MacInnes
+		// convention added after the species of the mixture, with zero molality, if missing
+		std::vector<std::string> names = mixture.namesSpecies();
+		const Vector charges = mixture.chargesSpecies();
+		std::vector<double> z(charges.data(), charges.data() + charges.size());
+		const Index icl = index(std::string("Cl-"), names);
+		if(macinnes && icl == num_species)
+		{
+			names.push_back("Cl-");
+			z.push_back(-1.0);
+		}
+		const Index size = names.size();
+		names[iwater] = ""; // water is not a solute in the Pitzer model
+
+		// The parameters of the Pitzer model for the species and the indices of these species
+		std::vector<Indices> iparams;
+		const std::vector<AqueousInteractionParam> params = interactionParams(names, iparams);
+
+		// The coefficients of the B0, B1 and C0 parameters of KCl used in the MacInnes convention
+		std::array<double, 6> kcl_b0 = {}, kcl_b1 = {}, kcl_c0 = {};
+		for(const AqueousInteractionParam& param : interaction_params)
+		{
+			const auto& s = param.species;
+			if(s.size() != 2 || !((s[0] == "K+" && s[1] == "Cl-") || (s[0] == "Cl-" && s[1] == "K+")))
+				continue;
+			if(param.type == TYPE_B0) kcl_b0 = param.a;
+			if(param.type == TYPE_B1) kcl_b1 = param.a;
+			if(param.type == TYPE_C0) kcl_c0 = param.a;
+		}
+
+		// The pairs of cations or anions of unlike charges with higher-order electrostatic terms
+		std::vector<Indices> ipairs;
+		for(Index i = 0; etheta && i < size; ++i)
+			for(Index j = i + 1; j < size; ++j)
+				if(z[i] * z[j] > 0.0 && z[i] != z[j])
+					ipairs.push_back({i, j});
+
+		// Define the chemical model function of the aqueous phase, which keeps no state between calls
+		PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n)
+		{
+			// Evaluate the state of the aqueous mixture
+			const AqueousMixtureState state = mixture.state(T, P, n, res.derivatives);
+
+			// Auxiliary constant references
+			const auto& I = state.Ie; // ionic strength
+			const auto& x = state.x;  // mole fractions of the species
+			const auto& m = state.m;  // molalities of the species
+
+			// The number of derivatives of the chemical scalars, zero if only their values are evaluated
+			const Index num_ddn = I.ddn.size();
+
+			// The molalities of the solutes, including the chloride ion of the MacInnes convention
+			std::vector<ChemicalScalar> M(size, ChemicalScalar(num_ddn));
+			for(Index i = 0; i < num_species; ++i)
+				if(i != iwater) M[i] = m[i];
+
+			// The sums of the molalities and of the molal charges of the solutes
+			ChemicalScalar osum(num_ddn);
+			ChemicalScalar bigz(num_ddn);
+			for(Index i = 0; i < size; ++i)
+			{
+				osum += M[i];
+				bigz += std::abs(z[i]) * M[i];
+			}
+
+			// The Debye-Huckel parameter of the Pitzer model, A0 = ln(10)*A/3
+			const ThermoScalar A0 = std::log(10.0)/3.0 * debyeHuckelParams(T, P).A;
+
+			// The Debye-Huckel terms of the ions, F, and of the ions of charges 1 and 2 at high pressures, F1 and F2
+			const ChemicalScalar DI = sqrt(I);
+			const double b = 1.2;
+			auto debye = [&](const ThermoScalar& beta) -> ChemicalScalar
+			{
+				return -A0 * (DI/(1.0 + beta*DI) + 2.0*log(1.0 + beta*DI)/beta);
+			};
+			ChemicalScalar F = debye(ThermoScalar(b));
+			ChemicalScalar F1 = F;
+			ChemicalScalar F2 = F;
+			const ThermoScalar Patm = P/101325.0;
+			if(Patm.val > 1.0)
+			{
+				ThermoScalar pap = (7e-5 + 1.93e-9*pow(T - 250.0, 2.0)) * Patm;
+				F1 = debye(b - (pap.val > 0.2 ? ThermoScalar(0.2) : pap));
+				pap = 9.65e-10*pow(T - 263.0, 2.773) * pow(Patm, 0.623);
+				F2 = debye(b - (pap.val > 0.2 ? ThermoScalar(0.2) : pap));
+			}
+
+			// The natural log of the activity coefficient of Cl- in KCl solutions, used in the MacInnes convention
+			const ChemicalScalar xx = 2.0*DI;
+			const ChemicalScalar xxx = (1.0 - (1.0 + xx - 0.5*xx*xx)*exp(-xx))/(xx*xx);
+			const ChemicalScalar gamclm = F1 + 2.0*aqueousInteractionParamValue(kcl_b0, T)*I +
+				2.0*aqueousInteractionParamValue(kcl_b1, T)*I*xxx + 1.5*aqueousInteractionParamValue(kcl_c0, T)*I*I;
+
+			// The functions g and g' of the B1 and B2 parameters
+			auto g = [&](const ChemicalScalar& y) -> ChemicalScalar
+			{
+				if(y.val == 0.0) return ChemicalScalar(num_ddn);
+				return 2.0*(1.0 - (1.0 + y)*exp(-y))/(y*y);
+			};
+			auto gp = [&](const ChemicalScalar& y) -> ChemicalScalar
+			{
+				if(y.val == 0.0) return ChemicalScalar(num_ddn);
+				return -2.0*(1.0 - (1.0 + y + 0.5*y*y)*exp(-y))/(y*y);
+			};
+
+			// The natural log of the activity coefficients of the solutes, and the sums of the
+			// osmotic coefficient, of the C0 terms and of the derivative terms of F
+			std::vector<ChemicalScalar> lgamma(size, ChemicalScalar(num_ddn));
+			ChemicalScalar osmot = -A0 * pow(I, 1.5)/(1.0 + b*DI);
+			ChemicalScalar csum(num_ddn);
+			ChemicalScalar fsum(num_ddn);
+
+			for(Index k = 0; k < params.size(); ++k)
+			{
+				const AqueousInteractionParam& param = params[k];
+				const Index i0 = iparams[k][0];
+				const Index i1 = iparams[k][1];
+				const Index i2 = iparams[k].size() > 2 ? iparams[k][2] : i1;
+				const ThermoScalar p = aqueousInteractionParamValue(param.a, T);
+				switch(param.type)
+				{
+				case TYPE_B0:
+					lgamma[i0] += 2.0*p*M[i1];
+					lgamma[i1] += 2.0*p*M[i0];
+					osmot += p*M[i0]*M[i1];
+					break;
+				case TYPE_B1:
+				case TYPE_B2:
+					if(p.val != 0.0)
+					{
+						const ChemicalScalar y = param.alpha*DI;
+						fsum += p*M[i0]*M[i1]*gp(y)/I;
+						lgamma[i0] += 2.0*p*M[i1]*g(y);
+						lgamma[i1] += 2.0*p*M[i0]*g(y);
+						osmot += p*M[i0]*M[i1]*exp(-y);
+					}
+					break;
+				case TYPE_C0:
+				{
+					const ThermoScalar c = p/(2.0*std::sqrt(std::abs(z[i0]*z[i1])));
+					csum += c*M[i0]*M[i1];
+					lgamma[i0] += c*M[i1]*bigz;
+					lgamma[i1] += c*M[i0]*bigz;
+					osmot += c*M[i0]*M[i1]*bigz;
+					break;
+				}
+				case TYPE_THETA:
+					lgamma[i0] += 2.0*p*M[i1];
+					lgamma[i1] += 2.0*p*M[i0];
+					osmot += p*M[i0]*M[i1];
+					break;
+				case TYPE_LAMDA:
+					lgamma[i0] += param.ln_coef[0]*p*M[i1];
+					lgamma[i1] += param.ln_coef[1]*p*M[i0];
+					osmot += param.os_coef*p*M[i0]*M[i1];
+					break;
+				case TYPE_PSI:
+				case TYPE_ZETA:
+				case TYPE_ETA:
+					lgamma[i0] += p*M[i1]*M[i2];
+					lgamma[i1] += p*M[i0]*M[i2];
+					lgamma[i2] += p*M[i0]*M[i1];
+					osmot += p*M[i0]*M[i1]*M[i2];
+					break;
+				case TYPE_MU:
+					lgamma[i0] += param.ln_coef[0]*p*M[i1]*M[i2];
+					lgamma[i1] += param.ln_coef[1]*p*M[i0]*M[i2];
+					lgamma[i2] += param.ln_coef[2]*p*M[i0]*M[i1];
+					osmot += param.os_coef*p*M[i0]*M[i1]*M[i2];
+					break;
+				default:
+					break;
+				}
+			}
+
+			// The higher-order electrostatic terms of the pairs of ions of unlike charges
+			ChemicalScalar eth, ethp;
+			for(const Indices& ipair : ipairs)
+			{
+				const Index i0 = ipair[0];
+				const Index i1 = ipair[1];
+				pitzerETheta(z[i0], z[i1], A0, I, eth, ethp);
+				fsum += ethp*M[i0]*M[i1];
+				lgamma[i0] += 2.0*eth*M[i1];
+				lgamma[i1] += 2.0*eth*M[i0];
+				osmot += (eth + I*ethp)*M[i0]*M[i1];
+			}
+
+			// The Debye-Huckel and C0 terms of the ions
+			for(Index i = 0; i < size; ++i)
+			{
+				const double zi = std::abs(z[i]);
+				if(zi == 0.0) continue;
+				lgamma[i] += zi*zi*((zi == 1.0 ? F1 : zi == 2.0 ? F2 : F) + fsum) + zi*csum;
+			}
+
+			// Convert the activity coefficients of the ions to the MacInnes convention
+			if(macinnes)
+			{
+				const ChemicalScalar phimac = lgamma[icl] - gamclm;
+				for(Index i = 0; i < size; ++i)
+					lgamma[i] += z[i]*phimac;
+			}
+
+			auto& ln_g = res.ln_activity_coefficients;
+			auto& ln_a = res.ln_activities;
+
+			for(Index i = 0; i < num_species; ++i)
+				if(i != iwater) ln_g[i] = lgamma[i];
+
+			ln_a = ln_g + log(m);
+
+			// The activity of water, exp(-osum*cosmot/55.50837), with cosmot = 1 + 2*osmot/osum
+			ln_a[iwater] = -(osum + 2.0*osmot)/55.50837;
+			ln_g[iwater] = ln_a[iwater] - log(x[iwater]);
+		};
+
+		return model;
+	}
+
+	auto sitChemicalModel(const AqueousMixture& mixture) const -> PhaseChemicalModel
+	{
+		// The natural log of 10
+		const double ln10 = 2.302585092994046;
+
+		// The number of species and the index of the water species
+		const Index num_species = mixture.numSpecies();
+		const Index iwater = mixture.indexWater();
+
+		// The names and charges of the species
+		std::vector<std::string> names = mixture.namesSpecies();
+		const Vector z = mixture.chargesSpecies();
+		names[iwater] = ""; // water is not a solute in the SIT model
+
+		// The parameters of the SIT model for the species and the indices of these species
+		std::vector<Indices> iparams;
+		const std::vector<AqueousInteractionParam> params = interactionParams(names, iparams);
+
+		// Define the chemical model function of the aqueous phase, which keeps no state between calls
+		PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n)
+		{
+			// Evaluate the state of the aqueous mixture
+			const AqueousMixtureState state = mixture.state(T, P, n, res.derivatives);
+
+			// Auxiliary constant references
+			const auto& I = state.Ie; // ionic strength
+			const auto& x = state.x;  // mole fractions of the species
+			const auto& m = state.m;  // molalities of the species
+
+			// The sum of the molalities of the solutes
+			const ChemicalScalar osum = sum(m) - m[iwater];
+
+			// The Debye-Huckel term of the ions in log10 units
+			const ThermoScalar A = debyeHuckelParams(T, P).A;
+			const double b = 1.5;
+			const ChemicalScalar DI = sqrt(I);
+			const ChemicalScalar t = 1.0 + b*DI;
+			const ChemicalScalar F = -A*DI/t;
+
+			auto& ln_g = res.ln_activity_coefficients;
+			auto& ln_a = res.ln_activities;
+
+			// The log10 of the activity coefficients of the solutes and the osmotic coefficient term
+			std::vector<ChemicalScalar> lgamma(num_species, ChemicalScalar(I.ddn.size()));
+			ChemicalScalar osmot = -2.0*A/(b*b*b) * (t - 2.0*log(t) - 1.0/t);
+
+			for(Index k = 0; k < params.size(); ++k)
+			{
+				const AqueousInteractionParam& param = params[k];
+				const Index i0 = iparams[k][0];
+				const Index i1 = iparams[k][1];
+				const ThermoScalar p = aqueousInteractionParamValue(param.a, T);
+				const double neutral = (z[i0] == 0.0 && z[i1] == 0.0) ? 0.5 : 1.0;
+				switch(param.type)
+				{
+				case TYPE_SIT_EPSILON:
+					lgamma[i0] += p*m[i1];
+					lgamma[i1] += p*m[i0];
+					osmot += neutral*p*m[i0]*m[i1];
+					break;
+				case TYPE_SIT_EPSILON_MU:
+					lgamma[i0] += p*I*m[i1];
+					lgamma[i1] += p*I*m[i0];
+					osmot += p*m[i0]*m[i1] + neutral*p*I*m[i0]*m[i1];
+					break;
+				default:
+					break;
+				}
+			}
+
+			for(Index i = 0; i < num_species; ++i)
+				if(i != iwater) ln_g[i] = ln10 * (lgamma[i] + z[i]*z[i]*F);
+
+			ln_a = ln_g + log(m);
+
+			// The activity of water, exp(-osum*cosmot/55.50837), with cosmot = 1 + ln(10)*osmot/osum
+			ln_a[iwater] = -(osum + ln10*osmot)/55.50837;
+			ln_g[iwater] = ln_a[iwater] - log(x[iwater]);
+		};
+
+		return model;
 	}
 };
 
@@ -433,6 +1232,16 @@ auto PhreeqcDatabase::masterSpecies() const -> std::set<std::string>
 	return pimpl->master_species;
 }
 
+auto PhreeqcDatabase::thermoModel(const std::vector<std::string>& species) const -> PhaseThermoModel
+{
+	return pimpl->thermoModel(species);
+}
+
+auto PhreeqcDatabase::aqueousChemicalModel(const AqueousMixture& mixture) const -> PhaseChemicalModel
+{
+	return pimpl->aqueousChemicalModel(mixture);
+}
+
 auto PhreeqcDatabase::cross(const Database& reference_database) -> Database
 {
     auto get_charge = [](std::string name) -> double
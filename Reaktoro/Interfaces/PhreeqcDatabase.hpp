@@ -21,13 +21,17 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Thermodynamics/Models/PhaseChemicalModel.hpp>
+#include <Reaktoro/Thermodynamics/Models/PhaseThermoModel.hpp>
 
 namespace Reaktoro {
 
 // Forward declarations
+class AqueousMixture;
 class Database;
 class Element;
 class AqueousSpecies;
@@ -61,8 +65,10 @@ public:
 
     auto numProductSpecies() const -> unsigned;
 
+    /// Return an element in the database, with its molar mass converted from g/mol to kg/mol.
     auto element(Index index) const -> Element;
 
+    /// Return the elements in the database, with their molar masses converted from g/mol to kg/mol.
     auto elements() const -> const std::vector<Element>&;
 
     auto aqueousSpecies(Index index) const -> AqueousSpecies;
@@ -91,6 +97,28 @@ public:
 
     auto masterSpecies() const -> std::set<std::string>;
 
+    /// Return the thermodynamic model of a phase with given species in the database.
+    /// The standard molar Gibbs energies of the species are calculated from the log K expressions
+    /// of the reactions in the database, in which the master species have zero standard molar Gibbs
+    /// energies. Their standard molar enthalpies and heat capacities, as well as all temperature
+    /// derivatives, are calculated from these expressions analytically. The standard molar volume
+    /// of water follows from the density of water in PHREEQC (see PhreeqcUtils::waterDensity).
+    /// @param species The names of the aqueous, gaseous, or mineral species in the phase
+    auto thermoModel(const std::vector<std::string>& species) const -> PhaseThermoModel;
+
+    /// Return the chemical model of an aqueous phase with species in the database.
+    /// The activity coefficients of the species are calculated as in the ion-association model of PHREEQC:
+    /// with the WATEQ Debye--Hückel equation for species with `-gamma` parameters in the database,
+    /// with the Davies equation for the other charged species, and with @f$\log_{10}\gamma=bI@f$
+    /// for neutral species. The activity of water is @f$1-0.017\sum m@f$, where the sum is over solutes.
+    /// The Debye--Hückel parameters are calculated from the density and dielectric constant of water
+    /// given by PhreeqcUtils::waterDensity and PhreeqcUtils::waterDielectricConstant, as in PHREEQC.
+    /// In databases with the Pitzer or SIT model, such as `pitzer.dat` and `sit.dat`, the activity
+    /// coefficients of the species and the activity of water are instead calculated with the
+    /// parameters of the model in the database, as in methods `pitzer` and `sit` of PHREEQC.
+    /// @param mixture The aqueous mixture with species in the database
+    auto aqueousChemicalModel(const AqueousMixture& mixture) const -> PhaseChemicalModel;
+
     /// Cross this PhreeqcDatabase instance with master thermodynamic data in another Database instance
     auto cross(const Database& master) -> Database;
 
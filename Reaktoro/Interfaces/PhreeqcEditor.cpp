@@ -25,7 +25,19 @@
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Element.hpp>
 #include <Reaktoro/Interfaces/Phreeqc.hpp>
+#include <Reaktoro/Interfaces/PhreeqcDatabase.hpp>
+#include <Reaktoro/Interfaces/PhreeqcUtils.hpp>
+#include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
+#include <Reaktoro/Thermodynamics/Mixtures/GaseousMixture.hpp>
+#include <Reaktoro/Thermodynamics/Mixtures/MineralMixture.hpp>
+#include <Reaktoro/Thermodynamics/Models/FluidChemicalModelIdeal.hpp>
+#include <Reaktoro/Thermodynamics/Phases/AqueousPhase.hpp>
+#include <Reaktoro/Thermodynamics/Phases/MineralPhase.hpp>
+#include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
+#include <Reaktoro/Thermodynamics/Species/GaseousSpecies.hpp>
+#include <Reaktoro/Thermodynamics/Species/MineralSpecies.hpp>
 
 namespace Reaktoro {
 
@@ -42,6 +54,90 @@ struct PhreeqcEditor::Impl
 
     // The names of the minerals used to set the pure mineral phases
     std::vector<std::string> minerals;
+
+    // The flag that indicates if the phases are evaluated natively, without the PHREEQC engine
+    bool native = false;
+
+    // Return the ChemicalSystem instance with phases evaluated natively from the database
+    auto nativeSystem() const -> ChemicalSystem
+    {
+        PhreeqcDatabase db(database);
+
+        // The elements in the aqueous species, including H and O, which PHREEQC always assumes
+        std::set<std::string> aqueous_elements(elements.begin(), elements.end());
+        aqueous_elements.insert({"H", "O"});
+
+        // The charge element, denoted by Z as in the Phreeqc class
+        Element charge;
+        charge.setName("Z");
+
+        // Return true if all elements in a species are in the aqueous phase
+        auto composed_by_aqueous_elements = [&](const Species& species)
+        {
+            for(auto pair : species.elements())
+                if(!aqueous_elements.count(pair.first.name()))
+                    return false;
+            return true;
+        };
+
+        // Collect the aqueous species as in a SOLUTION block, except the electron and exchange species
+        std::vector<AqueousSpecies> aqueous_species;
+        for(AqueousSpecies species : db.aqueousSpecies())
+        {
+            if(species.name() == "e-" || species.elements().empty()) continue;
+            if(!composed_by_aqueous_elements(species)) continue;
+            auto species_elements = species.elements();
+            if(species.charge() != 0.0)
+                species_elements[charge] = species.charge();
+            species.setElements(species_elements);
+            aqueous_species.push_back(species);
+        }
+
+        std::vector<GaseousSpecies> gaseous_species;
+        for(auto gas : gases)
+            gaseous_species.push_back(db.gaseousSpecies(gas));
+
+        // Return the names of the species in a mixture
+        auto names = [](const auto& mixture)
+        {
+            std::vector<std::string> res;
+            for(const auto& species : mixture.species())
+                res.push_back(species.name());
+            return res;
+        };
+
+        std::vector<Phase> phases;
+
+        // The density and dielectric constant of water are calculated with the same equations used in PHREEQC
+        AqueousMixture aqueous_mixture(aqueous_species);
+        aqueous_mixture.setWaterDensity(PhreeqcUtils::waterDensity);
+        aqueous_mixture.setWaterDielectricConstant(PhreeqcUtils::waterDielectricConstant);
+        AqueousPhase aqueous_phase(aqueous_mixture);
+        aqueous_phase.setThermoModel(db.thermoModel(names(aqueous_mixture)));
+        aqueous_phase.setChemicalModel(db.aqueousChemicalModel(aqueous_mixture));
+        phases.push_back(aqueous_phase);
+
+        if(gaseous_species.size())
+        {
+            // Create the gaseous phase without GaseousPhase, which needs critical properties for its default model
+            GaseousMixture gaseous_mixture(gaseous_species);
+            Phase gaseous_phase("Gaseous", PhaseType::Gas);
+            gaseous_phase.setSpecies({gaseous_species.begin(), gaseous_species.end()});
+            gaseous_phase.setThermoModel(db.thermoModel(names(gaseous_mixture)));
+            gaseous_phase.setChemicalModel(fluidChemicalModelIdeal(gaseous_mixture));
+            phases.push_back(gaseous_phase);
+        }
+
+        for(auto mineral : minerals)
+        {
+            MineralPhase mineral_phase(db.mineralSpecies(mineral));
+            mineral_phase.setName(mineral);
+            mineral_phase.setThermoModel(db.thermoModel({mineral}));
+            phases.push_back(mineral_phase);
+        }
+
+        return ChemicalSystem(phases);
+    }
 };
 
 PhreeqcEditor::PhreeqcEditor()
@@ -93,6 +189,11 @@ auto PhreeqcEditor::setMineralPhases(StringList minerals) -> void
     pimpl->minerals = minerals.strings();
 }
 
+auto PhreeqcEditor::setNativeModels(bool enabled) -> void
+{
+    pimpl->native = enabled;
+}
+
 PhreeqcEditor::operator ChemicalSystem() const
 {
     // Assert the database has been given
@@ -101,6 +202,9 @@ PhreeqcEditor::operator ChemicalSystem() const
         "No database was provided to PhreeqcEditor via its constructor or its "
         "method PhreeqcEditor::setDatabase.");
 
+    if(pimpl->native)
+        return pimpl->nativeSystem();
+
     Phreeqc phreeqc = *this;
     return phreeqc.system();
 }
@@ -64,6 +64,14 @@ public:
 	/// @param elements The names of the pure minerals either as a vector of strings or as space-separated string list.
 	auto setMineralPhases(StringList minerals) -> void;
 
+	/// Enable or disable the native models of the phases in the ChemicalSystem instance.
+	/// If enabled, the ChemicalSystem instance created from this editor evaluates the thermodynamic
+	/// and chemical models of its phases directly from the species, reactions, and activity coefficient
+	/// parameters in the database, without the PHREEQC engine (see PhreeqcDatabase::thermoModel and
+	/// PhreeqcDatabase::aqueousChemicalModel). Its phases are then thread-safe and have exact derivatives.
+	/// The gaseous and mineral phases are ideal. This is disabled by default.
+	auto setNativeModels(bool enabled) -> void;
+
 	/// Convert this PhreeqcEditor instance into a ChemicalSystem instance
 	operator ChemicalSystem() const;
 
@@ -164,14 +164,17 @@ auto isMineralSpecies(const PhreeqcPhase* phase) -> bool
 
 auto reactionEquation(const PhreeqcSpecies* species) -> std::map<std::string, double>
 {
+    // The reaction of the species in the current calculation, or in the database otherwise
+    const auto rxn = species->rxn_x ? species->rxn_x : species->rxn;
+
     // Check if there is any reaction defined by this species.
-    if(species->rxn_x == nullptr) return {};
+    if(rxn == nullptr) return {};
 
     // The reaction equation as pairs of names and stoichiometries
     std::map<std::string, double> pairs;
 
     // Iterate over all species in the reaction, get their names and stoichiometries.
-    for(auto iter = species->rxn_x->token; iter->s != nullptr; iter++)
+    for(auto iter = rxn->token; iter->s != nullptr; iter++)
         pairs.emplace(iter->s->name, -iter->coef);
 
     // Check if the reaction is a trivial reaction (e.g., H+ = H+)
@@ -184,8 +187,11 @@ auto reactionEquation(const PhreeqcSpecies* species) -> std::map<std::string, do
 
 auto reactionEquation(const PhreeqcPhase* phase) -> std::map<std::string, double>
 {
+    // The reaction of the phase in the current calculation, or in the database otherwise
+    const auto rxn = phase->rxn_x ? phase->rxn_x : phase->rxn;
+
     // Check if there is any reaction defined by this species.
-    if(phase->rxn_x == nullptr) return {};
+    if(rxn == nullptr) return {};
 
     // The reaction equation as pairs of names and stoichiometries
     std::map<std::string, double> pairs;
@@ -193,8 +199,8 @@ auto reactionEquation(const PhreeqcPhase* phase) -> std::map<std::string, double
     // Iterate over all species in the reaction, get their names and stoichiometries.
     // Note that the reaction equation for a Phreeqc phase is read differently from a
     // Phreeqc species instance.
-    pairs.emplace(phase->rxn_x->token->name, phase->rxn_x->token->coef);
-    for(auto iter = phase->rxn_x->token + 1; iter->s != nullptr; iter++)
+    pairs.emplace(rxn->token->name, rxn->token->coef);
+    for(auto iter = rxn->token + 1; iter->s != nullptr; iter++)
         pairs.emplace(iter->s->name, iter->coef);
 
     // Check if the reaction is a trivial reaction (e.g., X- = X-)
@@ -398,5 +404,77 @@ auto lnEquilibriumConstant(const PhreeqcPhase* phase, double T, double P) -> The
     return lnEquilibriumConstantHelper(phase, T, P);
 }
 
+/// Return the pressure used in the calculation of the properties of water (in units of atm),
+/// which is at least the saturation pressure of water, as in the PHREEQC method `Phreeqc::calc_rho_0`.
+auto waterPressureHelper(const ThermoScalar& TK, const ThermoScalar& Patm, ThermoScalar& Psat) -> ThermoScalar
+{
+    Psat = exp(11.6702 - 3816.44/(TK - 46.13));
+    return Patm.val < Psat.val ? Psat : Patm;
+}
+
+/// Return the temperature used in the calculation of the properties of water (in units of K),
+/// which is at most 350 C, the limit of the fitting range of the PHREEQC equations.
+auto waterTemperatureHelper(Temperature T) -> ThermoScalar
+{
+    const ThermoScalar TK = T;
+    return TK.val > 623.15 ? ThermoScalar(623.15) : TK;
+}
+
+auto waterDensity(Temperature T, Pressure P) -> ThermoScalar
+{
+    //--------------------------------------------------------------------------------
+    // The implementation of this method follows the PHREEQC method `Phreeqc::calc_rho_0`
+    //--------------------------------------------------------------------------------
+
+    // The temperature in units of K and celsius
+    const ThermoScalar TK = waterTemperatureHelper(T);
+    const ThermoScalar tc = TK - 273.15;
+
+    // The density of water along the saturation line, eq. 2.6 of Wagner and Pruss (2002), in units of kg/m3
+    const double Tc = 647.096;
+    const double b1 = 1.99274064, b2 = 1.09965342, b3 = -0.510839303,
+        b4 = -1.75493479, b5 = -45.5170352, b6 = -6.7469445e5;
+    const ThermoScalar th = 1.0 - TK/Tc;
+    const ThermoScalar rho_sat = 322.0 * (1.0 + b1*pow(th, 1.0/3.0) + b2*pow(th, 2.0/3.0) + b3*pow(th, 5.0/3.0) +
+        b4*pow(th, 16.0/3.0) + b5*pow(th, 43.0/3.0) + b6*pow(th, 110.0/3.0));
+
+    // The coefficients of the pressure correction of the density fitted in PHREEQC
+    const ThermoScalar p0 =  5.1880000E-02 + tc*(-4.1885519E-04 + tc*( 6.6780748E-06 + tc*(-3.6648699E-08 + tc* 8.3501912E-11)));
+    const ThermoScalar p1 = -6.0251348E-06 + tc*( 3.6696407E-07 + tc*(-9.2056269E-09 + tc*( 6.7024182E-11 + tc*-1.5947241E-13)));
+    const ThermoScalar p2 = -2.2983596E-09 + tc*(-4.0133819E-10 + tc*( 1.2619821E-11 + tc*(-9.8952363E-14 + tc* 2.3363281E-16)));
+    const ThermoScalar p3 =  7.0517647E-11 + tc*( 6.8566831E-12 + tc*(-2.2829750E-13 + tc*( 1.8113313E-15 + tc*-4.2475324E-18)));
+
+    // The pressure in excess of the saturation pressure of water (in units of atm)
+    ThermoScalar Psat;
+    const ThermoScalar Patm = waterPressureHelper(TK, P/101325.0, Psat);
+    const ThermoScalar pa = Patm - (Psat - 1e-6);
+
+    const ThermoScalar rho = rho_sat + pa*(p0 + pa*(p1 + pa*(p2 + sqrt(pa)*p3)));
+
+    return rho.val < 0.01 ? ThermoScalar(0.01) : rho;
+}
+
+auto waterDielectricConstant(Temperature T, Pressure P) -> ThermoScalar
+{
+    //--------------------------------------------------------------------------------
+    // The implementation of this method follows the PHREEQC method `Phreeqc::calc_dielectrics`
+    //--------------------------------------------------------------------------------
+
+    // The temperature (in units of K) and pressure (in units of bar)
+    const ThermoScalar TK = waterTemperatureHelper(T);
+    ThermoScalar Psat;
+    const ThermoScalar Pbar = waterPressureHelper(TK, P/101325.0, Psat) * 1.01325;
+
+    // The relative dielectric constant of water, from Bradley and Pitzer (1979)
+    const double u1 = 3.4279e2, u2 = -5.0866e-3, u3 = 9.469e-7, u4 = -2.0525,
+        u5 = 3.1159e3, u6 = -1.8289e2, u7 = -8.0325e3, u8 = 4.2142e6, u9 = 2.1417;
+    const ThermoScalar d1000 = u1 * exp(TK*(u2 + TK*u3));
+    const ThermoScalar c = u4 + u5/(u6 + TK);
+    const ThermoScalar b = u7 + u8/TK + u9*TK;
+    const ThermoScalar epsilon = d1000 + c*log((b + Pbar)/(b + 1e3));
+
+    return epsilon.val <= 0.0 ? ThermoScalar(10.0) : epsilon;
+}
+
 } // namespace PhreeqcUtils
 } // namespace Reaktoro
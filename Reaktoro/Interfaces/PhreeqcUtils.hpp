@@ -95,12 +95,16 @@ auto name(const PhreeqcPhase* phase) -> std::string;
 /// The equation is defined by a map of the names of the species
 /// defining the reaction and their stoichiometry coefficients.
 /// An empty equation is returned in case the given species is a primary species.
+/// The reaction used is the one written in terms of the master species of the
+/// current calculation, or the one in the database if there is no calculation yet.
 /// @param sspecies A pointer to a Phreeqc species (aqueous species)
 auto reactionEquation(const PhreeqcSpecies* species) -> std::map<std::string, double>;
 
 /// Return the reaction equation of a Phreeqc phase (gaseous or mineral species).
 /// The equation is defined by a map of the names of the species
 /// defining the reaction and their stoichiometry coefficients.
+/// The reaction used is the one written in terms of the master species of the
+/// current calculation, or the one in the database if there is no calculation yet.
 /// @param phase A pointer to a Phreeqc phase (gaseous or mineral species)
 auto reactionEquation(const PhreeqcPhase* phase) -> std::map<std::string, double>;
 
@@ -172,5 +176,20 @@ auto lnEquilibriumConstant(const PhreeqcSpecies* species, double T, double P) ->
 /// @param P The pressure (in units of Pa)
 auto lnEquilibriumConstant(const PhreeqcPhase* phase, double T, double P) -> ThermoScalar;
 
+/// Return the density of pure water (in units of kg/m3) as calculated in PHREEQC.
+/// This is the density along the saturation line of Wagner and Pruss (2002) with the
+/// pressure correction of PHREEQC, fitted for 0--300 C and pressures up to 1000 atm.
+/// Temperatures above 350 C are replaced by 350 C, as in PHREEQC.
+/// @param T The temperature (in units of K)
+/// @param P The pressure (in units of Pa)
+auto waterDensity(Temperature T, Pressure P) -> ThermoScalar;
+
+/// Return the relative dielectric constant of pure water as calculated in PHREEQC.
+/// This is the equation of Bradley and Pitzer (1979).
+/// Temperatures above 350 C are replaced by 350 C, as in PHREEQC.
+/// @param T The temperature (in units of K)
+/// @param P The pressure (in units of Pa)
+auto waterDielectricConstant(Temperature T, Pressure P) -> ThermoScalar;
+
 } // namespace PhreeqcUtils
 } // namespace Reaktoro
@@ -30,6 +30,27 @@ struct KineticOutputOptions
     std::string format;
 };
 
+/// A struct to describe the options for the chemical kinetics calculation of a batch of chemical states.
+struct BatchKineticOptions
+{
+    /// The number of threads used to integrate a batch of chemical states.
+    /// A value of zero uses as many threads as the number of hardware threads. The integrations
+    /// run on the persistent workers of ThreadPool::shared, and on the calling thread. Note
+    /// that multi-threaded batch calculations require the thermodynamic and chemical
+    /// models of the chemical system to be safe for concurrent evaluation.
+    unsigned threads = 1;
+
+    /// The boolean flag that indicates if the states of a batch should be integrated in order of decreasing cost.
+    /// The cost of a state is the number of steps taken in its last integration, so that the
+    /// stiffest states are integrated first and the threads finish at about the same time.
+    bool reorder = true;
+
+    /// The boolean flag that indicates if the integration of a state should start from its last step size.
+    /// The initial step size is then a fraction of the last step size taken for the state. Otherwise,
+    /// the initial step size is estimated by the ODE solver for every state and time step.
+    bool warmstart = true;
+};
+
 /// A struct to describe the options for a chemical kinetics calculation.
 /// @see KineticProblem, KineticSolver
 struct KineticOptions
@@ -42,6 +63,9 @@ struct KineticOptions
 
     /// The options for the output of the chemical kinetics calculation
     KineticOutputOptions output;
+
+    /// The options for the chemical kinetics calculation of a batch of chemical states.
+    BatchKineticOptions batch;
 };
 
 } // namespace Reaktoro
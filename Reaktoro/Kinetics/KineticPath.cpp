@@ -100,8 +100,9 @@ struct KineticPath::Impl
             t = solver.step(state, t, t1);
         }
 
-        // Update the output with the final state
+        // Update the output with the final state and write the output file
         if(output) output.update(state, t1);
+        if(output) output.close();
 
         // Update the plots with the final state
         for(auto& plot : plots) plot.update(state, t1);
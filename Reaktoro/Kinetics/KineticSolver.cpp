@@ -18,7 +18,10 @@
 #include "KineticSolver.hpp"
 
 // C++ includes
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <numeric>
 using namespace std::placeholders;
 
 // Reaktoro includes
@@ -26,6 +29,7 @@ using namespace std::placeholders;
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
@@ -59,9 +63,6 @@ struct KineticSolver::Impl
     /// The equilibrium solver instance
     EquilibriumSolver equilibrium;
 
-    /// The sensitivity of the equilibrium state
-    EquilibriumSensitivity sensitivity;
-
     /// The ODE solver instance
     ODESolver ode;
 
@@ -110,7 +111,7 @@ struct KineticSolver::Impl
     /// The combined vector of elemental molar abundance and composition of kinetic species [be nk]
     Vector benk;
 
-    /// The chemical properties of the system
+    /// The chemical properties of the system, used only if those of the equilibrium solver are not up to date
     ChemicalProperties properties;
 
     /// The vector with the values of the reaction rates
@@ -119,6 +120,10 @@ struct KineticSolver::Impl
     /// The partial derivatives of the reaction rates `r` w.r.t. to `be`, `ne`, `nk`, `and `u = [be nk]`
     Matrix drdbe, drdne, drdnk, drdu;
 
+    /// The Jacobian of the ODE function, used to assemble its sparse representation.
+    /// Its columns w.r.t. `be` are dense, as all equilibrium species depend on all of `be`.
+    Matrix dfdu;
+
     /// The source term
     ChemicalVector q;
 
@@ -128,6 +133,15 @@ struct KineticSolver::Impl
     /// The function that calculates the source term in the problem
     std::function<ChemicalVector(const ChemicalProperties&)> source_fn;
 
+    /// The chemical state currently integrated with this solver, at which the ODE problem is evaluated
+    ChemicalState* cell = nullptr;
+
+    /// The size of the last step taken in the integration of each chemical state of the last batch
+    std::vector<double> batch_steps;
+
+    /// The number of steps taken in the integration of each chemical state of the last batch
+    std::vector<unsigned> batch_costs;
+
     Impl()
     {}
 
@@ -295,29 +309,14 @@ struct KineticSolver::Impl
         benk.head(Ee) = Ae * ne;
         benk.tail(Nk) = nk;
 
-        // Define the ODE function
-        ODEFunction ode_function = [&](double t, VectorConstRef u, VectorRef res)
-        {
-            return function(state, t, u, res);
-        };
-
-        // Define the jacobian of the ODE function
-        ODEJacobian ode_jacobian = [&](double t, VectorConstRef u, MatrixRef res)
-        {
-            return jacobian(state, t, u, res);
-        };
-
-        // Initialise the ODE problem
-        ODEProblem problem;
-        problem.setNumEquations(Ee + Nk);
-        problem.setFunction(ode_function);
-        problem.setJacobian(ode_jacobian);
+        // The ODE problem is evaluated at the given chemical state
+        cell = &state;
 
         // Define the options for the ODE solver
         ODEOptions options_ode = options.ode;
 
         // Set the ODE problem and initialize the ODE solver
-        ode.setProblem(problem);
+        ode.setProblem(problem());
         ode.setOptions(options_ode);
         ode.initialize(tstart, benk);
 
@@ -378,6 +377,129 @@ struct KineticSolver::Impl
         equilibrium.solve(state, T, P, be);
     }
 
+    /// Initialize the ODE solver to integrate the chemical states of a batch, one at a time.
+    auto initializeBatch() -> void
+    {
+        // The ODE solver is fully initialized only for the first chemical state of the batch
+        ode.setProblem(problem());
+        ode.setOptions(options.ode);
+
+        equilibrium.setOptions(options.equilibrium);
+    }
+
+    /// Integrate a chemical state of a batch from `t` to `t + dt`, starting with a given step size.
+    auto solveBatchState(ChemicalState& state, double t, double dt, double hstart) -> void
+    {
+        cell = &state;
+
+        T = state.temperature();
+        P = state.pressure();
+
+        // Assemble the vector benk = [be nk]
+        const auto& n = state.speciesAmounts();
+        ne = n(ies);
+        nk = n(iks);
+
+        benk.resize(Ee + Nk);
+        benk.head(Ee) = Ae * ne;
+        benk.tail(Nk) = nk;
+
+        // Reinitialize the ODE solver, reusing its memory, and integrate from `t` to `t + dt`. The initial
+        // step is a fraction of the last one, since the integration restarts with a first order method
+        ode.reinitialize(t, benk, std::min(0.1*hstart, dt));
+
+        const double tfinal = t + dt;
+        while(t < tfinal)
+            ode.integrate(t, benk, tfinal);
+
+        // Extract the `be` and `nk` entries of the vector `benk`
+        be = benk.head(Ee);
+        nk = benk.tail(Nk);
+
+        // Update the composition of the kinetic and equilibrium species
+        state.setSpeciesAmounts(nk, iks);
+        equilibrium.solve(state, T, P, be);
+    }
+
+    /// Solve the chemical kinetics problems of a batch of chemical states
+    auto solve(std::vector<ChemicalState>& states, double t, double dt) -> void
+    {
+        const Index num_states = states.size();
+
+        // Discard the records of the last batch if it had a different number of states
+        if(batch_steps.size() != num_states)
+        {
+            batch_steps.assign(num_states, 0.0);
+            batch_costs.assign(num_states, 0);
+        }
+
+        // The order in which the states are integrated, the most costly ones first
+        Indices order(num_states);
+        std::iota(order.begin(), order.end(), 0);
+        if(options.batch.reorder)
+            std::stable_sort(order.begin(), order.end(),
+                [&](Index i, Index j) { return batch_costs[i] > batch_costs[j]; });
+
+        // The number of parallel tasks among which the states are dynamically distributed
+        const unsigned threads = numParallelTasks(options.batch.threads, num_states);
+
+        // The workspaces of the additional tasks, each with the same reactions, partition, options and sources
+        std::vector<std::unique_ptr<Impl>> workspaces;
+        for(unsigned ithread = 1; ithread < threads; ++ithread)
+        {
+            workspaces.emplace_back(new Impl(reactions));
+            workspaces.back()->setPartition(partition);
+            workspaces.back()->options = options;
+            workspaces.back()->source_fn = source_fn;
+        }
+
+        // The position in `order` of the next state to be integrated by any task
+        std::atomic<Index> next(0);
+
+        ThreadPool::shared().run(threads, [&](unsigned ithread)
+        {
+            Impl& impl = ithread ? *workspaces[ithread - 1] : *this;
+            impl.initializeBatch();
+            for(Index k = next++; k < num_states; k = next++)
+            {
+                const Index i = order[k];
+                const double hstart = options.batch.warmstart ? batch_steps[i] : 0.0;
+                impl.solveBatchState(states[i], t, dt, hstart);
+                batch_steps[i] = impl.ode.lastStep();
+                batch_costs[i] = impl.ode.numSteps();
+            }
+        });
+    }
+
+    /// Return the chemical properties of the system at the equilibrium state just calculated by the equilibrium solver.
+    auto equilibriumProperties(const ChemicalState& state) -> const ChemicalProperties&
+    {
+        // The chemical properties last evaluated by the equilibrium solver
+        const ChemicalProperties& eproperties = equilibrium.properties();
+
+        // Use these properties without recalculation if they were evaluated at the composition of the state
+        const auto& n = state.speciesAmounts();
+        const auto& neval = eproperties.composition().val;
+        if(neval.rows() == n.rows() && neval == n)
+            return eproperties;
+
+        // Otherwise, calculate the chemical properties of the system at the state
+        properties = state.properties();
+
+        return properties;
+    }
+
+    /// Return the ODE problem of the chemical kinetics, evaluated at the current chemical state `cell`.
+    auto problem() -> ODEProblem
+    {
+        ODEProblem problem;
+        problem.setNumEquations(Ee + Nk);
+        problem.setFunction([this](double t, VectorConstRef u, VectorRef res) { return function(*cell, t, u, res); });
+        problem.setJacobian([this](double t, VectorConstRef u, MatrixRef res) { return jacobian(*cell, t, u, res); });
+        problem.setSparseJacobian([this](double t, VectorConstRef u, ODESparseMatrix& res) { return sparseJacobian(*cell, t, u, res); });
+        return problem;
+    }
+
     auto function(ChemicalState& state, double t, VectorConstRef u, VectorRef res) -> int
     {
         // Extract the `be` and `nk` entries of the vector [be, nk]
@@ -407,11 +529,11 @@ struct KineticSolver::Impl
             "Could not calculate the rates of the species.",
             "The equilibrium calculation failed.");
 
-        // Update the chemical properties of the system
-        properties = state.properties();
+        // The chemical properties of the system, already evaluated by the equilibrium solver
+        const ChemicalProperties& properties = equilibriumProperties(state);
 
         // Calculate the kinetic rates of the reactions
-        r = reactions.rates(properties);
+        reactions.rates(properties, r);
 
         // Calculate the right-hand side function of the ODE
         res = A * r.val;
@@ -432,7 +554,7 @@ struct KineticSolver::Impl
     auto jacobian(ChemicalState& state, double t, VectorConstRef u, MatrixRef res) -> int
     {
         // Calculate the sensitivity of the equilibrium state
-        sensitivity = equilibrium.sensitivity();
+        const EquilibriumSensitivity& sensitivity = equilibrium.sensitivity();
 
         // Extract the columns of the kinetic rates derivatives w.r.t. the equilibrium and kinetic species
         drdne = cols(r.ddn, ies);
@@ -466,6 +588,16 @@ struct KineticSolver::Impl
 
         return 0;
     }
+
+    /// Calculate the Jacobian of the ODE function in sparse storage, used by the preconditioner of the KrylovSparseLU linear solver.
+    /// The Jacobian is assembled densely, since its columns w.r.t. `be` are dense.
+    auto sparseJacobian(ChemicalState& state, double t, VectorConstRef u, ODESparseMatrix& res) -> int
+    {
+        dfdu.resize(Ee + Nk, Ee + Nk);
+        const int result = jacobian(state, t, u, dfdu);
+        res = dfdu.sparseView();
+        return result;
+    }
 };
 
 KineticSolver::KineticSolver()
@@ -535,4 +667,9 @@ auto KineticSolver::solve(ChemicalState& state, double t, double dt) -> void
     pimpl->solve(state, t, dt);
 }
 
+auto KineticSolver::solve(std::vector<ChemicalState>& states, double t, double dt) -> void
+{
+    pimpl->solve(states, t, dt);
+}
+
 } // namespace Reaktoro
@@ -20,6 +20,7 @@
 // C++ includes
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Reaktoro {
 
@@ -110,6 +111,15 @@ public:
     /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
     auto solve(ChemicalState& state, double t, double dt) -> void;
 
+    /// Solve the chemical kinetics problems of a batch of chemical states from a given initial time to a final time.
+    /// The states, such as those of the cells of a reactive transport mesh, are integrated independently, with ODE
+    /// solvers that are reinitialized rather than recreated for each state, and distributed among threads as
+    /// specified in @ref BatchKineticOptions. The last step sizes and costs of the states are kept between calls.
+    /// @param states The kinetic states of the batch
+    /// @param t The start time of the integration (in units of seconds)
+    /// @param dt The step to be used for the integration from `t` to `t + dt` (in units of seconds)
+    auto solve(std::vector<ChemicalState>& states, double t, double dt) -> void;
+
 private:
     struct Impl;
 
@@ -17,9 +17,14 @@
 
 #include "ODE.hpp"
 
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/SparseLU>
+
 // Sundials includes
 #include <cvode/cvode.h>
+#include <cvode/cvode_band.h>
 #include <cvode/cvode_dense.h>
+#include <cvode/cvode_spgmr.h>
 #include <nvector/nvector_serial.h>
 
 // Reaktoro includes
@@ -29,6 +34,7 @@ namespace Reaktoro {
 
 #define VecEntry(v, i)    NV_Ith_S(v, i)
 #define MatEntry(A, i, j) DENSE_ELEM(A, i, j)
+#define BandEntry(A, i, j) BAND_ELEM(A, i, j)
 
 #define CheckInitialize(r) \
     Assert(r == CV_SUCCESS, \
@@ -49,16 +55,46 @@ inline int CVODEMaxStepOrder(const ODEOptions& options);
 int CVODEFunction(realtype t, N_Vector y, N_Vector ydot, void* user_data);
 int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
 
+int CVODEBandJacobian(long int N, long int mupper, long int mlower, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+
+int CVODESparsePrecSetup(realtype t, N_Vector y, N_Vector fy, booleantype jok, booleantype* jcurPtr, realtype gamma, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+
+int CVODESparsePrecSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp);
+
+int CVODESparseJacTimesVec(N_Vector v, N_Vector Jv, realtype t, N_Vector y, N_Vector fy, void* user_data, N_Vector tmp);
+
+int CVODEPrecSolve(realtype t, N_Vector y, N_Vector fy, N_Vector r, N_Vector z, realtype gamma, realtype delta, int lr, void* user_data, N_Vector tmp);
+
+/// Return a vector view of the data of a CVODE vector.
+inline auto VecView(N_Vector v, int size) -> Eigen::Map<Vector>
+{
+    return Eigen::Map<Vector>(NV_DATA_S(v), size);
+}
+
+/// The workspace for the sparse linear solver of ODESolver.
+struct ODESparseData
+{
+    /// The sparse Jacobian matrix of the right-hand side function
+    ODESparseMatrix J;
+
+    /// The sparse matrix `I - gamma*J`
+    ODESparseMatrix M;
+
+    /// The sparse LU factorization of the matrix `I - gamma*J`
+    Eigen::SparseLU<ODESparseMatrix> lu;
+};
+
 struct ODEData
 {
-    ODEData(const ODEProblem& problem, VectorRef y, VectorRef f, MatrixRef J)
-    : problem(problem), y(y), f(f), J(J), num_equations(problem.numEquations())
+    ODEData(const ODEProblem& problem, VectorRef y, VectorRef f, MatrixRef J, ODESparseData& sparse)
+    : problem(problem), y(y), f(f), J(J), sparse(sparse), num_equations(problem.numEquations())
     {}
 
     const ODEProblem& problem;
     VectorRef y;
     VectorRef f;
     MatrixRef J;
+    ODESparseData& sparse;
     int num_equations;
 };
 
@@ -72,6 +108,12 @@ struct ODEProblem::Impl
 
     /// The Jacobian of the right-hand side function of the system of ordinary differential equations
     ODEJacobian ode_jacobian;
+
+    /// The Jacobian of the right-hand side function of the system of ordinary differential equations in sparse storage
+    ODESparseJacobian ode_sparse_jacobian;
+
+    /// The preconditioner of the iterative linear solver of the system of ordinary differential equations
+    ODEPreconditioner ode_preconditioner;
 };
 
 struct ODESolver::Impl
@@ -97,6 +139,15 @@ struct ODESolver::Impl
     /// The auxiliary matrix J for the Jacobian evaluation
     Matrix J;
 
+    /// The auxiliary workspace for the sparse linear solver
+    ODESparseData sparse;
+
+    /// The user-defined data passed to the CVODE callback functions
+    std::unique_ptr<ODEData> data;
+
+    /// The flag that indicates if the CVODE context can be reinitialized without a full initialization
+    bool reusable = false;
+
     /// Construct a default ODESolver::Impl instance
     Impl()
     : cvode_mem(0), cvode_y(0)
@@ -127,9 +178,14 @@ struct ODESolver::Impl
         // The number of differential equations
         const int num_equations = problem.numEquations();
 
-        // Allocate memory for f and J
+        // Check if the Jacobian is evaluated as a dense matrix
+        const bool dense = options.linear_solver == ODELinearSolver::Dense ||
+            (options.linear_solver == ODELinearSolver::Banded && !problem.sparseJacobian());
+
+        // Allocate memory for y, f and J
+        this->y.resize(num_equations);
         f.resize(num_equations);
-        J.resize(num_equations, num_equations);
+        J.resize(dense ? num_equations : 0, dense ? num_equations : 0);
 
         // Free any dynamic memory allocated for cvode_mem context
         if(cvode_mem) CVodeFree(&cvode_mem);
@@ -156,6 +212,10 @@ struct ODESolver::Impl
         // Initialize the cvode context
         CheckInitialize(CVodeInit(cvode_mem, CVODEFunction, tstart, cvode_y));
 
+        // Set the user-defined data before attaching the linear solver, since CVSPGMR stores it for the preconditioner
+        data.reset(new ODEData(problem, this->y, f, J, sparse));
+        CheckInitialize(CVodeSetUserData(cvode_mem, data.get()));
+
         // Initialize the vector of absolute tolerances
         N_Vector abstols = N_VNew_Serial(num_equations);
 
@@ -180,45 +240,110 @@ struct ODESolver::Impl
         CheckInitialize(CVodeSetNonlinConvCoef(cvode_mem, options.nonlinear_convergence_coefficient));
         CheckInitialize(CVodeSVtolerances(cvode_mem, options.reltol, abstols));
 
-        // Call CVDense to specify the CVDENSE dense linear solver
-        CheckInitialize(CVDense(cvode_mem, num_equations));
-
-        // Set the Jacobian function
-        CheckInitialize(CVDlsSetDenseJacFn(cvode_mem, CVODEJacobian));
+        // Specify the linear solver of the Newton iterations
+        switch(options.linear_solver)
+        {
+        case ODELinearSolver::Banded:
+            // Call CVBand to specify the CVBAND banded linear solver
+            CheckInitialize(CVBand(cvode_mem, num_equations, options.upper_bandwidth, options.lower_bandwidth));
+
+            // Set the Jacobian function, otherwise a banded difference quotient approximation is used
+            if(problem.jacobian() || problem.sparseJacobian())
+                CheckInitialize(CVDlsSetBandJacFn(cvode_mem, CVODEBandJacobian));
+            break;
+
+        case ODELinearSolver::KrylovSparseLU:
+            // Check if the sparse Jacobian function has been provided
+            Assert(problem.sparseJacobian(),
+                "Cannot proceed with ODESolver::initialize to initialize the solver.",
+                "The KrylovSparseLU linear solver requires the sparse Jacobian function of the ODEProblem instance.");
+
+            // Call CVSpgmr to specify the CVSPGMR linear solver preconditioned with the sparse LU factorization
+            CheckInitialize(CVSpgmr(cvode_mem, PREC_LEFT, int(options.max_krylov_dimension)));
+            CheckInitialize(CVSpilsSetPreconditioner(cvode_mem, CVODESparsePrecSetup, CVODESparsePrecSolve));
+            CheckInitialize(CVSpilsSetJacTimesVecFn(cvode_mem, CVODESparseJacTimesVec));
+            break;
+
+        case ODELinearSolver::Krylov:
+            // Call CVSpgmr to specify the matrix-free CVSPGMR linear solver
+            CheckInitialize(CVSpgmr(cvode_mem, problem.preconditioner() ? PREC_LEFT : PREC_NONE, int(options.max_krylov_dimension)));
+
+            // Set the preconditioner function, if any
+            if(problem.preconditioner())
+                CheckInitialize(CVSpilsSetPreconditioner(cvode_mem, NULL, CVODEPrecSolve));
+            break;
+
+        default:
+            // Call CVDense to specify the CVDENSE dense linear solver
+            CheckInitialize(CVDense(cvode_mem, num_equations));
+
+            // Set the Jacobian function, otherwise a dense difference quotient approximation is used
+            if(problem.jacobian())
+                CheckInitialize(CVDlsSetDenseJacFn(cvode_mem, CVODEJacobian));
+        }
 
         // Free dynamic memory allocated for `yc`
         N_VDestroy_Serial(abstols);
+
+        // Allow subsequent reinitializations to reuse the cvode context
+        reusable = true;
+    }
+
+    /// Reinitializes the ODE solver reusing the memory of the cvode context
+    auto reinitialize(double tstart, VectorConstRef y, double hstart) -> void
+    {
+        // Perform a full initialization if the cvode context cannot be reused
+        if(!reusable || y.size() != this->y.size())
+        {
+            initialize(tstart, y);
+            if(hstart) CheckInitialize(CVodeSetInitStep(cvode_mem, hstart));
+            return;
+        }
+
+        // Transfer the initial values to cvode_y
+        for(int i = 0; i < y.size(); ++i)
+            VecEntry(cvode_y, i) = y[i];
+
+        // Set the initial step size, or restore the one in the options
+        CheckInitialize(CVodeSetInitStep(cvode_mem, hstart ? hstart : options.initial_step));
+
+        // Reinitialize the cvode context keeping its linear solver and parameters
+        CheckInitialize(CVodeReInit(cvode_mem, tstart, cvode_y));
+    }
+
+    /// Return the size of the last step taken by the ODE solver
+    auto lastStep() const -> double
+    {
+        double h = 0.0;
+        if(cvode_mem) CVodeGetLastStep(cvode_mem, &h);
+        return h;
+    }
+
+    /// Return the number of steps taken by the ODE solver
+    auto numSteps() const -> unsigned
+    {
+        long int nsteps = 0;
+        if(cvode_mem) CVodeGetNumSteps(cvode_mem, &nsteps);
+        return unsigned(nsteps);
     }
 
     /// Integrate the ODE performing a single step.
     auto integrate(double& t, VectorRef y) -> void
     {
-        // Initialize the ODE data
-        ODEData data(problem, y, f, J);
-
         // Define an infinite time.
         double tfinal = 10*(t + 1);
 
-        // Set the user-defined data to cvode_mem
-        CheckIntegration(CVodeSetUserData(cvode_mem, &data));
-
         // Solve the ode problem from `tstart` to `tfinal`
         CheckIntegration(CVode(cvode_mem, tfinal, cvode_y, &t, CV_ONE_STEP));
 
         // Transfer the result from cvode_y to y
-        for(int i = 0; i < data.num_equations; ++i)
+        for(int i = 0; i < data->num_equations; ++i)
             y[i] = VecEntry(cvode_y, i);
     }
 
     /// Integrate the ODE performing a single step not going over a given time.
     auto integrate(double& t, VectorRef y, double tfinal) -> void
     {
-        // Initialize the ODE data
-        ODEData data(problem, y, f, J);
-
-        // Set the user-defined data to cvode_mem
-        CheckIntegration(CVodeSetUserData(cvode_mem, &data));
-
         // Solve the ode problem from `tstart` to `tfinal`
         CheckIntegration(CVode(cvode_mem, tfinal, cvode_y, &t, CV_ONE_STEP));
 
@@ -233,7 +358,7 @@ struct ODESolver::Impl
         }
 
         // Transfer the result from cvode_y to y
-        for(int i = 0; i < data.num_equations; ++i)
+        for(int i = 0; i < data->num_equations; ++i)
             y[i] = VecEntry(this->cvode_y, i);
     }
 
@@ -243,17 +368,11 @@ struct ODESolver::Impl
         // Initialize the cvode context
         initialize(t, y);
 
-        // Initialize the ODE data
-        ODEData data(problem, y, f, J);
-
-        // Set the user-defined data to cvode_mem
-        CheckIntegration(CVodeSetUserData(cvode_mem, &data));
-
         // Solve the ode problem from `tstart` to `tfinal`
         CheckIntegration(CVode(cvode_mem, t + dt, cvode_y, &t, CV_NORMAL));
 
         // Transfer the result from cvode_y to y
-        for(int i = 0; i < data.num_equations; ++i)
+        for(int i = 0; i < data->num_equations; ++i)
             y[i] = VecEntry(this->cvode_y, i);
     }
 };
@@ -300,7 +419,7 @@ int CVODEFunction(realtype t, N_Vector y, N_Vector f, void* user_data)
     return result;
 }
 
-int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+int CVODEJacobian(long int, realtype t, N_Vector y, N_Vector, DlsMat J, void* user_data, N_Vector, N_Vector, N_Vector)
 {
     ODEData& data = *static_cast<ODEData*>(user_data);
 
@@ -316,6 +435,96 @@ int CVODEJacobian(long int N, realtype t, N_Vector y, N_Vector fy, DlsMat J, voi
     return result;
 }
 
+int CVODEBandJacobian(long int, long int mupper, long int mlower, realtype t, N_Vector y, N_Vector, DlsMat J, void* user_data, N_Vector, N_Vector, N_Vector)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    for(int i = 0; i < data.num_equations; ++i)
+        data.y[i] = VecEntry(y, i);
+
+    // Transfer the entries of the sparse Jacobian within the band
+    if(data.problem.sparseJacobian())
+    {
+        auto& Js = data.sparse.J;
+        int result = data.problem.sparseJacobian(t, data.y, Js);
+        for(int k = 0; k < Js.outerSize(); ++k)
+            for(ODESparseMatrix::InnerIterator it(Js, k); it; ++it)
+                if(it.row() - it.col() <= mlower && it.col() - it.row() <= mupper)
+                    BandEntry(J, it.row(), it.col()) = it.value();
+        return result;
+    }
+
+    // Transfer the entries of the dense Jacobian within the band
+    int result = data.problem.jacobian(t, data.y, data.J);
+
+    for(int j = 0; j < data.num_equations; ++j)
+        for(int i = std::max<int>(0, j - mupper); i <= std::min<int>(data.num_equations - 1, j + mlower); ++i)
+            BandEntry(J, i, j) = data.J(i, j);
+
+    return result;
+}
+
+int CVODESparsePrecSetup(realtype t, N_Vector y, N_Vector, booleantype jok, booleantype* jcurPtr, realtype gamma, void* user_data, N_Vector, N_Vector, N_Vector)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    auto& sparse = data.sparse;
+
+    // Evaluate the sparse Jacobian, unless CVODE indicates that the previous one can be reused
+    if(!jok || sparse.J.rows() != data.num_equations)
+    {
+        for(int i = 0; i < data.num_equations; ++i)
+            data.y[i] = VecEntry(y, i);
+
+        int result = data.problem.sparseJacobian(t, data.y, sparse.J);
+
+        if(result) return result;
+
+        *jcurPtr = true;
+    }
+    else *jcurPtr = false;
+
+    // Assemble and factorize the sparse matrix `I - gamma*J`
+    sparse.M.resize(data.num_equations, data.num_equations);
+    sparse.M.setIdentity();
+    sparse.M -= gamma * sparse.J;
+    sparse.lu.compute(sparse.M);
+
+    // Return a recoverable failure if the factorization failed, so that CVODE can reduce the step
+    return sparse.lu.info() == Eigen::Success ? 0 : 1;
+}
+
+int CVODESparsePrecSolve(realtype, N_Vector, N_Vector, N_Vector r, N_Vector z, realtype, realtype, int, void* user_data, N_Vector)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    VecView(z, data.num_equations) = data.sparse.lu.solve(VecView(r, data.num_equations));
+
+    return 0;
+}
+
+int CVODESparseJacTimesVec(N_Vector v, N_Vector Jv, realtype, N_Vector, N_Vector, void* user_data, N_Vector)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    // Use the sparse Jacobian of the last preconditioner setup, as the direct linear solvers of CVODE do
+    VecView(Jv, data.num_equations) = data.sparse.J * VecView(v, data.num_equations);
+
+    return 0;
+}
+
+int CVODEPrecSolve(realtype t, N_Vector y, N_Vector, N_Vector r, N_Vector z, realtype gamma, realtype, int, void* user_data, N_Vector)
+{
+    ODEData& data = *static_cast<ODEData*>(user_data);
+
+    for(int i = 0; i < data.num_equations; ++i)
+        data.y[i] = VecEntry(y, i);
+
+    auto zview = VecView(z, data.num_equations);
+
+    return data.problem.preconditioner(t, data.y, gamma, VecView(r, data.num_equations), zview);
+}
+
 ODEProblem::ODEProblem()
 : pimpl(new Impl())
 {}
@@ -348,6 +557,16 @@ auto ODEProblem::setJacobian(const ODEJacobian& J) -> void
     pimpl->ode_jacobian = J;
 }
 
+auto ODEProblem::setSparseJacobian(const ODESparseJacobian& J) -> void
+{
+    pimpl->ode_sparse_jacobian = J;
+}
+
+auto ODEProblem::setPreconditioner(const ODEPreconditioner& P) -> void
+{
+    pimpl->ode_preconditioner = P;
+}
+
 auto ODEProblem::initialized() const -> bool
 {
     return numEquations() && function();
@@ -368,6 +587,16 @@ auto ODEProblem::jacobian() const -> const ODEJacobian&
     return pimpl->ode_jacobian;
 }
 
+auto ODEProblem::sparseJacobian() const -> const ODESparseJacobian&
+{
+    return pimpl->ode_sparse_jacobian;
+}
+
+auto ODEProblem::preconditioner() const -> const ODEPreconditioner&
+{
+    return pimpl->ode_preconditioner;
+}
+
 auto ODEProblem::function(double t, VectorConstRef y, VectorRef f) const -> int
 {
     return function()(t, y, f);
@@ -378,6 +607,16 @@ auto ODEProblem::jacobian(double t, VectorConstRef y, MatrixRef J) const -> int
     return jacobian()(t, y, J);
 }
 
+auto ODEProblem::sparseJacobian(double t, VectorConstRef y, ODESparseMatrix& J) const -> int
+{
+    return sparseJacobian()(t, y, J);
+}
+
+auto ODEProblem::preconditioner(double t, VectorConstRef y, double gamma, VectorConstRef r, VectorRef z) const -> int
+{
+    return preconditioner()(t, y, gamma, r, z);
+}
+
 ODESolver::ODESolver()
 : pimpl(new Impl())
 {}
@@ -394,11 +633,13 @@ auto ODESolver::operator=(ODESolver other) -> ODESolver&
 auto ODESolver::setOptions(const ODEOptions& options) -> void
 {
     pimpl->options = options;
+    pimpl->reusable = false;
 }
 
 auto ODESolver::setProblem(const ODEProblem& problem) -> void
 {
     pimpl->problem = problem;
+    pimpl->reusable = false;
 }
 
 auto ODESolver::initialize(double tstart, VectorConstRef y) -> void
@@ -406,6 +647,21 @@ auto ODESolver::initialize(double tstart, VectorConstRef y) -> void
     pimpl->initialize(tstart, y);
 }
 
+auto ODESolver::reinitialize(double tstart, VectorConstRef y, double hstart) -> void
+{
+    pimpl->reinitialize(tstart, y, hstart);
+}
+
+auto ODESolver::lastStep() const -> double
+{
+    return pimpl->lastStep();
+}
+
+auto ODESolver::numSteps() const -> unsigned
+{
+    return pimpl->numSteps();
+}
+
 auto ODESolver::integrate(double& t, VectorRef y) -> void
 {
     pimpl->integrate(t, y);
@@ -21,23 +21,40 @@
 #include <functional>
 #include <memory>
 
+// Eigen includes
+#include <Reaktoro/deps/eigen3/Eigen/SparseCore>
+
 // Reaktoro includes
 #include <Reaktoro/Math/Matrix.hpp>
 
 namespace Reaktoro {
 
+/// The type used to represent sparse Jacobian matrices in ODESolver.
+using ODESparseMatrix = Eigen::SparseMatrix<double>;
+
 /// The function signature of the right-hand side function of a system of ordinary differential equations.
 using ODEFunction = std::function<int(double, VectorConstRef, VectorRef)>;
 
 /// The function signature of the Jacobian of the right-hand side function of a system of ordinary differential equations.
 using ODEJacobian = std::function<int(double, VectorConstRef, MatrixRef)>;
 
+/// The function signature of the Jacobian of the right-hand side function in sparse storage.
+using ODESparseJacobian = std::function<int(double, VectorConstRef, ODESparseMatrix&)>;
+
+/// The function signature of the preconditioner of the iterative linear solver of ODESolver.
+/// The function solves, approximately, the linear system `(I - gamma*J)*z = r` for `z`,
+/// where `J` is the Jacobian of the right-hand side function at `(t, y)`.
+using ODEPreconditioner = std::function<int(double t, VectorConstRef y, double gamma, VectorConstRef r, VectorRef z)>;
+
 /// The linear multistep method to be used in ODESolver.
 enum class ODEStepMode { Adams, BDF };
 
 /// The type of nonlinear solver iteration to be used in ODESolver.
 enum class ODEIterationMode { Functional, Newton };
 
+/// The linear solver to be used in the Newton iterations of ODESolver.
+enum class ODELinearSolver { Dense, Banded, KrylovSparseLU, Krylov };
+
 /// A struct that defines the options for the ODESolver.
 /// @see ODESolver, ODEProblem
 struct ODEOptions
@@ -48,6 +65,25 @@ struct ODEOptions
     /// The type of nonlinear solver iteration used in the integration.
     ODEIterationMode iteration = ODEIterationMode::Newton;
 
+    /// The linear solver used in the Newton iterations.
+    /// The `Dense` and `Banded` solvers use the Jacobian of the problem if given (the banded
+    /// solver also accepts the sparse one), or a finite difference approximation otherwise.
+    /// The `KrylovSparseLU` solver is an iterative one: it solves the linear systems with the GMRES
+    /// method, preconditioned with a sparse LU factorization of `I - gamma*J`, which requires the
+    /// sparse Jacobian of the problem.
+    /// The `Krylov` solver uses the matrix-free GMRES method with the preconditioner of the problem, if any.
+    ODELinearSolver linear_solver = ODELinearSolver::Dense;
+
+    /// The upper bandwidth of the Jacobian matrix, used with the banded linear solver.
+    unsigned upper_bandwidth = 0;
+
+    /// The lower bandwidth of the Jacobian matrix, used with the banded linear solver.
+    unsigned lower_bandwidth = 0;
+
+    /// The maximum dimension of the Krylov subspace, used with the sparse and Krylov linear solvers.
+    /// The default dimension of CVODE is used if its value is zero.
+    unsigned max_krylov_dimension = 0;
+
     /// The flag that enables the STAbility Limit Detection (STALD) algorithm.
     /// The STALD algorithm should be used when BDF method does not progress well,
     /// which can happen when the current BDF order is above 2. Using the STALD
@@ -131,6 +167,12 @@ public:
     /// Set the Jacobian of the right-hand side function of the system of ordinary differential equations
     auto setJacobian(const ODEJacobian& J) -> void;
 
+    /// Set the Jacobian of the right-hand side function of the system of ordinary differential equations in sparse storage
+    auto setSparseJacobian(const ODESparseJacobian& J) -> void;
+
+    /// Set the preconditioner of the iterative linear solver of the system of ordinary differential equations
+    auto setPreconditioner(const ODEPreconditioner& P) -> void;
+
     /// Return true if the problem has bee initialized.
     auto initialized() const -> bool;
 
@@ -143,6 +185,12 @@ public:
     /// Return the Jacobian of the right-hand side function of the system of ordinary differential equations
     auto jacobian() const -> const ODEJacobian&;
 
+    /// Return the Jacobian of the right-hand side function of the system of ordinary differential equations in sparse storage
+    auto sparseJacobian() const -> const ODESparseJacobian&;
+
+    /// Return the preconditioner of the iterative linear solver of the system of ordinary differential equations
+    auto preconditioner() const -> const ODEPreconditioner&;
+
     /// Evaluate the right-hand side function of the system of ordinary differential equations.
     /// @param t The time variable of the function
     /// @param y The y-variables of the function
@@ -157,6 +205,22 @@ public:
     /// @return Return 0 if successful, any other number otherwise.
     auto jacobian(double t, VectorConstRef y, MatrixRef J) const -> int;
 
+    /// Evaluate the Jacobian of the right-hand side function of the system of ordinary differential equations in sparse storage.
+    /// @param t The time variable of the function
+    /// @param y The y-variables of the function
+    /// @param[out] J The result of the Jacobian evaluation.
+    /// @return Return 0 if successful, any other number otherwise.
+    auto sparseJacobian(double t, VectorConstRef y, ODESparseMatrix& J) const -> int;
+
+    /// Apply the preconditioner of the iterative linear solver of the system of ordinary differential equations.
+    /// @param t The time variable of the function
+    /// @param y The y-variables of the function
+    /// @param gamma The scaling factor of the Jacobian in the matrix `I - gamma*J`
+    /// @param r The right-hand side vector of the preconditioned linear system
+    /// @param[out] z The solution of the preconditioned linear system.
+    /// @return Return 0 if successful, any other number otherwise.
+    auto preconditioner(double t, VectorConstRef y, double gamma, VectorConstRef r, VectorRef z) const -> int;
+
 private:
     struct Impl;
 
@@ -194,6 +258,20 @@ public:
     /// @param y The initial values of the variables
     auto initialize(double tstart, VectorConstRef y) -> void;
 
+    /// Reinitializes the ODE solver for new initial values, reusing its memory and linear solver.
+    /// The ODE solver is fully initialized instead if it has not been initialized yet, or if
+    /// its problem or options have changed since then.
+    /// @param tstart The start time of the integration.
+    /// @param y The initial values of the variables
+    /// @param hstart The initial step size (if zero, the initial step size in the options is used)
+    auto reinitialize(double tstart, VectorConstRef y, double hstart) -> void;
+
+    /// Return the size of the last step taken by the ODE solver.
+    auto lastStep() const -> double;
+
+    /// Return the number of steps taken by the ODE solver since its last (re)initialization.
+    auto numSteps() const -> unsigned;
+
     /// Integrate the ODE performing a single step.
     /// @param[in,out] t The current time of the integration as input, the new current time as output
     /// @param[in,out] y The current variables as input, the new current variables as output
@@ -61,8 +61,8 @@ struct KktSolverDense : KktSolverBase
 
 struct KktSolverRangespaceInverse : KktSolverBase
 {
-    /// The pointer to the left-hand side KKT matrix
-    const KktMatrix* lhs;
+    /// The vectors x and z used in the last decomposition
+    Vector x, z;
 
     /// The matrix `inv(G)` where `G = H + inv(X)*Z`
     Matrix invG;
@@ -112,8 +112,8 @@ struct KktSolverRangespaceDiagonal : KktSolverBase
 
 struct KktSolverNullspace : KktSolverBase
 {
-    /// The pointer to the left-hand side KKT matrix
-    const KktMatrix* lhs;
+    /// The vectors x and z used in the last decomposition
+    Vector x, z;
 
     /// The matrix `A` of the KKT problem
     Matrix A;
@@ -232,8 +232,9 @@ auto KktSolverDense<LUSolver>::solve(const KktVector& rhs, KktSolution& sol) ->
 
 auto KktSolverRangespaceInverse::decompose(const KktMatrix& lhs) -> void
 {
-    /// Update the pointer to the KKT matrix
-    this->lhs = &lhs;
+    /// Update x and z, which are used in `solve` while the decomposition is reused
+    x = lhs.x;
+    z = lhs.z;
 
     // Check if the Hessian matrix is in inverse more
     Assert(lhs.H.mode == Hessian::Inverse,
@@ -241,8 +242,6 @@ auto KktSolverRangespaceInverse::decompose(const KktMatrix& lhs) -> void
         "The Hessian matrix must be in Inverse mode.");
 
     // Auxiliary references to the KKT matrix components
-    const auto& x    = lhs.x;
-    const auto& z    = lhs.z;
     const auto& invH = lhs.H.inverse;
     const auto& A    = lhs.A;
 
@@ -264,8 +263,6 @@ auto KktSolverRangespaceInverse::solve(const KktVector& rhs, KktSolution& sol) -
     const auto& rx = rhs.rx;
     const auto& ry = rhs.ry;
     const auto& rz = rhs.rz;
-    const auto& x  = lhs->x;
-    const auto& z  = lhs->z;
     auto& dx = sol.dx;
     auto& dy = sol.dy;
     auto& dz = sol.dz;
@@ -412,8 +409,9 @@ auto KktSolverNullspace::initialize(MatrixConstRef newA) -> void
 
 auto KktSolverNullspace::decompose(const KktMatrix& lhs) -> void
 {
-    /// Update the pointer to the KKT matrix
-    this->lhs = &lhs;
+    /// Update x and z, which are used in `solve` while the decomposition is reused
+    x = lhs.x;
+    z = lhs.z;
 
     // Check if the Hessian matrix is dense
     Assert(lhs.H.mode == Hessian::Dense || lhs.H.mode == Hessian::Diagonal,
@@ -421,8 +419,6 @@ auto KktSolverNullspace::decompose(const KktMatrix& lhs) -> void
         "The Hessian matrix must be either in the Dense or Diagonal mode.");
 
     // Auxiliary references to the KKT matrix components
-    const auto& x = lhs.x;
-    const auto& z = lhs.z;
     const auto& H = lhs.H;
     const auto& A = lhs.A;
 
@@ -452,8 +448,6 @@ auto KktSolverNullspace::solve(const KktVector& rhs, KktSolution& sol) -> void
     const auto& rx = rhs.rx;
     const auto& ry = rhs.ry;
     const auto& rz = rhs.rz;
-    const auto& x  = lhs->x;
-    const auto& z  = lhs->z;
     auto& dx = sol.dx;
     auto& dy = sol.dy;
     auto& dz = sol.dz;
@@ -475,7 +469,7 @@ auto KktSolverNullspace::solve(const KktVector& rhs, KktSolution& sol) -> void
 
     // Compute both `x` and `y` variables
     dx = Z*xZ + Y*ry;
-    dy = Y.transpose() * (G*x - (rx + rz/x));
+    dy = Y.transpose() * (G*dx - (rx + rz/x));
     dz = (rz - z % dx)/x;
 }
 
@@ -69,6 +69,18 @@ struct OptimumParamsIpNewton
 
     /// The step mode for the Newton updates.
     StepMode step = Aggressive;
+
+    /// The maximum number of consecutive iterations in which the decomposition of the KKT matrix is reused.
+    /// Setting this to a value greater than zero enables a simplified Newton mode, in which the Hessian
+    /// and the KKT decomposition of a previous iteration are kept as long as the residual error decreases
+    /// fast enough, trading a few extra iterations for far fewer decompositions of the KKT matrix.
+    unsigned max_reuse = 0;
+
+    /// The reduction factor of the residual error required to keep reusing the decomposition of the KKT matrix.
+    /// The KKT matrix is decomposed again whenever a simplified Newton step does not reduce the residual
+    /// error below this factor times its previous value. A simplified Newton step that increases the
+    /// residual error is rejected and recomputed with a new decomposition.
+    double reuse_contraction = 0.5;
 };
 
 struct OptimumParamsIpActive
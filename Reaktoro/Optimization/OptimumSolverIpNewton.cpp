@@ -45,6 +45,10 @@ struct OptimumSolverIpNewton::Impl
     /// The trial iterate x
     Vector xtrial;
 
+    /// The iterates x, y, z and the objective state before a simplified Newton step
+    Vector xprev, yprev, zprev;
+    ObjectiveResult fprev;
+
     /// The outputter instance
     Outputter outputter;
 
@@ -101,6 +105,17 @@ struct OptimumSolverIpNewton::Impl
         // Define some auxiliary references to IpNewton parameters
         const auto mu = options.ipnewton.mu;
         const auto tau = options.ipnewton.tau;
+        const auto max_reuse = options.ipnewton.max_reuse;
+        const auto contraction = options.ipnewton.reuse_contraction;
+
+        // The number of consecutive iterations in which the current KKT decomposition has been reused
+        unsigned reused = 0;
+
+        // The flag that indicates if the last step contracted the residual error enough to reuse the KKT decomposition
+        bool contracting = false;
+
+        // The residual error before the current Newton step
+        double error_previous = 0.0;
 
         // Define some auxiliary references to result variables
         auto& error = result.error;
@@ -240,6 +255,34 @@ struct OptimumSolverIpNewton::Impl
         // The function that computes the Newton step
         auto compute_newton_step = [&]()
         {
+            // Store the residual error before the Newton step
+            error_previous = error;
+
+            // Check if the KKT decomposition of a previous iteration can be reused (simplified Newton)
+            if(contracting && reused < max_reuse)
+            {
+                // Save the current iterates in case the simplified Newton step is rejected
+                xprev = x;
+                yprev = y;
+                zprev = z;
+                fprev = f;
+
+                // Compute `dx`, `dy`, `dz` by solving the KKT equation with the previous decomposition
+                kkt.solve(rhs, sol);
+
+                // Update the time spent in linear systems
+                result.time_linear_systems += kkt.result().time_solve;
+
+                ++reused;
+
+                // Return true if the calculation succeeded, otherwise proceed with a new decomposition
+                if(kkt.result().succeeded)
+                    return true;
+            }
+
+            // The current decomposition is not reused
+            reused = 0;
+
             // Update the decomposition of the KKT matrix with update Hessian matrix
             kkt.decompose(lhs);
 
@@ -381,6 +424,31 @@ struct OptimumSolverIpNewton::Impl
             }
         };
 
+        // The function that checks if a simplified Newton step decreased the residual error
+        auto accept_simplified_step = [&]()
+        {
+            // Update the residuals at the new iterates
+            update_residuals();
+
+            // Accept the simplified Newton step if the residual error decreased
+            if(error < error_previous)
+                return true;
+
+            // Force a new KKT decomposition in the next iteration
+            contracting = false;
+
+            // Otherwise, restore the iterates before the simplified Newton step was taken
+            x = xprev;
+            y = yprev;
+            z = zprev;
+            f = fprev;
+
+            // Restore the residuals at the restored iterates
+            update_residuals();
+
+            return false;
+        };
+
         auto converged = [&]()
         {
             // Prevent successfull convergence if linear constraints have not converged yet
@@ -404,12 +472,23 @@ struct OptimumSolverIpNewton::Impl
                 break;
             if(failed(update_iterates()))
                 break;
+            if(reused && !accept_simplified_step())
+                continue;
             if((succeeded = converged()))
                 break;
             update_residuals();
+            contracting = error <= contraction * error_previous;
             output_state();
         }
 
+        // Decompose the KKT matrix at the final iterate if the last steps reused an older decomposition,
+        // since the sensitivity calculations in method dxdp rely on the last KKT decomposition
+        if(reused)
+        {
+            kkt.decompose(lhs);
+            result.time_linear_systems += kkt.result().time_decompose;
+        }
+
         // Output a final header
         outputter.outputHeader();
 
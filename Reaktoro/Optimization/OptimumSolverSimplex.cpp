@@ -77,16 +77,35 @@ inline void remove(const U& element, std::vector<T>& vec)
     std::remove(vec.begin(), vec.end(), element);
 }
 
+template<typename MatrixTypeA, typename MatrixTypeB>
+inline auto same(const MatrixTypeA& a, const MatrixTypeB& b) -> bool
+{
+    return a.rows() == b.rows() && a.cols() == b.cols() && a == b;
+}
+
 } // namespace
 
 struct OptimumSolverSimplex::Impl
 {
     Indices ibasic, ilower, iupper;
 
+    /// The LU decomposition of the basic columns of `A` at the last optimal solution
+    Eigen::PartialPivLU<Matrix> lu;
+
+    /// The linear programming problem of the last optimal solution (only `A`, `c`, `l`, `u` are used)
+    OptimumProblem last;
+
+    /// The boolean flag that indicates if the sets B, L, U and the LU decomposition correspond to the last optimal solution
+    bool optimal = false;
+
     auto feasible(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult;
 
     auto simplex(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult;
 
+    auto dual(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult;
+
+    auto reusable(const OptimumProblem& problem) const -> bool;
+
     auto solve(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult;
 };
 
@@ -450,11 +469,187 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
     return result;
 }
 
+auto OptimumSolverSimplex::Impl::dual(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult
+{
+    // Start timing the calculation
+    Time begin = time();
+
+    // The result of the calculation
+    OptimumResult result;
+
+    // Define some auxiliary references to problem variables
+    const auto& A = problem.A;
+    const auto& b = problem.b;
+    const auto& c = problem.c;
+    const auto& lower = problem.l;
+    const auto& upper = problem.u;
+    const unsigned m = A.rows();
+    const unsigned n = A.cols();
+
+    // Define some auxiliary references to state variables
+    auto& x = state.x;
+    auto& y = state.y;
+    auto& z = state.z;
+    auto& w = state.w;
+    auto& f = state.f;
+
+    // Define some auxiliary references to result variables
+    auto& iterations = result.iterations;
+
+    // Define auxiliary references to general options
+    const auto maxiters = options.max_iterations;
+
+    // Set the non-basic variables at their bounds
+    x.resize(n);
+    for(Index i : ilower) x[i] = lower[i];
+    for(Index i : iupper) x[i] = upper[i];
+
+    for(iterations = 1; iterations <= maxiters; ++iterations)
+    {
+        // Compute the basic variables from the non-basic ones
+        for(Index i : ibasic) x[i] = 0.0;
+        Vector xb = lu.solve(b - A * x);
+
+        // The tolerance for the violation of the bounds of the basic variables
+        const double tol = 1e-14 * std::max(norminf(xb), 1.0);
+
+        // Find the basic variable with the largest violation of its bounds
+        Index plocal = m;
+        bool tolower = true;
+        double violation = tol;
+        for(unsigned i = 0; i < m; ++i)
+        {
+            const Index p = ibasic[i];
+            if(lower[p] - xb[i] > violation) { violation = lower[p] - xb[i]; plocal = i; tolower = true; }
+            if(xb[i] - upper[p] > violation) { violation = xb[i] - upper[p]; plocal = i; tolower = false; }
+        }
+
+        Vector cB = rows(c, ibasic);
+
+        y = solveTranspose(lu, cB);
+
+        // Check if all basic variables are within their bounds, in which case the basis is optimal
+        if(plocal == m)
+        {
+            Matrix AL = cols(A, ilower);
+            Matrix AU = cols(A, iupper);
+
+            Vector cL = rows(c, ilower);
+            Vector cU = rows(c, iupper);
+
+            rows(x, ibasic) = xb;
+            z.setZero(n);
+            w.setZero(n);
+            rows(z, ilower) =  cL - AL.transpose() * y;
+            rows(w, iupper) = -cU + AU.transpose() * y;
+            result.succeeded = true;
+            break;
+        }
+
+        // Compute the reduced costs of all variables
+        const Vector d = c - tr(A) * y;
+
+        // Compute the row of the leaving basic variable in the simplex tableau
+        const Vector alpha = tr(A) * solveTranspose(lu, unit(m, plocal));
+
+        // The sign that makes the entering variable move the leaving one towards its violated bound
+        const double sign = tolower ? 1.0 : -1.0;
+
+        // Find the non-basic variable entering the basic set that preserves the dual feasibility (dual ratio test)
+        Index q = n;
+        Index qlocal = 0;
+        bool qlower = true;
+        double ratio = infinity();
+        for(unsigned k = 0; k < ilower.size(); ++k)
+        {
+            const Index j = ilower[k];
+            if(sign * alpha[j] >= 0.0) continue;
+            const double trial = d[j]/std::abs(alpha[j]);
+            if(trial < ratio) { ratio = trial; q = j; qlocal = k; qlower = true; }
+        }
+        for(unsigned k = 0; k < iupper.size(); ++k)
+        {
+            const Index j = iupper[k];
+            if(sign * alpha[j] <= 0.0) continue;
+            const double trial = -d[j]/std::abs(alpha[j]);
+            if(trial < ratio) { ratio = trial; q = j; qlocal = k; qlower = false; }
+        }
+
+        // Stop if no variable can enter the basic set, since the problem is then infeasible
+        if(q == n)
+            break;
+
+        // The index of the basic variable exiting the basic set
+        const Index p = ibasic[plocal];
+
+        // Update the sets B, L, U
+        if(qlower) erase(qlocal, ilower);  // L' = L - {q}
+        else erase(qlocal, iupper);        // U' = U - {q}
+        ibasic[plocal] = q;                // B' = B + {q} - {p}
+        if(tolower)
+        {
+            ilower.push_back(p);           // L' = L + {p}
+            x[p] = lower[p];               // set the p-th variable to its lower bound
+        }
+        else
+        {
+            iupper.push_back(p);           // U' = U + {p}
+            x[p] = upper[p];               // set the p-th variable to its upper bound
+        }
+
+        // Update the LU decomposition of the new basic columns
+        lu.compute(cols(A, ibasic));
+    }
+
+    // Set the state of the objective result
+    f.val = dot(c, x);
+    f.grad = c;
+
+    // Finish timing the calculation
+    result.time = elapsed(begin);
+
+    return result;
+}
+
+auto OptimumSolverSimplex::Impl::reusable(const OptimumProblem& problem) const -> bool
+{
+    // The last optimal basis remains dual feasible if only the right-hand side vector `b` has changed
+    return optimal &&
+        same(problem.A, last.A) &&
+        same(problem.c, last.c) &&
+        same(problem.l, last.l) &&
+        same(problem.u, last.u);
+}
+
 auto OptimumSolverSimplex::Impl::solve(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult
 {
+    OptimumResult result;
+
+    // Re-optimize from the last optimal basis with the dual simplex algorithm if possible
+    if(reusable(problem))
+    {
+        result = dual(problem, state, options);
+        if(result.succeeded)
+            return result;
+    }
+
+    optimal = false;
+
     // Solve the regularized optimization problem
-    auto result = feasible(problem, state, options);
+    result += feasible(problem, state, options);
     result += simplex(problem, state, options);
+
+    // Keep the optimal basis and its LU decomposition for subsequent calculations
+    if(result.succeeded)
+    {
+        optimal = true;
+        last.A = problem.A;
+        last.c = problem.c;
+        last.l = problem.l;
+        last.u = problem.u;
+        lu.compute(cols(problem.A, ibasic));
+    }
+
     return result;
 }
 
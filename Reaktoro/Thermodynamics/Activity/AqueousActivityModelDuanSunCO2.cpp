@@ -120,6 +120,10 @@ auto aqueousActivityModelDuanSunCO2(const AqueousMixture& mixture) -> AqueousAct
         const ThermoScalar lambda = paramDuanSun(T, P, lambda_coeffs);
         const ThermoScalar zeta   = paramDuanSun(T, P, zeta_coeffs);
 
+        // Ensure the molalities of absent ions have as many molar derivatives as the present ones
+        if(mNa.ddn.size() != ms.ddn.cols())
+            mNa = mK = mCa = mMg = mCl = mSO4 = ChemicalScalar(ms.ddn.cols());
+
         // The stoichiometric molalities of the specific ions and their molar derivatives
         if(iNa  < nions) mNa  = ms[iNa];
         if(iK   < nions) mK   = ms[iK];
@@ -57,6 +57,10 @@ auto aqueousActivityModelRumpfCO2(const AqueousMixture& mixture) -> AqueousActiv
         // The stoichiometric molalities of the ions in the aqueous mixture and their molar derivatives
         const ChemicalVector& ms = state.ms;
 
+        // Ensure the molalities of absent ions have as many molar derivatives as the present ones
+        if(mNa.ddn.size() != ms.ddn.cols())
+            mNa = mK = mCa = mMg = mCl = ChemicalScalar(ms.ddn.cols());
+
         // Extract the stoichiometric molalities of the specific ions and their molar derivatives
         if(iNa < nions) mNa = ms[iNa];
         if(iK  < nions) mK  = ms[iK];
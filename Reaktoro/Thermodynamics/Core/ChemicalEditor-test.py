@@ -204,3 +204,27 @@ def test_chemical_editor_create_system():
     assert species_name == expected
     
     
+
+def test_chemical_editor_cached_and_parallel_tables(tmpdir):
+    database = Database("supcrt98.xml")
+
+    def create_system(threads, cache):
+        editor = ChemicalEditor(database)
+        editor.addAqueousPhase("H2O(l) H+ OH- HCO3- CO2(aq) CO3--")
+        editor.addGaseousPhase("H2O(g) CO2(g)")
+        editor.addMineralPhase("Graphite")
+        editor.setThreads(threads)
+        editor.setCacheDirectory(cache)
+        return ChemicalSystem(editor)
+
+    def gibbs_energies(system):
+        properties = system.properties(350.0, 100.0e5)
+        return list(properties.standardPartialMolarGibbsEnergies().val)
+
+    expected = gibbs_energies(create_system(1, ""))
+
+    # The tables created in parallel and those written to and read from the cache are the same
+    assert gibbs_energies(create_system(4, "")) == expected
+    assert gibbs_energies(create_system(1, str(tmpdir))) == expected
+    assert len(tmpdir.listdir()) == 9
+    assert gibbs_energies(create_system(4, str(tmpdir))) == expected
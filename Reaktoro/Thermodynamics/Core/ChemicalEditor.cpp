@@ -18,14 +18,26 @@
 #include "ChemicalEditor.hpp"
 
 // C++ includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
 #include <set>
+#include <sstream>
 
 // Reaktoro includes
 #include <Reaktoro/Common/ElementUtils.hpp>
+#include <Reaktoro/Common/HashUtils.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/Phase.hpp>
@@ -55,6 +67,76 @@
 namespace Reaktoro {
 namespace {
 
+/// The standard Gibbs energies, enthalpies, volumes, and isobaric and isochoric heat
+/// capacities of a species at the temperature and pressure points of the interpolation.
+using SpeciesThermoTables = std::array<std::vector<ThermoScalar>, 5>;
+
+/// The signature at the beginning of a file in the cache of ChemicalEditor, which
+/// is changed whenever the format of the file or the cached tables change.
+const char thermo_tables_signature[8] = {'R', 'K', 'T', 'T', 'B', 'L', '0', '1'};
+
+/// Read the interpolation tables of a species from a file in the cache, returning false if not possible.
+auto readThermoTables(const std::string& filename, Index npoints, SpeciesThermoTables& tables) -> bool
+{
+    std::ifstream file(filename, std::ios::binary);
+
+    char signature[sizeof(thermo_tables_signature)];
+    std::uint64_t size = 0;
+    if(!file.read(signature, sizeof(signature)) || !file.read(reinterpret_cast<char*>(&size), sizeof(size)))
+        return false;
+    if(std::memcmp(signature, thermo_tables_signature, sizeof(signature)) != 0 || size != npoints)
+        return false;
+
+    std::vector<double> values(3 * npoints);
+    for(auto& table : tables)
+    {
+        if(!file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double)))
+            return false;
+        table.resize(npoints);
+        for(Index i = 0; i < npoints; ++i)
+            table[i] = ThermoScalar(values[3*i], values[3*i + 1], values[3*i + 2]);
+    }
+
+    return true;
+}
+
+/// Write the interpolation tables of a species to a file in the cache.
+/// The tables are written to a temporary file first, which is then renamed, so that
+/// other threads and processes never read a partially written file.
+auto writeThermoTables(const std::string& filename, const SpeciesThermoTables& tables) -> void
+{
+    std::random_device random;
+    const std::string tmpname = filename + "." + std::to_string(random()) + ".tmp";
+
+    {
+        std::ofstream file(tmpname, std::ios::binary);
+
+        const std::uint64_t size = tables[0].size();
+        file.write(thermo_tables_signature, sizeof(thermo_tables_signature));
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+
+        std::vector<double> values;
+        for(const auto& table : tables)
+        {
+            values.clear();
+            for(const ThermoScalar& scalar : table)
+                values.insert(values.end(), {scalar.val, scalar.ddT, scalar.ddP});
+            file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+        }
+
+        // The cache is only an optimization, so errors while writing it are ignored
+        if(!file.flush())
+        {
+            file.close();
+            std::remove(tmpname.c_str());
+            return;
+        }
+    }
+
+    if(std::rename(tmpname.c_str(), filename.c_str()) != 0)
+        std::remove(tmpname.c_str());
+}
+
 auto collectElementsInCompounds(const std::vector<std::string>& compounds) -> std::vector<std::string>
 {
     std::set<std::string> elemset;
@@ -78,7 +160,7 @@ auto lnActivityConstants(const AqueousPhase& phase) -> ThermoVectorFunction
     // Set the ln activity constant of water to zero
     ln_c[iH2O] = 0.0;
 
-    ThermoVectorFunction f = [=](Temperature T, Pressure P) mutable
+    ThermoVectorFunction f = [=](Temperature T, Pressure P)
     {
         return ln_c;
     };
@@ -88,11 +170,13 @@ auto lnActivityConstants(const AqueousPhase& phase) -> ThermoVectorFunction
 
 auto lnActivityConstants(const FluidPhase& phase) -> ThermoVectorFunction
 {
-    // The ln activity constants of the generic species
-    ThermoVector ln_c(phase.numSpecies());
+    // The number of generic species
+    const Index num_species = phase.numSpecies();
 
-    ThermoVectorFunction f = [=](Temperature T, Pressure P) mutable
+    ThermoVectorFunction f = [=](Temperature T, Pressure P)
     {
+        // The ln activity constants of the generic species
+        ThermoVector ln_c(num_species);
         ln_c = log(P * 1e-5); // ln(Pbar)
         return ln_c;
     };
@@ -105,7 +189,7 @@ auto lnActivityConstants(const MineralPhase& phase) -> ThermoVectorFunction
     // The ln activity constants of the mineral species
     ThermoVector ln_c(phase.numSpecies());
 
-    ThermoVectorFunction f = [=](Temperature T, Pressure P) mutable
+    ThermoVectorFunction f = [=](Temperature T, Pressure P)
     {
         return ln_c;
     };
@@ -145,6 +229,16 @@ private:
     /// The pressures for constructing interpolation tables of thermodynamic properties (in units of Pa).
     std::vector<double> pressures;
 
+    /// The number of threads used to create the interpolation tables (zero for as many as the hardware threads).
+    unsigned threads = 1;
+
+    /// The directory where the interpolation tables are cached (empty if they are not cached).
+    std::string cache_directory;
+
+    /// The flag that indicates if the thermodynamic properties are calculated with ThermoFun,
+    /// in which case the interpolation tables are neither cached nor created in parallel.
+    bool thermofun = false;
+
 public:
     Impl()
     : Impl(Database("supcrt98"))
@@ -153,7 +247,7 @@ public:
     }
 
     Impl(const ThermoFun::Database& db)
-    : thermo(db), database(db)
+    : thermo(db), database(db), thermofun(true)
     {
         setDefaultInterpolation();
     }
@@ -191,6 +285,16 @@ public:
             x = units::convert(x, units, "pascal");
     }
 
+    auto setThreads(unsigned value) -> void
+    {
+        threads = value;
+    }
+
+    auto setCacheDirectory(std::string directory) -> void
+    {
+        cache_directory = directory;
+    }
+
     auto initializePhasesWithElements(const std::vector<std::string>& elements) -> void
     {
         aqueous_phase = {};
@@ -427,38 +531,105 @@ public:
         return converted;
     }
 
-    template<typename Phase_>
-    auto convertPhase(const Phase_& phase) const -> Phase
+    /// Return the interpolation tables of a species, calculating the properties at each point only once.
+    auto createThermoTables(const std::string& species) const -> SpeciesThermoTables
     {
-        // The number of species in the phase
-        const unsigned nspecies = phase.numSpecies();
+        SpeciesThermoTables tables;
+        for(auto& table : tables)
+            table.reserve(temperatures.size() * pressures.size());
 
-        // Define the lambda functions for the calculation of the essential thermodynamic properties
+        // The temperature varies faster than pressure, as expected by BilinearInterpolator
+        for(double P : pressures)
+            for(double T : temperatures)
+            {
+                tables[0].push_back(thermo.standardPartialMolarGibbsEnergy(T, P, species));
+                tables[1].push_back(thermo.standardPartialMolarEnthalpy(T, P, species));
+                tables[2].push_back(thermo.standardPartialMolarVolume(T, P, species));
+                tables[3].push_back(thermo.standardPartialMolarHeatCapacityConstP(T, P, species));
+                tables[4].push_back(thermo.standardPartialMolarHeatCapacityConstV(T, P, species));
+            }
 
-        std::vector<ThermoScalarFunction> standard_gibbs_energy_fns(nspecies);
-        std::vector<ThermoScalarFunction> standard_enthalpy_fns(nspecies);
-        std::vector<ThermoScalarFunction> standard_volume_fns(nspecies);
-        std::vector<ThermoScalarFunction> standard_heat_capacity_cp_fns(nspecies);
-        std::vector<ThermoScalarFunction> standard_heat_capacity_cv_fns(nspecies);
+        return tables;
+    }
 
-        // Create the ThermoScalarFunction instances for each thermodynamic properties of each species
-        for(unsigned i = 0; i < nspecies; ++i)
+    /// Return the name of the file in the cache with the interpolation tables of a species.
+    /// The name is a hash of everything the tables depend on: the contents of the database,
+    /// the name of the species, and the temperatures and pressures of the interpolation.
+    auto cachedThermoTablesFilename(const std::string& species, std::uint64_t digest) const -> std::string
+    {
+        auto hash = hashBytes(thermo_tables_signature, sizeof(thermo_tables_signature));
+        hash = hashBytes(&digest, sizeof(digest), hash);
+        hash = hashBytes(species, hash);
+        hash = hashBytes(temperatures, hash);
+        hash = hashBytes(pressures, hash);
+
+        std::stringstream filename;
+        filename << cache_directory << "/" << std::hex << std::setw(16) << std::setfill('0') << hash << ".rkt";
+        return filename.str();
+    }
+
+    /// Return the interpolation tables of the species of all phases, in the order of the species in the phases.
+    /// The tables of different species are created in parallel and read from the cache when available.
+    auto createThermoTables(const std::vector<std::string>& species) const -> std::vector<SpeciesThermoTables>
+    {
+        const Index num_species = species.size();
+        const Index num_points = temperatures.size() * pressures.size();
+
+        std::vector<SpeciesThermoTables> tables(num_species);
+
+        const bool cached = !cache_directory.empty() && !thermofun;
+
+        // The hash of the database, computed only if the tables are cached
+        const std::uint64_t digest = cached ? database.digest() : 0;
+
+        auto create = [&](Index i)
         {
-            const std::string name = phase.species(i).name();
+            if(!cached)
+            {
+                tables[i] = createThermoTables(species[i]);
+                return;
+            }
+            const std::string filename = cachedThermoTablesFilename(species[i], digest);
+            if(readThermoTables(filename, num_points, tables[i]))
+                return;
+            tables[i] = createThermoTables(species[i]);
+            writeThermoTables(filename, tables[i]);
+        };
 
-            standard_gibbs_energy_fns[i]     = [=](double T, double P) { return thermo.standardPartialMolarGibbsEnergy(T, P, name); };
-            standard_enthalpy_fns[i]         = [=](double T, double P) { return thermo.standardPartialMolarEnthalpy(T, P, name); };
-            standard_volume_fns[i]           = [=](double T, double P) { return thermo.standardPartialMolarVolume(T, P, name); };
-            standard_heat_capacity_cp_fns[i] = [=](double T, double P) { return thermo.standardPartialMolarHeatCapacityConstP(T, P, name); };
-            standard_heat_capacity_cv_fns[i] = [=](double T, double P) { return thermo.standardPartialMolarHeatCapacityConstV(T, P, name); };
-        }
+        // The number of parallel tasks among which the species are distributed
+        const unsigned ntasks = thermofun ? 1 : numParallelTasks(threads, num_species);
+
+        // The index of the next species whose tables are created by the first available task,
+        // since the cost of the tables differs among species (e.g., aqueous species versus minerals)
+        std::atomic<Index> next(0);
+
+        ThreadPool::shared().run(ntasks, [&](unsigned)
+        {
+            for(Index i = next++; i < num_species; i = next++)
+                create(i);
+        });
+
+        return tables;
+    }
+
+    template<typename Phase_>
+    auto convertPhase(const Phase_& phase, const SpeciesThermoTables* tables) const -> Phase
+    {
+        // The number of species in the phase
+        const unsigned nspecies = phase.numSpecies();
+
+        // The tables of each thermodynamic property of all species in the phase
+        std::array<std::vector<std::vector<ThermoScalar>>, 5> properties;
+        for(unsigned k = 0; k < properties.size(); ++k)
+            for(unsigned i = 0; i < nspecies; ++i)
+                properties[k].push_back(tables[i][k]);
 
         // Create the interpolation functions for thermodynamic properties of the species
-        ThermoVectorFunction standard_gibbs_energies_interp     = interpolate(temperatures, pressures, standard_gibbs_energy_fns);
-        ThermoVectorFunction standard_enthalpies_interp         = interpolate(temperatures, pressures, standard_enthalpy_fns);
-        ThermoVectorFunction standard_volumes_interp            = interpolate(temperatures, pressures, standard_volume_fns);
-        ThermoVectorFunction standard_heat_capacities_cp_interp = interpolate(temperatures, pressures, standard_heat_capacity_cp_fns);
-        ThermoVectorFunction standard_heat_capacities_cv_interp = interpolate(temperatures, pressures, standard_heat_capacity_cv_fns);
+        ThermoVectorFunction standard_gibbs_energies_interp     = interpolate(temperatures, pressures, properties[0]);
+        ThermoVectorFunction standard_enthalpies_interp         = interpolate(temperatures, pressures, properties[1]);
+        ThermoVectorFunction standard_volumes_interp            = interpolate(temperatures, pressures, properties[2]);
+        ThermoVectorFunction standard_heat_capacities_cp_interp = interpolate(temperatures, pressures, properties[3]);
+        ThermoVectorFunction standard_heat_capacities_cv_interp = interpolate(temperatures, pressures, properties[4]);
         ThermoVectorFunction ln_activity_constants_func         = lnActivityConstants(phase);
 
         // Define the thermodynamic model function of the species
@@ -484,21 +655,47 @@ public:
 
     auto createChemicalSystem() const -> ChemicalSystem
     {
+        // The names of the species in all phases, in the order the phases are created below
+        std::vector<std::string> species;
+        auto collect = [&](const Phase& phase)
+        {
+            for(const Species& entry : phase.species())
+                species.push_back(entry.name());
+        };
+
+        collect(aqueous_phase);
+        collect(gaseous_phase);
+        collect(liquid_phase);
+        for(const MineralPhase& mineral_phase : mineral_phases)
+            collect(mineral_phase);
+
+        // The interpolation tables of all species, which are the expensive part of creating the phases
+        const std::vector<SpeciesThermoTables> tables = createThermoTables(species);
+
+        // The interpolation tables of the species in the next phase to be converted
+        const SpeciesThermoTables* next = tables.data();
+
         std::vector<Phase> phases;
         const auto number_of_fluid_phases = 3;
         phases.reserve(number_of_fluid_phases + mineral_phases.size());
 
         if(aqueous_phase.numSpecies())
-            phases.push_back(convertPhase(aqueous_phase));
+            phases.push_back(convertPhase(aqueous_phase, next));
+        next += aqueous_phase.numSpecies();
 
         if(gaseous_phase.numSpecies())
-            phases.push_back(convertPhase(gaseous_phase));
+            phases.push_back(convertPhase(gaseous_phase, next));
+        next += gaseous_phase.numSpecies();
 
         if(liquid_phase.numSpecies())
-            phases.push_back(convertPhase(liquid_phase));
+            phases.push_back(convertPhase(liquid_phase, next));
+        next += liquid_phase.numSpecies();
 
         for(const MineralPhase& mineral_phase : mineral_phases)
-            phases.push_back(convertPhase(mineral_phase));
+        {
+            phases.push_back(convertPhase(mineral_phase, next));
+            next += mineral_phase.numSpecies();
+        }
 
         return ChemicalSystem(phases);
     }
@@ -550,6 +747,16 @@ auto ChemicalEditor::setPressures(std::vector<double> values, std::string units)
     pimpl->setPressures(values, units);
 }
 
+auto ChemicalEditor::setThreads(unsigned threads) -> void
+{
+    pimpl->setThreads(threads);
+}
+
+auto ChemicalEditor::setCacheDirectory(std::string directory) -> void
+{
+    pimpl->setCacheDirectory(directory);
+}
+
 auto ChemicalEditor::initializePhasesWithElements(const StringList& elements) -> void
 {
 	pimpl->initializePhasesWithElements(elements);
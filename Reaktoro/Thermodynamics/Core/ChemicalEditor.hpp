@@ -116,6 +116,22 @@ public:
     /// @param units The units of the pressure values
     auto setPressures(std::vector<double> values, std::string units) -> void;
 
+    /// Set the number of threads used to create the interpolation tables of thermodynamic properties.
+    /// The tables of different species are created in parallel when the chemical system is created.
+    /// A value of zero uses as many threads as the number of hardware threads. The tables are
+    /// always created in a single thread when the editor uses a ThermoFun database.
+    /// @param threads The number of threads (default: 1)
+    auto setThreads(unsigned threads) -> void;
+
+    /// Set the directory where the interpolation tables of thermodynamic properties are cached.
+    /// The tables of each species are stored in a file named after a hash of the contents of
+    /// the database, the name of the species, and the interpolation temperatures and pressures.
+    /// Creating a chemical system with species whose tables are in the cache is then much faster.
+    /// The directory must exist, and it can be shared among programs running at the same time.
+    /// The cache is not used when the editor uses a ThermoFun database.
+    /// @param directory The cache directory (an empty string disables the cache, the default)
+    auto setCacheDirectory(std::string directory) -> void;
+
     /// Initialize all possible phases that can exist with given elements.
     /// @param elements The element symbols of interest.
     auto initializePhasesWithElements(const StringList& elements) -> void;
@@ -24,6 +24,7 @@ from pathlib import Path
 import locale
 import os
 import pytest
+import struct
 import sys
 
 
@@ -168,6 +169,31 @@ def test_adding_and_getting_database_elements():
     assert elements[3].molarMass() == pytest.approx(32.065e-3)
 
 
+def test_database_digest_changes_with_contents():
+    database = Database(str(get_test_data_dir() / "supcrt98_simplified.xml"))
+    no_species_database = Database(str(get_test_data_dir() / "supcrt98_no_species.xml"))
+
+    digest = database.digest()
+    assert database.digest() == digest
+
+    # The digest is calculated again after an element is added
+    new_element = Element()
+    new_element.setName("He")
+    new_element.setMolarMass(4.002602e-3)
+    database.addElement(new_element)
+    assert database.digest() != digest
+
+    # The digest is calculated again after a species is added, and it is the same
+    # as the digest of another database with the same elements and species
+    no_species_digest = no_species_database.digest()
+    no_species_database.addAqueousSpecies(database.aqueousSpecies()[0])
+    assert no_species_database.digest() != no_species_digest
+
+    other_database = Database(str(get_test_data_dir() / "supcrt98_no_species.xml"))
+    other_database.addAqueousSpecies(database.aqueousSpecies()[0])
+    assert other_database.digest() == no_species_database.digest()
+
+
 def test_database_parse():
     """
     Test the fact that species should be added as
@@ -242,3 +268,65 @@ def test_database_looking_for_species_with_element():
     assert liquid_species_with_H_or_Fe[0].name() == "H2S(liq)"
     assert mineral_species_with_H_or_Fe[0].name() == "Pyrrhotite"
 
+
+def test_database_save_and_load_binary(tmpdir):
+    database = Database(str(get_test_data_dir() / "supcrt98_simplified.xml"))
+
+    filename = str(tmpdir / "supcrt98_simplified.rdb")
+    database.save(filename)
+
+    binary = Database(filename)
+
+    assert [e.name() for e in binary.elements()] == [e.name() for e in database.elements()]
+    assert [s.name() for s in binary.aqueousSpecies()] == [s.name() for s in database.aqueousSpecies()]
+    assert [s.name() for s in binary.gaseousSpecies()] == [s.name() for s in database.gaseousSpecies()]
+    assert [s.name() for s in binary.liquidSpecies()] == [s.name() for s in database.liquidSpecies()]
+    assert [s.name() for s in binary.mineralSpecies()] == [s.name() for s in database.mineralSpecies()]
+
+    assert binary.containsAqueousSpecies("H2S(aq)")
+    assert not binary.containsAqueousSpecies("H2S(g)")
+    assert binary.mineralSpeciesWithElements(["Fe", "S"])[0].name() == "Pyrrhotite"
+    assert binary.aqueousSpecies("H2S(aq)").charge() == database.aqueousSpecies("H2S(aq)").charge()
+    assert binary.gaseousSpecies("H2S(g)").molarMass() == pytest.approx(database.gaseousSpecies("H2S(g)").molarMass())
+
+
+def test_database_load_corrupted_binary(tmpdir):
+    database = Database(str(get_test_data_dir() / "supcrt98_simplified.xml"))
+
+    filename = tmpdir / "supcrt98_simplified.rdb"
+    database.save(str(filename))
+    data = filename.read_binary()
+
+    # The offsets of the tables in the header, after the 64 bytes of signature, counts and species types
+    species_offset = struct.unpack_from("<Q", data, 72)[0]
+    num_values = struct.unpack_from("<Q", data, 32)[0]
+
+    def load(contents):
+        corrupted = tmpdir / "corrupted.rdb"
+        corrupted.write_binary(bytes(contents))
+        binary = Database(str(corrupted))
+        return [binary.aqueousSpecies(s.name()) for s in database.aqueousSpecies()]
+
+    def patched(offset, fmt, value):
+        contents = bytearray(data)
+        struct.pack_into(fmt, contents, offset, value)
+        return contents
+
+    for size in [len(data) // 10, len(data) // 2, len(data) - 1]:
+        with pytest.raises(RuntimeError):
+            load(data[:size])
+
+    corruptions = [
+        patched(species_offset, "<I", 0xFFFFFFF0),           # name of the first species
+        patched(species_offset + 8, "<I", 0xFFFFFFF0),       # first term of its elements
+        patched(species_offset + 12, "<I", 0x7FFFFFFF),      # number of its elements
+        patched(species_offset + 40, "<Q", 1 << 40),         # offset of its values
+        patched(species_offset + 40, "<Q", num_values - 1),  # values that run past the values table
+        data[:-1] + b"x",                                    # unterminated string table
+    ]
+
+    for contents in corruptions:
+        with pytest.raises(RuntimeError):
+            load(contents)
+
+    assert len(load(data)) == len(database.aqueousSpecies())
@@ -20,6 +20,8 @@
 // C++ includes
 #include <clocale>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -28,11 +30,13 @@
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/GlobalOptions.hpp>
+#include <Reaktoro/Common/HashUtils.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/Element.hpp>
 #include <Reaktoro/Core/Species.hpp>
+#include <Reaktoro/Thermodynamics/Databases/BinaryDatabase.hpp>
 #include <Reaktoro/Thermodynamics/Databases/DatabaseUtils.hpp>
 #include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
 #include <Reaktoro/Thermodynamics/Species/GaseousSpecies.hpp>
@@ -70,12 +74,11 @@ auto errorNonExistentSpecies(std::string type, std::string name) -> void
 auto parseDissociation(std::string dissociation) -> std::map<std::string, double>
 {
     std::map<std::string, double> equation;
-    auto words = split(dissociation, " ");
-    for(const auto& word : words)
+    splitEach(dissociation, " ", [&](std::string_view word)
     {
-        auto pair = split(word, ":");
-        equation.emplace(pair[1], tofloat(pair[0]));
-    }
+        const auto pos = word.find(':');
+        equation.emplace(word.substr(pos + 1), tofloat(word.substr(0, pos)));
+    });
     return equation;
 }
 
@@ -408,17 +411,26 @@ struct Database::Impl
     /// The set of all elements in the database
     ElementMap element_map;
 
-    /// The set of all aqueous species in the database
-    AqueousSpeciesMap aqueous_species_map;
+    /// The set of all aqueous species in the database (or those loaded so far from a binary database)
+    mutable AqueousSpeciesMap aqueous_species_map;
+
+    /// The set of all gaseous species in the database (or those loaded so far from a binary database)
+    mutable GaseousSpeciesMap gaseous_species_map;
+
+    /// The set of all liquid species in the database (or those loaded so far from a binary database)
+    mutable LiquidSpeciesMap liquid_species_map;
 
-    /// The set of all gaseous species in the database
-    GaseousSpeciesMap gaseous_species_map;
+    /// The set of all mineral species in the database (or those loaded so far from a binary database)
+    mutable MineralSpeciesMap mineral_species_map;
 
-    /// The set of all liquid species in the database
-    LiquidSpeciesMap liquid_species_map;
+    /// The binary database from which species are loaded when first requested (if any)
+    std::shared_ptr<BinaryDatabase> binary;
 
-    /// The set of all mineral species in the database
-    MineralSpeciesMap mineral_species_map;
+    /// The mutex that protects the maps of species while species are loaded from the binary database
+    mutable std::mutex mutex;
+
+    /// The digest of the database, calculated when first requested and reset whenever the database changes
+    mutable std::optional<std::uint64_t> digest_value;
 
     /// ThermoFun database
     ThermoFun::Database fundb;
@@ -427,6 +439,15 @@ struct Database::Impl
 
     Impl(std::string filename)
     {
+        // Map a database file in binary format, whose species are only loaded when requested
+        if(BinaryDatabase::isBinaryDatabase(filename))
+        {
+            binary = std::make_shared<BinaryDatabase>(filename);
+            for(const Element& element : binary->elements())
+                element_map[element.name()] = element;
+            return;
+        }
+
         const auto guard = ChangeLocale("C");
 
         // Create the XML document
@@ -571,7 +592,7 @@ struct Database::Impl
 // ThermoFun Integration END
 
     template<typename Key, typename Value>
-    auto collectValues(const std::map<Key, Value>& map) -> std::vector<Value>
+    auto collectValues(const std::map<Key, Value>& map) const -> std::vector<Value>
     {
         std::vector<Value> species;
         species.reserve(map.size());
@@ -580,28 +601,90 @@ struct Database::Impl
         return species;
     }
 
+    /// Load species of a given type from the binary database, unless they were already loaded.
+    auto load(BinaryDatabase::SpeciesType type, const std::vector<std::string>& names) const -> void
+    {
+        for(const auto& name : names)
+        {
+            switch(type)
+            {
+            case BinaryDatabase::Aqueous:
+                if(!aqueous_species_map.count(name))
+                    aqueous_species_map.emplace(name, binary->aqueousSpecies(name));
+                break;
+            case BinaryDatabase::Gaseous:
+                if(!gaseous_species_map.count(name))
+                    gaseous_species_map.emplace(name, binary->fluidSpecies(type, name));
+                break;
+            case BinaryDatabase::Liquid:
+                if(!liquid_species_map.count(name))
+                    liquid_species_map.emplace(name, binary->fluidSpecies(type, name));
+                break;
+            case BinaryDatabase::Mineral:
+                if(!mineral_species_map.count(name))
+                    mineral_species_map.emplace(name, binary->mineralSpecies(name));
+                break;
+            }
+        }
+    }
+
+    /// Load a species of a given type from the binary database, if it is there.
+    auto load(BinaryDatabase::SpeciesType type, const std::string& name) const -> void
+    {
+        if(binary && binary->contains(type, name))
+            load(type, std::vector<std::string>{name});
+    }
+
+    /// Load all species of a given type from the binary database.
+    auto loadAll(BinaryDatabase::SpeciesType type) const -> void
+    {
+        if(binary)
+            load(type, binary->speciesNames(type));
+    }
+
+    /// Load the species of a given type from the binary database that contain only the given elements.
+    auto loadWithElements(BinaryDatabase::SpeciesType type, const std::vector<std::string>& elements) const -> void
+    {
+        if(binary)
+            load(type, binary->speciesNamesWithElements(type, elements));
+    }
+
     auto addElement(const Element& element) -> void
     {
+        std::lock_guard<std::mutex> lock(mutex);
         element_map.insert({element.name(), element});
+        digest_value.reset();
     }
 
     auto addAqueousSpecies(const AqueousSpecies& species) -> void
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Aqueous, species.name());
+        digest_value.reset();
         aqueous_species_map.insert({species.name(), species});
     }
 
     auto addGaseousSpecies(const GaseousSpecies& species) -> void
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Gaseous, species.name());
+        digest_value.reset();
         gaseous_species_map.insert({ species.name(), species });
     }
 
     auto addLiquidSpecies(const LiquidSpecies& species) -> void
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Liquid, species.name());
+        digest_value.reset();
         liquid_species_map.insert({ species.name(), species });
     }
 
     auto addMineralSpecies(const MineralSpecies& species) -> void
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Mineral, species.name());
+        digest_value.reset();
         mineral_species_map.insert({species.name(), species});
     }
 
@@ -621,11 +704,16 @@ struct Database::Impl
 
     auto aqueousSpecies() -> std::vector<AqueousSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadAll(BinaryDatabase::Aqueous);
         return collectValues(aqueous_species_map);
     }
 
     auto aqueousSpecies(std::string name) const -> const AqueousSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Aqueous, name);
+
         if(aqueous_species_map.count(name) == 0)
             errorNonExistentSpecies("aqueous", name);
 
@@ -634,11 +722,16 @@ struct Database::Impl
 
     auto gaseousSpecies() -> std::vector<GaseousSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadAll(BinaryDatabase::Gaseous);
         return collectValues(gaseous_species_map);
     }
 
     auto gaseousSpecies(std::string name) const -> const GaseousSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Gaseous, name);
+
         if(gaseous_species_map.count(name) == 0)
             errorNonExistentSpecies("gaseous", name);
 
@@ -647,11 +740,16 @@ struct Database::Impl
 
     auto liquidSpecies() -> std::vector<LiquidSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadAll(BinaryDatabase::Liquid);
         return collectValues(liquid_species_map);
     }
 
     auto liquidSpecies(std::string name) const -> const LiquidSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Liquid, name);
+
         if(liquid_species_map.count(name) == 0)
             errorNonExistentSpecies("liquid", name);
 
@@ -660,11 +758,16 @@ struct Database::Impl
 
     auto mineralSpecies() -> std::vector<MineralSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadAll(BinaryDatabase::Mineral);
         return collectValues(mineral_species_map);
     }
 
     auto mineralSpecies(std::string name) const -> const MineralSpecies&
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        load(BinaryDatabase::Mineral, name);
+
         if(mineral_species_map.count(name) == 0)
             errorNonExistentSpecies("mineral", name);
 
@@ -673,44 +776,88 @@ struct Database::Impl
 
     auto containsAqueousSpecies(std::string species) const -> bool
     {
-        return aqueous_species_map.count(species) != 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        return aqueous_species_map.count(species) != 0 || (binary && binary->contains(BinaryDatabase::Aqueous, species));
     }
 
     auto containsGaseousSpecies(std::string species) const -> bool
     {
-        return gaseous_species_map.count(species) != 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        return gaseous_species_map.count(species) != 0 || (binary && binary->contains(BinaryDatabase::Gaseous, species));
     }
 
     auto containsLiquidSpecies(std::string species) const -> bool
     {
-        return liquid_species_map.count(species) != 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        return liquid_species_map.count(species) != 0 || (binary && binary->contains(BinaryDatabase::Liquid, species));
     }
 
     auto containsMineralSpecies(std::string species) const -> bool
     {
-        return mineral_species_map.count(species) != 0;
+        std::lock_guard<std::mutex> lock(mutex);
+        return mineral_species_map.count(species) != 0 || (binary && binary->contains(BinaryDatabase::Mineral, species));
     }
 
     auto aqueousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<AqueousSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadWithElements(BinaryDatabase::Aqueous, elements);
         return speciesWithElements(elements, aqueous_species_map);
     }
 
     auto gaseousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<GaseousSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadWithElements(BinaryDatabase::Gaseous, elements);
         return speciesWithElements(elements, gaseous_species_map);
     }
 
     auto liquidSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<LiquidSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadWithElements(BinaryDatabase::Liquid, elements);
         return speciesWithElements(elements, liquid_species_map);
     }
 
     auto mineralSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<MineralSpecies>
     {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadWithElements(BinaryDatabase::Mineral, elements);
         return speciesWithElements(elements, mineral_species_map);
     }
 
+    auto save(std::string filename) const -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadAll(BinaryDatabase::Aqueous);
+        loadAll(BinaryDatabase::Gaseous);
+        loadAll(BinaryDatabase::Liquid);
+        loadAll(BinaryDatabase::Mineral);
+        BinaryDatabase::write(filename, elements(),
+            collectValues(aqueous_species_map),
+            collectValues(gaseous_species_map),
+            collectValues(liquid_species_map),
+            collectValues(mineral_species_map));
+    }
+
+    auto digest() const -> std::uint64_t
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(digest_value)
+            return *digest_value;
+        loadAll(BinaryDatabase::Aqueous);
+        loadAll(BinaryDatabase::Gaseous);
+        loadAll(BinaryDatabase::Liquid);
+        loadAll(BinaryDatabase::Mineral);
+        const std::string bytes = BinaryDatabase::serialize(elements(),
+            collectValues(aqueous_species_map),
+            collectValues(gaseous_species_map),
+            collectValues(liquid_species_map),
+            collectValues(mineral_species_map));
+        digest_value = hashBytes(bytes.data(), bytes.size());
+        return *digest_value;
+    }
+
     auto parse(const xml_document& doc, std::string databasename) -> void
     {
         // Access the database node of the database file
@@ -774,16 +921,20 @@ struct Database::Impl
 
     auto parseElementalFormula(const xml_node& node) -> std::map<Element, double>
     {
-        std::string formula = node.child("Elements").text().get();
+        const std::string formula = node.child("Elements").text().get();
         std::map<Element, double> elements;
-        auto words = split(formula, "()");
-        for(unsigned i = 0; i < words.size(); i += 2)
+        std::string element;
+        unsigned i = 0;
+        splitEach(formula, "()", [&](std::string_view word)
         {
-            Assert(element_map.count(words[i]),
+            // The words alternate between element symbols and their numbers of atoms, as in `Ca(1)C(1)O(3)`
+            if(i++ % 2 == 0) { element = word; return; }
+            auto iter = element_map.find(element);
+            Assert(iter != element_map.end(),
                 "Cannot parse the elemental formula `" + formula + "`.",
-                "The element `" + words[i] + "` is not in the database.");
-            elements.emplace(element_map.at(words[i]), tofloat(words[i + 1]));
-        }
+                "The element `" + element + "` is not in the database.");
+            elements.emplace(iter->second, tofloat(word));
+        });
         if(!node.child("Charge").empty())
         {
             double charge = node.child("Charge").text().as_double();
@@ -901,6 +1052,16 @@ Database::Database(const ThermoFun::Database& fundatabase)
 : pimpl(new Impl(fundatabase))
 {}
 
+auto Database::save(std::string filename) const -> void
+{
+    pimpl->save(filename);
+}
+
+auto Database::digest() const -> std::uint64_t
+{
+    return pimpl->digest();
+}
+
 auto Database::addElement(const Element& element) -> void
 {
     pimpl->addElement(element);
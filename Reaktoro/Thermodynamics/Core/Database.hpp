@@ -18,6 +18,7 @@
 #pragma once
 
 // C++ includes
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -85,12 +86,28 @@ public:
     /// database file is not found, then a default built-in database
     /// with the same name will be tried. If no default built-in database
     /// exists with a given name, an exception will be thrown.
+    /// If `filename` points to a database file in binary format, written
+    /// by method @ref save, the file is mapped into memory instead of parsed,
+    /// and each species is only loaded when it is first requested.
     /// @param filename The name of the database file
     explicit Database(std::string filename);
 
     /// Construct a Database instance with a given ThermoFun database.
     explicit Database(const ThermoFun::Database& fundatabase);
 
+    /// Save all elements and species in the database to a file in binary format.
+    /// The binary file can be used later to construct a Database instance much faster
+    /// than parsing the original `xml` database file or ThermoFun database.
+    /// @param filename The name of the binary database file
+    auto save(std::string filename) const -> void;
+
+    /// Return a hash of all elements and species in the database.
+    /// The hash is computed from the binary format of the database written by @ref save.
+    /// It identifies the contents of the database and it is used, for example, to
+    /// name the files in the cache of ChemicalEditor. The hash is calculated when
+    /// first requested and kept until an element or species is added to the database.
+    auto digest() const -> std::uint64_t;
+
     /// Add an Element instance in the database.
     auto addElement(const Element& element) -> void;
 
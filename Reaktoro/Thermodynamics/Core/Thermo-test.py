@@ -0,0 +1,62 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import numpy
+import pytest
+from reaktoro import (
+    Database,
+    Thermo,
+)
+
+
+@pytest.mark.parametrize("threads", [1, 4])
+def test_thermo_over_arrays_of_temperatures_and_pressures(threads):
+    thermo = Thermo(Database("supcrt98.xml"))
+    thermo.setThreads(threads)
+
+    T = numpy.linspace(298.15, 573.15, 12)
+    P = numpy.linspace(1.0e5, 500.0e5, 12)
+    species = ["H2O(l)", "Ca++", "CO2(aq)", "CO2(g)", "Calcite"]
+    reactions = ["Calcite + H+ = Ca++ + HCO3-", "H2O(l) = H+ + OH-"]
+
+    G = thermo.standardPartialMolarGibbsEnergies(T, P, species)
+    V = thermo.standardPartialMolarVolumes(T, P, species)
+    logK = thermo.logEquilibriumConstants(T, P, reactions)
+
+    assert G.shape == (len(T), len(species))
+    assert logK.shape == (len(T), len(reactions))
+
+    # The values over the arrays are the same as those calculated at each temperature and pressure
+    for i in range(len(T)):
+        for j, name in enumerate(species):
+            assert G[i, j] == pytest.approx(thermo.standardPartialMolarGibbsEnergy(T[i], P[i], name).val)
+            assert V[i, j] == pytest.approx(thermo.standardPartialMolarVolume(T[i], P[i], name).val)
+        for j, reaction in enumerate(reactions):
+            assert logK[i, j] == pytest.approx(thermo.logEquilibriumConstant(T[i], P[i], reaction).val)
+
+
+def test_thermo_over_arrays_with_different_sizes():
+    thermo = Thermo(Database("supcrt98.xml"))
+
+    T = numpy.linspace(298.15, 573.15, 12)
+    P = numpy.linspace(1.0e5, 500.0e5, 10)
+
+    with pytest.raises(RuntimeError):
+        thermo.standardPartialMolarGibbsEnergies(T, P, ["H2O(l)"])
+
+    with pytest.raises(RuntimeError):
+        thermo.logEquilibriumConstants(T, P, ["H2O(l) = H+ + OH-"])
@@ -18,7 +18,9 @@
 #include "Thermo.hpp"
 
 // C++ includes
+#include <algorithm>
 #include <functional>
+#include <map>
 using namespace std::placeholders;
 
 // ThermoFun includes
@@ -30,6 +32,7 @@ using namespace std::placeholders;
 #include <Reaktoro/Common/OptimizationUtils.hpp>
 #include <Reaktoro/Common/ReactionEquation.hpp>
 #include <Reaktoro/Common/ThermoScalar.hpp>
+#include <Reaktoro/Common/ThreadPool.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Thermodynamics/Core/Database.hpp>
@@ -96,12 +99,43 @@ struct Thermo::Impl
     /// The HKF equation of state for the thermodynamic state of aqueous, gaseous and mineral species
     SpeciesThermoStateFunction species_thermo_state_hkf_fn;
 
+    /// The number of threads used in the calculations over arrays of temperatures and pressures
+    unsigned threads = 1;
+
+    /// The model of a species resolved for the calculations over arrays of temperatures and pressures
+    enum class BatchModel { SolventHKF, SoluteHKF, FluidHKF, MineralHKF, Other };
+
+    /// A species resolved for the calculations over arrays of temperatures and pressures
+    struct BatchSpecies
+    {
+        /// The name of the species
+        std::string name;
+
+        /// The model of the species, where Other denotes the calculation at each temperature and pressure by name
+        BatchModel model = BatchModel::Other;
+
+        /// The aqueous species, if the model is SolventHKF or SoluteHKF
+        AqueousSpecies aqueous;
+
+        /// The gaseous or liquid species, if the model is FluidHKF
+        FluidSpecies fluid;
+
+        /// The mineral species, if the model is MineralHKF
+        MineralSpecies mineral;
+    };
+
+    /// The property of a species in its thermodynamic state calculated with the HKF model
+    using BatchStateProperty = ThermoScalar SpeciesThermoState::*;
+
+    /// The method that calculates the property of a species at a single temperature and pressure
+    using BatchSingleProperty = ThermoScalar (Impl::*)(double, double, std::string);
+
     Impl()
     : engine(ThermoFun::Database())
     {}
 
     Impl(const ThermoFun::Database& fundb)
-    : engine(fundb), fundatabase(fundb), database(fundb)
+    : database(fundb), engine(fundb), fundatabase(fundb)
     {
         // set solvent symbol, the HGK, JN water solvent model are defined in this record
         engine.setSolventSymbol("H2O@");
@@ -486,7 +520,7 @@ struct Thermo::Impl
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
-	auto lnEquilibriumConstantFromPhreeqcParams(Temperature T, Pressure P, const SpeciesThermoParamsPhreeqc& params) -> ThermoScalar
+	auto lnEquilibriumConstantFromPhreeqcParams(Temperature T, const SpeciesThermoParamsPhreeqc& params) -> ThermoScalar
 	{
 		const double ln10 = 2.302585092994046;
 		const double lnk298 = params.reaction.log_k * ln10;
@@ -517,7 +551,7 @@ struct Thermo::Impl
 
         // The universal gas constant (in units of kJ/(K*mol))
         const double R = 8.31470e-3;
-        const ThermoScalar lnk = lnEquilibriumConstantFromPhreeqcParams(T, P, params);
+        const ThermoScalar lnk = lnEquilibriumConstantFromPhreeqcParams(T, params);
 
         // Using formula:
         // G_{j}^{\circ}=-\frac{1}{\nu_{j}}\left[\sum_{i\neq j}\nu_{i}G_{i}^{\circ}+RT\ln K\right]
@@ -553,6 +587,155 @@ struct Thermo::Impl
         const ThermoScalar lnK = lnEquilibriumConstant(T, P, reaction);
         return lnK/ln10;
     }
+
+    auto resolveBatchSpecies(std::string species) -> BatchSpecies
+    {
+        BatchSpecies res;
+        res.name = species;
+
+        // Only the species whose properties come from the HKF model in every method above are resolved
+        const bool hkf = substances.empty() &&
+            !getSpeciesInterpolatedThermoProperties(species) &&
+            !getReactionInterpolatedThermoProperties(species) &&
+            !getSpeciesThermoParamsPhreeqc(species) &&
+            hasThermoParamsHKF(species);
+
+        if(!hkf)
+            return res;
+
+        if(database.containsAqueousSpecies(species))
+        {
+            res.aqueous = database.aqueousSpecies(species);
+            res.model = isAlternativeWaterName(species) ? BatchModel::SolventHKF : BatchModel::SoluteHKF;
+        }
+        else if(database.containsGaseousSpecies(species))
+        {
+            res.fluid = database.gaseousSpecies(species);
+            res.model = BatchModel::FluidHKF;
+        }
+        else if(database.containsLiquidSpecies(species))
+        {
+            res.fluid = database.liquidSpecies(species);
+            res.model = BatchModel::FluidHKF;
+        }
+        else if(database.containsMineralSpecies(species))
+        {
+            res.mineral = database.mineralSpecies(species);
+            res.model = BatchModel::MineralHKF;
+        }
+
+        return res;
+    }
+
+    auto standardPropertiesRange(VectorConstRef T, VectorConstRef P, const std::vector<BatchSpecies>& species,
+        BatchStateProperty state_property, BatchSingleProperty single_property, Index begin, Index end, MatrixRef res) -> void
+    {
+        const auto uses = [&](BatchModel model)
+        {
+            return std::any_of(species.begin(), species.end(),
+                [&](const BatchSpecies& s) { return s.model == model; });
+        };
+
+        const bool solvent = uses(BatchModel::SolventHKF);
+        const bool solute = uses(BatchModel::SoluteHKF);
+
+        WaterThermoState wts;
+        WaterElectroState wes;
+        FunctionG g;
+
+        for(Index i = begin; i < end; ++i)
+        {
+            // The states of water shared by all aqueous species at this temperature and pressure
+            if(solvent || solute)
+                wts = Reaktoro::waterThermoStateWagnerPruss(T[i], P[i], StateOfMatter::Liquid);
+            if(solute)
+            {
+                wes = waterElectroStateJohnsonNorton(T[i], P[i], wts);
+                g = functionG(T[i], P[i], wts);
+            }
+
+            for(Index j = 0; j < species.size(); ++j)
+            {
+                const BatchSpecies& s = species[j];
+                switch(s.model)
+                {
+                case BatchModel::SolventHKF:
+                    res(i, j) = (speciesThermoStateSolventHKF(T[i], P[i], wts).*state_property).val; break;
+                case BatchModel::SoluteHKF:
+                    res(i, j) = (speciesThermoStateSoluteHKF(T[i], P[i], s.aqueous, speciesElectroStateHKF(g, s.aqueous), wes).*state_property).val; break;
+                case BatchModel::FluidHKF:
+                    res(i, j) = (Reaktoro::speciesThermoStateHKF(T[i], P[i], s.fluid).*state_property).val; break;
+                case BatchModel::MineralHKF:
+                    res(i, j) = (Reaktoro::speciesThermoStateHKF(T[i], P[i], s.mineral).*state_property).val; break;
+                default:
+                    res(i, j) = (this->*single_property)(T[i], P[i], s.name).val;
+                }
+            }
+        }
+    }
+
+    auto standardProperties(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& names,
+        BatchStateProperty state_property, BatchSingleProperty single_property, MatrixRef res) -> void
+    {
+        const Index num_points = T.size();
+
+        Assert(P.size() == T.size(), "Could not calculate the standard thermodynamic properties.",
+            "The number of pressure values is not the same as the number of temperature values.");
+        Assert(res.rows() == T.size() && static_cast<Index>(res.cols()) == names.size(),
+            "Could not calculate the standard thermodynamic properties.",
+            "The result matrix does not have a row for each temperature and a column for each species.");
+
+        std::vector<BatchSpecies> species;
+        species.reserve(names.size());
+        for(const std::string& name : names)
+            species.push_back(resolveBatchSpecies(name));
+
+        // The ThermoFun engine cannot be used by many threads
+        const unsigned nthreads = substances.empty() ? numParallelTasks(threads, num_points) : 1;
+
+        // The temperatures and pressures are divided in contiguous ranges among the parallel tasks
+        ThreadPool::shared().run(nthreads, [&](unsigned ithread)
+        {
+            const auto range = parallelTaskRange(num_points, nthreads, ithread);
+            standardPropertiesRange(T, P, species, state_property, single_property, range.first, range.second, res);
+        });
+    }
+
+    auto lnEquilibriumConstants(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& reactions, MatrixRef res) -> void
+    {
+        Assert(P.size() == T.size(), "Could not calculate the equilibrium constants of the reactions.",
+            "The number of pressure values is not the same as the number of temperature values.");
+        Assert(res.rows() == T.size() && static_cast<Index>(res.cols()) == reactions.size(),
+            "Could not calculate the equilibrium constants of the reactions.",
+            "The result matrix does not have a row for each temperature and a column for each reaction.");
+
+        // The reaction equations and the columns of their species in the matrix of standard Gibbs energies
+        std::vector<ReactionEquation> equations;
+        std::vector<std::string> species;
+        std::map<std::string, Index> columns;
+        for(const std::string& reaction : reactions)
+        {
+            equations.emplace_back(reaction);
+            for(const auto& pair : equations.back().equation())
+                if(columns.emplace(pair.first, species.size()).second)
+                    species.push_back(pair.first);
+        }
+
+        Matrix G(T.size(), species.size());
+        standardProperties(T, P, species, &SpeciesThermoState::gibbs_energy, &Impl::standardPartialMolarGibbsEnergy, G);
+
+        for(Index i = 0; i < static_cast<Index>(T.size()); ++i)
+        {
+            const double RT = universalGasConstant * T[i];
+            for(Index j = 0; j < equations.size(); ++j)
+            {
+                double lnK = 0.0;
+                for(const auto& pair : equations[j].equation())
+                    lnK += pair.second * G(i, columns.at(pair.first));
+                res(i, j) = lnK/(-RT);
+            }
+        }
+    }
 };
 
 Thermo::Thermo(const ThermoFun::Database& database)
@@ -613,6 +796,63 @@ auto Thermo::logEquilibriumConstant(double T, double P, std::string reaction) ->
     return pimpl->logEquilibriumConstant(T, P, reaction);
 }
 
+auto Thermo::setThreads(unsigned threads) -> void
+{
+    pimpl->threads = threads;
+}
+
+auto Thermo::standardPartialMolarGibbsEnergies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::gibbs_energy, &Impl::standardPartialMolarGibbsEnergy, res);
+}
+
+auto Thermo::standardPartialMolarHelmholtzEnergies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::helmholtz_energy, &Impl::standardPartialMolarHelmholtzEnergy, res);
+}
+
+auto Thermo::standardPartialMolarInternalEnergies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::internal_energy, &Impl::standardPartialMolarInternalEnergy, res);
+}
+
+auto Thermo::standardPartialMolarEnthalpies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::enthalpy, &Impl::standardPartialMolarEnthalpy, res);
+}
+
+auto Thermo::standardPartialMolarEntropies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::entropy, &Impl::standardPartialMolarEntropy, res);
+}
+
+auto Thermo::standardPartialMolarVolumes(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::volume, &Impl::standardPartialMolarVolume, res);
+}
+
+auto Thermo::standardPartialMolarHeatCapacitiesConstP(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::heat_capacity_cp, &Impl::standardPartialMolarHeatCapacityConstP, res);
+}
+
+auto Thermo::standardPartialMolarHeatCapacitiesConstV(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void
+{
+    pimpl->standardProperties(T, P, species, &SpeciesThermoState::heat_capacity_cv, &Impl::standardPartialMolarHeatCapacityConstV, res);
+}
+
+auto Thermo::lnEquilibriumConstants(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& reactions, MatrixRef res) const -> void
+{
+    pimpl->lnEquilibriumConstants(T, P, reactions, res);
+}
+
+auto Thermo::logEquilibriumConstants(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& reactions, MatrixRef res) const -> void
+{
+    const double ln10 = 2.302585092994046;
+    pimpl->lnEquilibriumConstants(T, P, reactions, res);
+    res /= ln10;
+}
+
 auto Thermo::hasStandardPartialMolarGibbsEnergy(std::string species) const -> bool
 {
     if(pimpl->hasThermoParamsHKF(species))
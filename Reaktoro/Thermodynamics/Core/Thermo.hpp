@@ -20,9 +20,11 @@
 // C++ includes
 #include <string>
 #include <memory>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Common/ScalarTypes.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
 
 // Forwardt declarations for ThermoFun
 namespace ThermoFun {
@@ -108,6 +110,87 @@ public:
     /// @param reaction The reaction equation
     auto logEquilibriumConstant(double T, double P, std::string reaction) -> ThermoScalar;
 
+    /// Set the number of threads used in the calculations over arrays of temperatures and pressures.
+    /// A value of zero uses as many threads as the number of hardware threads. The work is run on the
+    /// workers of ThreadPool::shared, so no threads are created per call. The calculations use a
+    /// single thread if this Thermo instance was constructed with a ThermoFun database.
+    auto setThreads(unsigned threads) -> void;
+
+    /// Calculate the apparent standard molar Gibbs free energies of species over arrays of temperatures and pressures (in units of J/mol).
+    /// The species are resolved only once, and the states of water needed by the HKF model for aqueous
+    /// species are calculated only once at each temperature and pressure for all species. The temperatures
+    /// and pressures are divided in contiguous chunks among the threads set by @ref setThreads.
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarGibbsEnergies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the apparent standard molar Helmholtz free energies of species over arrays of temperatures and pressures (in units of J/mol).
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarHelmholtzEnergies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the apparent standard molar internal energies of species over arrays of temperatures and pressures (in units of J/mol).
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarInternalEnergies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the apparent standard molar enthalpies of species over arrays of temperatures and pressures (in units of J/mol).
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarEnthalpies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the standard molar entropies of species over arrays of temperatures and pressures (in units of J/K).
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarEntropies(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the standard molar volumes of species over arrays of temperatures and pressures (in units of m3/mol).
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarVolumes(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the standard molar isobaric heat capacities of species over arrays of temperatures and pressures (in units of J/(mol*K)).
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarHeatCapacitiesConstP(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the standard molar isochoric heat capacities of species over arrays of temperatures and pressures (in units of J/(mol*K)).
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param species The names of the species
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each species
+    auto standardPartialMolarHeatCapacitiesConstV(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& species, MatrixRef res) const -> void;
+
+    /// Calculate the ln equilibrium constants of reactions over arrays of temperatures and pressures.
+    /// The reaction equations are parsed only once, and the standard Gibbs energies of their species
+    /// are calculated only once at each temperature and pressure for all reactions.
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param reactions The reaction equations
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each reaction
+    auto lnEquilibriumConstants(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& reactions, MatrixRef res) const -> void;
+
+    /// Calculate the log equilibrium constants of reactions over arrays of temperatures and pressures.
+    /// @param T The temperature values (in units of K)
+    /// @param P The pressure values (in units of Pa), one for each temperature value
+    /// @param reactions The reaction equations
+    /// @param[out] res The matrix with a row for each temperature and pressure and a column for each reaction
+    auto logEquilibriumConstants(VectorConstRef T, VectorConstRef P, const std::vector<std::string>& reactions, MatrixRef res) const -> void;
+
     /// Return true if there is support for the calculation of the apparent standard molar Gibbs free energy of a species.
     /// @param species The name of the species
     auto hasStandardPartialMolarGibbsEnergy(std::string species) const -> bool;
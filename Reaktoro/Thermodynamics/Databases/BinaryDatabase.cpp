@@ -0,0 +1,779 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BinaryDatabase.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+// Platform includes
+#if _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Core/Element.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The signature at the beginning of a binary database file
+const char signature[8] = {'R', 'K', 'T', 'D', 'B', '\0', '\r', '\n'};
+
+/// The version of the binary database format
+const std::uint32_t version = 1;
+
+/// The value used to detect files written with a different byte order
+const std::uint32_t byteorder = 0x01020304;
+
+/// The flags that indicate which thermodynamic data a species has
+enum ThermoFlags : std::uint32_t
+{
+    HasProperties = 1, HasReaction = 2, HasHKF = 4, HasPhreeqc = 8
+};
+
+/// The header of a binary database file, with the offsets of its tables in bytes
+struct Header
+{
+    char signature[8];
+    std::uint32_t version;
+    std::uint32_t byteorder;
+    std::uint32_t num_elements;
+    std::uint32_t num_species;
+    std::uint32_t num_terms;
+    std::uint32_t strings_size;
+    std::uint64_t num_values;
+    std::uint32_t types[5]; // the species of type i are in the range [types[i], types[i + 1])
+    std::uint32_t unused;
+    std::uint64_t elements;
+    std::uint64_t species;
+    std::uint64_t terms;
+    std::uint64_t values;
+    std::uint64_t strings;
+};
+
+/// The record of an element in a binary database file
+struct ElementRecord
+{
+    std::uint32_t name;
+    std::uint32_t unused;
+    double molar_mass;
+};
+
+/// The record of a pair (element index or name, coefficient) in a binary database file
+struct TermRecord
+{
+    std::uint32_t name;
+    std::uint32_t unused;
+    double coefficient;
+};
+
+/// The record of a species in a binary database file
+struct SpeciesRecord
+{
+    std::uint32_t name;
+    std::uint32_t formula;
+    std::uint32_t elements;
+    std::uint32_t num_elements;
+    std::uint32_t dissociation;
+    std::uint32_t num_dissociation;
+    std::uint32_t thermo;
+    std::uint32_t reaction_equation;
+    std::uint32_t phreeqc_equation;
+    std::uint32_t unused;
+    std::uint64_t values;
+    double charge;
+    double critical_temperature;
+    double critical_pressure;
+    double acentric_factor;
+};
+
+static_assert(sizeof(Header) % 8 == 0 && sizeof(ElementRecord) == 16 && sizeof(TermRecord) == 16 && sizeof(SpeciesRecord) == 80,
+    "The records of the binary database format must have a fixed layout.");
+
+/// A read-only view of a file mapped into memory.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename)
+    {
+        #if _WIN32
+        file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER filesize;
+        if(!GetFileSizeEx(file, &filesize) || filesize.QuadPart == 0) return;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(!mapping) return;
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(!view) return;
+        bytes = static_cast<const char*>(view);
+        length = static_cast<Index>(filesize.QuadPart);
+        #else
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if(fd < 0) return;
+        struct stat info;
+        if(::fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            void* view = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(view != MAP_FAILED)
+            {
+                bytes = static_cast<const char*>(view);
+                length = info.st_size;
+            }
+        }
+        ::close(fd);
+        #endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    ~MappedFile()
+    {
+        #if _WIN32
+        if(bytes) UnmapViewOfFile(bytes);
+        if(mapping) CloseHandle(mapping);
+        if(file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        #else
+        if(bytes) ::munmap(const_cast<char*>(bytes), length);
+        #endif
+    }
+
+    /// Return the bytes of the file, or null if the file could not be mapped.
+    auto data() const -> const char* { return bytes; }
+
+    /// Return the number of bytes in the file.
+    auto size() const -> Index { return length; }
+
+private:
+    #if _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+    #endif
+    const char* bytes = nullptr;
+    Index length = 0;
+};
+
+/// Return true if a block of bytes starts with a valid header of a binary database file.
+auto validHeader(const char* bytes, Index size) -> bool
+{
+    if(bytes == nullptr || size < sizeof(Header))
+        return false;
+    Header header;
+    std::memcpy(&header, bytes, sizeof(Header));
+    return std::memcmp(header.signature, signature, sizeof(signature)) == 0;
+}
+
+/// A type used to assemble the tables of a binary database file.
+struct Writer
+{
+    std::vector<ElementRecord> elements;
+    std::vector<SpeciesRecord> species;
+    std::vector<TermRecord> terms;
+    std::vector<double> values;
+    std::string strings;
+    std::map<std::string, std::uint32_t> string_offsets;
+    std::map<std::string, std::uint32_t> element_indices;
+
+    /// Return the offset of a string in the string table, adding it if needed.
+    auto string(const std::string& str) -> std::uint32_t
+    {
+        auto iter = string_offsets.find(str);
+        if(iter != string_offsets.end())
+            return iter->second;
+        const auto offset = static_cast<std::uint32_t>(strings.size());
+        strings.append(str.c_str(), str.size() + 1);
+        string_offsets.emplace(str, offset);
+        return offset;
+    }
+
+    /// Return the index of an element in the element table, adding it if needed.
+    auto element(const Element& element) -> std::uint32_t
+    {
+        auto iter = element_indices.find(element.name());
+        if(iter != element_indices.end())
+            return iter->second;
+        const auto index = static_cast<std::uint32_t>(elements.size());
+        elements.push_back({string(element.name()), 0, element.molarMass()});
+        element_indices.emplace(element.name(), index);
+        return index;
+    }
+
+    auto vector(const std::vector<double>& vec) -> void
+    {
+        values.push_back(vec.size());
+        values.insert(values.end(), vec.begin(), vec.end());
+    }
+
+    auto interpolator(const BilinearInterpolator& interpolator) -> void
+    {
+        vector(interpolator.xCoordinates());
+        vector(interpolator.yCoordinates());
+        vector(interpolator.data());
+    }
+
+    auto properties(const SpeciesThermoInterpolatedProperties& properties) -> void
+    {
+        interpolator(properties.gibbs_energy);
+        interpolator(properties.helmholtz_energy);
+        interpolator(properties.internal_energy);
+        interpolator(properties.enthalpy);
+        interpolator(properties.entropy);
+        interpolator(properties.volume);
+        interpolator(properties.heat_capacity_cp);
+        interpolator(properties.heat_capacity_cv);
+    }
+
+    auto hkf(const AqueousSpeciesThermoParamsHKF& hkf) -> void
+    {
+        values.insert(values.end(), {hkf.Gf, hkf.Hf, hkf.Sr, hkf.a1, hkf.a2, hkf.a3, hkf.a4, hkf.c1, hkf.c2, hkf.wref});
+    }
+
+    auto hkf(const FluidSpeciesThermoParamsHKF& hkf) -> void
+    {
+        values.insert(values.end(), {hkf.Gf, hkf.Hf, hkf.Sr, hkf.a, hkf.b, hkf.c, hkf.Tmax});
+    }
+
+    auto hkf(const MineralSpeciesThermoParamsHKF& hkf) -> void
+    {
+        values.insert(values.end(), {hkf.Gf, hkf.Hf, hkf.Sr, hkf.Vr, double(hkf.nptrans), hkf.Tmax});
+        vector(hkf.a);
+        vector(hkf.b);
+        vector(hkf.c);
+        vector(hkf.Ttr);
+        vector(hkf.Htr);
+        vector(hkf.Vtr);
+        vector(hkf.dPdTtr);
+    }
+
+    /// Add the common data of a species and return its record.
+    auto record(const Species& species) -> SpeciesRecord
+    {
+        SpeciesRecord record = {};
+        record.name = string(species.name());
+        record.formula = string(species.formula());
+        record.elements = terms.size();
+        record.num_elements = species.elements().size();
+        for(const auto& pair : species.elements())
+            terms.push_back({element(pair.first), 0, pair.second});
+        return record;
+    }
+
+    /// Add the thermodynamic data of a species to its record.
+    template<typename ThermoData>
+    auto thermo(SpeciesRecord& record, const ThermoData& thermo) -> void
+    {
+        record.values = values.size();
+        if(thermo.properties)
+        {
+            record.thermo |= HasProperties;
+            properties(thermo.properties.value());
+        }
+        if(thermo.reaction)
+        {
+            record.thermo |= HasReaction;
+            record.reaction_equation = string(thermo.reaction->equation);
+            properties(thermo.reaction.value());
+            interpolator(thermo.reaction->lnk);
+        }
+        if(thermo.hkf)
+        {
+            record.thermo |= HasHKF;
+            hkf(thermo.hkf.value());
+        }
+        if(thermo.phreeqc)
+        {
+            const auto& reaction = thermo.phreeqc->reaction;
+            record.thermo |= HasPhreeqc;
+            record.phreeqc_equation = string(reaction.equation);
+            values.insert(values.end(), {reaction.log_k, reaction.delta_h});
+            vector(reaction.analytic);
+        }
+    }
+
+    auto add(const AqueousSpecies& species) -> void
+    {
+        SpeciesRecord record = this->record(species);
+        record.charge = species.charge();
+        record.dissociation = terms.size();
+        record.num_dissociation = species.dissociation().size();
+        for(const auto& pair : species.dissociation())
+            terms.push_back({string(pair.first), 0, pair.second});
+        thermo(record, species.thermoData());
+        this->species.push_back(record);
+    }
+
+    auto add(const FluidSpecies& species) -> void
+    {
+        SpeciesRecord record = this->record(species);
+        record.critical_temperature = species.criticalTemperature();
+        record.critical_pressure = species.criticalPressure();
+        record.acentric_factor = species.acentricFactor();
+        thermo(record, species.thermoData());
+        this->species.push_back(record);
+    }
+
+    auto add(const MineralSpecies& species) -> void
+    {
+        SpeciesRecord record = this->record(species);
+        thermo(record, species.thermoData());
+        this->species.push_back(record);
+    }
+
+    /// Add species of one type, sorted by name so that they can be searched with a binary search.
+    template<typename SpeciesType>
+    auto add(std::vector<SpeciesType> list, std::uint32_t& begin) -> void
+    {
+        std::sort(list.begin(), list.end(), [](const SpeciesType& l, const SpeciesType& r) { return l.name() < r.name(); });
+        begin = species.size();
+        for(const auto& entry : list)
+            add(entry);
+    }
+};
+
+/// A type used to read a sequence of numbers from the values table of a binary database file.
+struct Reader
+{
+    const double* pos;
+
+    /// The end of the values table, past which the reader must not read
+    const double* end;
+
+    /// Check that the next `count` numbers are within the values table.
+    auto require(double count) const -> void
+    {
+        Assert(count >= 0.0 && count <= end - pos, "Could not read the thermodynamic data of a species in the binary database file.",
+            "The file is corrupted.");
+    }
+
+    auto number() -> double
+    {
+        require(1);
+        return *pos++;
+    }
+
+    auto vector() -> std::vector<double>
+    {
+        const double count = number();
+        require(count);
+        const Index size = static_cast<Index>(count);
+        std::vector<double> vec(pos, pos + size);
+        pos += size;
+        return vec;
+    }
+
+    auto interpolator() -> BilinearInterpolator
+    {
+        auto x = vector();
+        auto y = vector();
+        auto data = vector();
+        return BilinearInterpolator(x, y, data);
+    }
+
+    auto properties(SpeciesThermoInterpolatedProperties& properties) -> void
+    {
+        properties.gibbs_energy     = interpolator();
+        properties.helmholtz_energy = interpolator();
+        properties.internal_energy  = interpolator();
+        properties.enthalpy         = interpolator();
+        properties.entropy          = interpolator();
+        properties.volume           = interpolator();
+        properties.heat_capacity_cp = interpolator();
+        properties.heat_capacity_cv = interpolator();
+    }
+
+    auto hkf(AqueousSpeciesThermoParamsHKF& hkf) -> void
+    {
+        for(double* param : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.a1, &hkf.a2, &hkf.a3, &hkf.a4, &hkf.c1, &hkf.c2, &hkf.wref})
+            *param = number();
+    }
+
+    auto hkf(FluidSpeciesThermoParamsHKF& hkf) -> void
+    {
+        for(double* param : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.a, &hkf.b, &hkf.c, &hkf.Tmax})
+            *param = number();
+    }
+
+    auto hkf(MineralSpeciesThermoParamsHKF& hkf) -> void
+    {
+        hkf.Gf      = number();
+        hkf.Hf      = number();
+        hkf.Sr      = number();
+        hkf.Vr      = number();
+        hkf.nptrans = static_cast<int>(number());
+        hkf.Tmax    = number();
+        hkf.a       = vector();
+        hkf.b       = vector();
+        hkf.c       = vector();
+        hkf.Ttr     = vector();
+        hkf.Htr     = vector();
+        hkf.Vtr     = vector();
+        hkf.dPdTtr  = vector();
+    }
+};
+
+} // namespace
+
+struct BinaryDatabase::Impl
+{
+    /// The mapped binary database file
+    MappedFile file;
+
+    /// The header of the binary database file
+    Header header;
+
+    /// The tables of the binary database file
+    const ElementRecord* elements = nullptr;
+    const SpeciesRecord* species = nullptr;
+    const TermRecord* terms = nullptr;
+    const double* values = nullptr;
+    const char* strings = nullptr;
+
+    Impl(std::string filename)
+    : file(filename)
+    {
+        Assert(file.data(), "Could not open the binary database file `" + filename + "`.",
+            "The file does not exist or could not be mapped into memory.");
+
+        Assert(validHeader(file.data(), file.size()), "Could not read the binary database file `" + filename + "`.",
+            "The file is not in the binary database format.");
+
+        std::memcpy(&header, file.data(), sizeof(Header));
+
+        Assert(header.version == version && header.byteorder == byteorder,
+            "Could not read the binary database file `" + filename + "`.",
+            "The file was written with another version of the format or on a machine with another byte order.");
+
+        // Check the tables are within the file, so that a truncated file cannot be read out of bounds
+        const auto within = [&](std::uint64_t offset, std::uint64_t length)
+        {
+            return offset % 8 == 0 && offset <= file.size() && length <= file.size() - offset;
+        };
+
+        Assert(within(header.elements, header.num_elements * sizeof(ElementRecord)) &&
+               within(header.species, header.num_species * sizeof(SpeciesRecord)) &&
+               within(header.terms, header.num_terms * sizeof(TermRecord)) &&
+               within(header.values, header.num_values * sizeof(double)) &&
+               header.strings <= file.size() && header.strings_size <= file.size() - header.strings &&
+               header.types[4] == header.num_species,
+            "Could not read the binary database file `" + filename + "`.",
+            "The file is truncated or corrupted.");
+
+        elements = reinterpret_cast<const ElementRecord*>(file.data() + header.elements);
+        species  = reinterpret_cast<const SpeciesRecord*>(file.data() + header.species);
+        terms    = reinterpret_cast<const TermRecord*>(file.data() + header.terms);
+        values   = reinterpret_cast<const double*>(file.data() + header.values);
+        strings  = file.data() + header.strings;
+
+        Assert(validRecords(), "Could not read the binary database file `" + filename + "`.",
+            "The file is corrupted.");
+    }
+
+    /// Check the records refer only to strings, terms and values within their tables.
+    /// The variable-length data in the values table is checked as it is read.
+    auto validRecords() const -> bool
+    {
+        // The string table must end with a null character, so that every string in it is terminated
+        if(header.strings_size > 0 && strings[header.strings_size - 1] != '\0')
+            return false;
+
+        const auto string = [&](std::uint32_t offset) { return offset < header.strings_size; };
+
+        const auto range = [&](std::uint32_t begin, std::uint32_t count)
+            { return begin <= header.num_terms && count <= header.num_terms - begin; };
+
+        for(Index i = 0; i < 4; ++i)
+            if(header.types[i] > header.types[i + 1])
+                return false;
+
+        for(Index i = 0; i < header.num_elements; ++i)
+            if(!string(elements[i].name))
+                return false;
+
+        for(Index i = 0; i < header.num_species; ++i)
+        {
+            const SpeciesRecord& record = species[i];
+            if(!string(record.name) || !string(record.formula) ||
+               !string(record.reaction_equation) || !string(record.phreeqc_equation) ||
+               !range(record.elements, record.num_elements) ||
+               !range(record.dissociation, record.num_dissociation) ||
+               record.values > header.num_values)
+                return false;
+            for(Index j = record.elements; j < record.elements + record.num_elements; ++j)
+                if(terms[j].name >= header.num_elements)
+                    return false;
+            for(Index j = record.dissociation; j < record.dissociation + record.num_dissociation; ++j)
+                if(!string(terms[j].name))
+                    return false;
+        }
+
+        return true;
+    }
+
+    auto element(Index i) const -> Element
+    {
+        Element element;
+        element.setName(strings + elements[i].name);
+        element.setMolarMass(elements[i].molar_mass);
+        return element;
+    }
+
+    /// Return the index of a species with given type and name, or the number of species if not found.
+    auto find(SpeciesType type, const std::string& name) const -> Index
+    {
+        const SpeciesRecord* begin = species + header.types[type];
+        const SpeciesRecord* end = species + header.types[type + 1];
+        auto iter = std::lower_bound(begin, end, name, [&](const SpeciesRecord& record, const std::string& name)
+            { return std::strcmp(strings + record.name, name.c_str()) < 0; });
+        if(iter != end && name == strings + iter->name)
+            return iter - species;
+        return header.num_species;
+    }
+
+    auto record(SpeciesType type, const std::string& name, const char* typestr) const -> const SpeciesRecord&
+    {
+        const Index i = find(type, name);
+        Assert(i < header.num_species, "Cannot get an instance of the " + std::string(typestr) + " species `" + name + "` in the database.",
+            "There is no such species in the database.");
+        return species[i];
+    }
+
+    /// Initialize the common data of a species from its record.
+    auto initialize(Species& result, const SpeciesRecord& record) const -> void
+    {
+        std::map<Element, double> composition;
+        for(Index i = record.elements; i < record.elements + record.num_elements; ++i)
+            composition.emplace(element(terms[i].name), terms[i].coefficient);
+        result.setName(strings + record.name);
+        result.setFormula(strings + record.formula);
+        result.setElements(composition);
+    }
+
+    /// Read the thermodynamic data of a species from its record.
+    template<typename ThermoData>
+    auto thermo(const SpeciesRecord& record) const -> ThermoData
+    {
+        ThermoData thermo;
+        Reader reader{values + record.values, values + header.num_values};
+        if(record.thermo & HasProperties)
+        {
+            thermo.properties = SpeciesThermoInterpolatedProperties();
+            reader.properties(thermo.properties.value());
+        }
+        if(record.thermo & HasReaction)
+        {
+            thermo.reaction = ReactionThermoInterpolatedProperties();
+            thermo.reaction->equation = ReactionEquation(strings + record.reaction_equation);
+            reader.properties(thermo.reaction.value());
+            thermo.reaction->lnk = reader.interpolator();
+        }
+        if(record.thermo & HasHKF)
+        {
+            thermo.hkf.emplace();
+            reader.hkf(thermo.hkf.value());
+        }
+        if(record.thermo & HasPhreeqc)
+        {
+            thermo.phreeqc = SpeciesThermoParamsPhreeqc();
+            auto& reaction = thermo.phreeqc->reaction;
+            const std::string equation = strings + record.phreeqc_equation;
+            if(!equation.empty())
+                reaction.equation = ReactionEquation(equation);
+            reaction.log_k = reader.number();
+            reaction.delta_h = reader.number();
+            reaction.analytic = reader.vector();
+        }
+        return thermo;
+    }
+};
+
+BinaryDatabase::BinaryDatabase(std::string filename)
+: pimpl(new Impl(filename))
+{}
+
+auto BinaryDatabase::isBinaryDatabase(std::string filename) -> bool
+{
+    std::ifstream file(filename, std::ios::binary);
+    char bytes[sizeof(Header)];
+    return file.read(bytes, sizeof(Header)) && validHeader(bytes, sizeof(Header));
+}
+
+auto BinaryDatabase::write(std::string filename,
+    const std::vector<Element>& elements,
+    const std::vector<AqueousSpecies>& aqueous,
+    const std::vector<GaseousSpecies>& gaseous,
+    const std::vector<LiquidSpecies>& liquid,
+    const std::vector<MineralSpecies>& mineral) -> void
+{
+    const std::string bytes = serialize(elements, aqueous, gaseous, liquid, mineral);
+
+    std::ofstream file(filename, std::ios::binary);
+
+    Assert(file, "Could not write the binary database file `" + filename + "`.",
+        "The file could not be opened for writing.");
+
+    file.write(bytes.data(), bytes.size());
+
+    Assert(file.flush(), "Could not write the binary database file `" + filename + "`.",
+        "An error occurred while writing the file.");
+}
+
+auto BinaryDatabase::serialize(
+    const std::vector<Element>& elements,
+    const std::vector<AqueousSpecies>& aqueous,
+    const std::vector<GaseousSpecies>& gaseous,
+    const std::vector<LiquidSpecies>& liquid,
+    const std::vector<MineralSpecies>& mineral) -> std::string
+{
+    Writer writer;
+    Header header = {};
+
+    for(const auto& element : elements)
+        writer.element(element);
+
+    writer.add(aqueous, header.types[Aqueous]);
+    writer.add(gaseous, header.types[Gaseous]);
+    writer.add(liquid, header.types[Liquid]);
+    writer.add(mineral, header.types[Mineral]);
+    header.types[4] = writer.species.size();
+
+    std::memcpy(header.signature, signature, sizeof(signature));
+    header.version      = version;
+    header.byteorder    = byteorder;
+    header.num_elements = writer.elements.size();
+    header.num_species  = writer.species.size();
+    header.num_terms    = writer.terms.size();
+    header.num_values   = writer.values.size();
+    header.strings_size = writer.strings.size();
+    header.elements     = sizeof(Header);
+    header.species      = header.elements + writer.elements.size() * sizeof(ElementRecord);
+    header.terms        = header.species + writer.species.size() * sizeof(SpeciesRecord);
+    header.values       = header.terms + writer.terms.size() * sizeof(TermRecord);
+    header.strings      = header.values + writer.values.size() * sizeof(double);
+
+    std::string bytes;
+    bytes.reserve(header.strings + writer.strings.size());
+
+    auto write = [&](const void* data, Index size)
+    {
+        bytes.append(static_cast<const char*>(data), size);
+    };
+
+    write(&header, sizeof(Header));
+    write(writer.elements.data(), writer.elements.size() * sizeof(ElementRecord));
+    write(writer.species.data(), writer.species.size() * sizeof(SpeciesRecord));
+    write(writer.terms.data(), writer.terms.size() * sizeof(TermRecord));
+    write(writer.values.data(), writer.values.size() * sizeof(double));
+    write(writer.strings.data(), writer.strings.size());
+
+    return bytes;
+}
+
+auto BinaryDatabase::elements() const -> std::vector<Element>
+{
+    std::vector<Element> elements;
+    elements.reserve(pimpl->header.num_elements);
+    for(Index i = 0; i < pimpl->header.num_elements; ++i)
+        elements.push_back(pimpl->element(i));
+    return elements;
+}
+
+auto BinaryDatabase::contains(SpeciesType type, std::string name) const -> bool
+{
+    return pimpl->find(type, name) < pimpl->header.num_species;
+}
+
+auto BinaryDatabase::speciesNames(SpeciesType type) const -> std::vector<std::string>
+{
+    std::vector<std::string> names;
+    for(Index i = pimpl->header.types[type]; i < pimpl->header.types[type + 1]; ++i)
+        names.push_back(pimpl->strings + pimpl->species[i].name);
+    return names;
+}
+
+auto BinaryDatabase::speciesNamesWithElements(SpeciesType type, const std::vector<std::string>& elements) const -> std::vector<std::string>
+{
+    // The flags that indicate which elements in the database are in the given list
+    std::vector<bool> allowed(pimpl->header.num_elements);
+    for(Index i = 0; i < allowed.size(); ++i)
+    {
+        const std::string name = pimpl->strings + pimpl->elements[i].name;
+        allowed[i] = name == "Z" || std::count(elements.begin(), elements.end(), name);
+    }
+
+    std::vector<std::string> names;
+    for(Index i = pimpl->header.types[type]; i < pimpl->header.types[type + 1]; ++i)
+    {
+        const SpeciesRecord& record = pimpl->species[i];
+        const TermRecord* begin = pimpl->terms + record.elements;
+        const TermRecord* end = begin + record.num_elements;
+        if(std::all_of(begin, end, [&](const TermRecord& term) { return allowed[term.name]; }))
+            names.push_back(pimpl->strings + record.name);
+    }
+    return names;
+}
+
+auto BinaryDatabase::aqueousSpecies(std::string name) const -> AqueousSpecies
+{
+    const SpeciesRecord& record = pimpl->record(Aqueous, name, "aqueous");
+    AqueousSpecies species;
+    pimpl->initialize(species, record);
+    species.setCharge(record.charge);
+    std::map<std::string, double> dissociation;
+    for(Index i = record.dissociation; i < record.dissociation + record.num_dissociation; ++i)
+        dissociation.emplace(pimpl->strings + pimpl->terms[i].name, pimpl->terms[i].coefficient);
+    species.setDissociation(dissociation);
+    species.setThermoData(pimpl->thermo<AqueousSpeciesThermoData>(record));
+    return species;
+}
+
+auto BinaryDatabase::fluidSpecies(SpeciesType type, std::string name) const -> FluidSpecies
+{
+    const SpeciesRecord& record = pimpl->record(type, name, type == Liquid ? "liquid" : "gaseous");
+    FluidSpecies species;
+    pimpl->initialize(species, record);
+    if(record.critical_temperature > 0.0)
+        species.setCriticalTemperature(record.critical_temperature);
+    if(record.critical_pressure > 0.0)
+        species.setCriticalPressure(record.critical_pressure);
+    species.setAcentricFactor(record.acentric_factor);
+    species.setThermoData(pimpl->thermo<FluidSpeciesThermoData>(record));
+    return species;
+}
+
+auto BinaryDatabase::mineralSpecies(std::string name) const -> MineralSpecies
+{
+    const SpeciesRecord& record = pimpl->record(Mineral, name, "mineral");
+    MineralSpecies species;
+    pimpl->initialize(species, record);
+    species.setThermoData(pimpl->thermo<MineralSpeciesThermoData>(record));
+    return species;
+}
+
+} // namespace Reaktoro
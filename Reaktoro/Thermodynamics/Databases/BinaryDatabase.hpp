@@ -0,0 +1,108 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
+#include <Reaktoro/Thermodynamics/Species/GaseousSpecies.hpp>
+#include <Reaktoro/Thermodynamics/Species/LiquidSpecies.hpp>
+#include <Reaktoro/Thermodynamics/Species/MineralSpecies.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class Element;
+
+/// A database file in a compact binary format, whose species are loaded on demand.
+/// The file contains a string table, the elements, an index of the species sorted by name
+/// within each species type, and the thermodynamic data of the species as fixed-layout
+/// records of numbers. The file is mapped into memory, so that opening it costs almost
+/// nothing, and a species is only converted into an AqueousSpecies, FluidSpecies or
+/// MineralSpecies instance when it is requested.
+/// @see Database
+class BinaryDatabase
+{
+public:
+    /// The types of species in a binary database.
+    enum SpeciesType { Aqueous, Gaseous, Liquid, Mineral };
+
+    /// Construct a BinaryDatabase instance by mapping a binary database file into memory.
+    /// @param filename The name of the binary database file
+    explicit BinaryDatabase(std::string filename);
+
+    /// Return true if a file exists and is in the binary database format.
+    /// @param filename The name of the file
+    static auto isBinaryDatabase(std::string filename) -> bool;
+
+    /// Write elements and species to a file in the binary database format.
+    /// @param filename The name of the binary database file
+    /// @param elements The elements in the database
+    /// @param aqueous The aqueous species in the database
+    /// @param gaseous The gaseous species in the database
+    /// @param liquid The liquid species in the database
+    /// @param mineral The mineral species in the database
+    static auto write(std::string filename,
+        const std::vector<Element>& elements,
+        const std::vector<AqueousSpecies>& aqueous,
+        const std::vector<GaseousSpecies>& gaseous,
+        const std::vector<LiquidSpecies>& liquid,
+        const std::vector<MineralSpecies>& mineral) -> void;
+
+    /// Return the bytes of the binary database format with given elements and species.
+    /// @see write
+    static auto serialize(
+        const std::vector<Element>& elements,
+        const std::vector<AqueousSpecies>& aqueous,
+        const std::vector<GaseousSpecies>& gaseous,
+        const std::vector<LiquidSpecies>& liquid,
+        const std::vector<MineralSpecies>& mineral) -> std::string;
+
+    /// Return the elements in the database.
+    auto elements() const -> std::vector<Element>;
+
+    /// Return true if the database contains a species with given type and name.
+    auto contains(SpeciesType type, std::string name) const -> bool;
+
+    /// Return the names of all species with given type, in sorted order.
+    auto speciesNames(SpeciesType type) const -> std::vector<std::string>;
+
+    /// Return the names of the species with given type whose elements are all in a list of elements.
+    /// The charge element `Z` is ignored.
+    auto speciesNamesWithElements(SpeciesType type, const std::vector<std::string>& elements) const -> std::vector<std::string>;
+
+    /// Return an aqueous species in the database.
+    auto aqueousSpecies(std::string name) const -> AqueousSpecies;
+
+    /// Return a gaseous or liquid species in the database.
+    auto fluidSpecies(SpeciesType type, std::string name) const -> FluidSpecies;
+
+    /// Return a mineral species in the database.
+    auto mineralSpecies(std::string name) const -> MineralSpecies;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
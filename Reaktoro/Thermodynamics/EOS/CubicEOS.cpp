@@ -188,9 +188,15 @@ struct CubicEOS::Impl
     /// Construct a CubicEOS::Impl instance.
     Impl(unsigned nspecies)
     : nspecies(nspecies)
+    {
+        resize(nspecies);
+    }
+
+    /// Initialize the result with zero values and given number of species for the molar derivatives.
+    auto resize(unsigned nd) -> void
     {
         // Initialize the dimension of the chemical scalar quantities
-        ChemicalScalar sca(nspecies);
+        ChemicalScalar sca(nd);
         result.molar_volume = sca;
         result.residual_molar_gibbs_energy = sca;
         result.residual_molar_enthalpy = sca;
@@ -198,7 +204,7 @@ struct CubicEOS::Impl
         result.residual_molar_heat_capacity_cv = sca;
 
         // Initialize the dimension of the chemical vector quantities
-        ChemicalVector vec(nspecies);
+        ChemicalVector vec(nspecies, nd);
         result.partial_molar_volumes = vec;
         result.residual_partial_molar_enthalpies = vec;
         result.residual_partial_molar_gibbs_energies = vec;
@@ -207,9 +213,19 @@ struct CubicEOS::Impl
 
     auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
     {
+        // The number of species for the molar derivatives, which is zero if these are not computed
+        const unsigned nd = x.ddn.cols();
+
         // Check if the mole fractions are zero or non-initialized
         if(x.val.size() == 0 || min(x.val) <= 0.0)
-            return Result(nspecies); // result with zero values
+        {
+            resize(nd);
+            return result; // result with zero values
+        }
+
+        // Ensure the result has as many molar derivatives as the mole fractions
+        if(result.ln_fugacity_coefficients.ddn.cols() != nd)
+            resize(nd);
 
         // Auxiliary variables
         const double R = universalGasConstant;
@@ -253,11 +269,11 @@ struct CubicEOS::Impl
         if(calculate_interaction_params)
             kres = calculate_interaction_params(kargs);
         // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        ChemicalScalar amix(nspecies);
-        ChemicalScalar amixT(nspecies);
-        ChemicalScalar amixTT(nspecies);
-        ChemicalVector abar(nspecies);
-        ChemicalVector abarT(nspecies);
+        ChemicalScalar amix(nd);
+        ChemicalScalar amixT(nd);
+        ChemicalScalar amixTT(nd);
+        ChemicalVector abar(nspecies, nd);
+        ChemicalVector abarT(nspecies, nd);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             for(unsigned j = 0; j < nspecies; ++j)
@@ -291,7 +307,7 @@ struct CubicEOS::Impl
         }
 
         // Calculate the parameter `bmix` of the cubic equation of state
-        ChemicalScalar bmix(nspecies);
+        ChemicalScalar bmix(nd);
         Vector bbar(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
@@ -344,7 +360,7 @@ struct CubicEOS::Impl
         if (cubic_size == 1 || cubic_size == 2)
         {
             //even if cubicEOS_roots has 2 roots, assume that the smallest does not have physical meaning
-            Zs.push_back(ChemicalScalar(nspecies, cubicEOS_roots[0]));
+            Zs.push_back(ChemicalScalar(nd, cubicEOS_roots[0]));
         }
         else
         {
@@ -354,12 +370,12 @@ struct CubicEOS::Impl
                 exception.reason << "Logic error: it was expected Z roots of size 3, but got: " << Zs.size();
                 RaiseError(exception);
             }
-            Zs.push_back(ChemicalScalar(nspecies, cubicEOS_roots[0]));  // Z_max
-            Zs.push_back(ChemicalScalar(nspecies, cubicEOS_roots[2]));  // Z_min
+            Zs.push_back(ChemicalScalar(nd, cubicEOS_roots[0]));  // Z_max
+            Zs.push_back(ChemicalScalar(nd, cubicEOS_roots[2]));  // Z_min
         }
 
         // Selecting compressibility factor - Z_liq < Z_gas
-        ChemicalScalar Z(nspecies);
+        ChemicalScalar Z(nd);
         if (isvapor)
             Z.val = *std::max_element(cubicEOS_roots.begin(), cubicEOS_roots.end());
         else
@@ -422,7 +438,7 @@ struct CubicEOS::Impl
         const double factor = -1.0/(3*Z.val*Z.val + 2*A.val*Z.val + B.val);
         Z.ddT = factor * (A.ddT*Z.val*Z.val + B.ddT*Z.val + C.ddT);
         Z.ddP = factor * (A.ddP*Z.val*Z.val + B.ddP*Z.val + C.ddP);
-        for(unsigned i = 0; i < nspecies; ++i)
+        for(unsigned i = 0; i < nd; ++i)
             Z.ddn[i] = factor * (A.ddn[i]*Z.val*Z.val + B.ddn[i]*Z.val + C.ddn[i]);
 
         // Calculate the partial temperature derivative of Z
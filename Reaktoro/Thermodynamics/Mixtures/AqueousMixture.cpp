@@ -204,12 +204,12 @@ auto AqueousMixture::chargesAnions() const -> Vector
     return rows(chargesSpecies(), indicesAnions());
 }
 
-auto AqueousMixture::molalities(VectorConstRef n) const -> ChemicalVector
+auto AqueousMixture::molalities(VectorConstRef n, bool derivatives) const -> ChemicalVector
 {
     const unsigned num_species = numSpecies();
 
     // The molalities of the species and their partial derivatives
-    ChemicalVector m(num_species);
+    ChemicalVector m(num_species, derivatives ? num_species : 0);
 
     // The molar amount of water
     const double nw = n[idx_water];
@@ -221,6 +221,11 @@ auto AqueousMixture::molalities(VectorConstRef n) const -> ChemicalVector
     const double kgH2O = nw * waterMolarMass;
 
     m.val = n/kgH2O;
+
+    // Check if the molar derivatives are not needed
+    if(!derivatives)
+        return m;
+
     for(unsigned i = 0; i < num_species; ++i)
     {
         m.ddn(i, i) = 1.0/kgH2O;
@@ -233,7 +238,7 @@ auto AqueousMixture::molalities(VectorConstRef n) const -> ChemicalVector
 auto AqueousMixture::stoichiometricMolalities(const ChemicalVector& m) const -> ChemicalVector
 {
     // Auxiliary variables
-    const unsigned num_species = numSpecies();
+    const unsigned num_species = m.ddn.cols(); // zero if there are no molar derivatives
     const unsigned num_charged = numChargedSpecies();
     const unsigned num_neutral = numNeutralSpecies();
 
@@ -257,7 +262,7 @@ auto AqueousMixture::stoichiometricMolalities(const ChemicalVector& m) const ->
 
 auto AqueousMixture::effectiveIonicStrength(const ChemicalVector& m) const -> ChemicalScalar
 {
-    const unsigned num_species = numSpecies();
+    const unsigned num_species = m.ddn.cols(); // zero if there are no molar derivatives
     const Vector z = chargesSpecies();
 
     ChemicalScalar Ie(num_species);
@@ -270,7 +275,7 @@ auto AqueousMixture::effectiveIonicStrength(const ChemicalVector& m) const -> Ch
 
 auto AqueousMixture::stoichiometricIonicStrength(const ChemicalVector& ms) const -> ChemicalScalar
 {
-    const unsigned num_species = numSpecies();
+    const unsigned num_species = ms.ddn.cols(); // zero if there are no molar derivatives
     const Vector zc = chargesChargedSpecies();
 
     ChemicalScalar Is(num_species);
@@ -281,15 +286,15 @@ auto AqueousMixture::stoichiometricIonicStrength(const ChemicalVector& ms) const
     return Is;
 }
 
-auto AqueousMixture::state(Temperature T, Pressure P, VectorConstRef n) const -> AqueousMixtureState
+auto AqueousMixture::state(Temperature T, Pressure P, VectorConstRef n, bool derivatives) const -> AqueousMixtureState
 {
     AqueousMixtureState res;
     res.T = T;
     res.P = P;
-    res.x = moleFractions(n);
+    res.x = moleFractions(n, derivatives);
     res.rho = rho(T, P);
     res.epsilon = epsilon(T, P);
-    res.m  = molalities(n);
+    res.m  = molalities(n, derivatives);
     res.ms = stoichiometricMolalities(res.m);
     res.Ie = effectiveIonicStrength(res.m);
     res.Is = stoichiometricIonicStrength(res.ms);
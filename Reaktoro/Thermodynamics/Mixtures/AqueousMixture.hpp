@@ -164,8 +164,9 @@ public:
 
     /// Calculate the molalities of the aqueous species and its molar derivatives.
     /// @param n The molar abundance of species (in units of mol)
+    /// @param derivatives The flag that indicates if the partial molar derivatives are computed
     /// @return The molalities and their partial derivatives
-    auto molalities(VectorConstRef n) const -> ChemicalVector;
+    auto molalities(VectorConstRef n, bool derivatives = true) const -> ChemicalVector;
 
     /// Calculate the stoichiometric molalities of the ions and its molar derivatives.
     /// @param m The molalities of the aqueous species and their partial derivatives
@@ -186,7 +187,8 @@ public:
     /// @param T The temperature (in units of K)
     /// @param P The pressure (in units of Pa)
     /// @param n The molar amounts of the species in the mixture (in units of mol)
-    auto state(Temperature T, Pressure P, VectorConstRef n) const -> AqueousMixtureState;
+    /// @param derivatives The flag that indicates if the partial molar derivatives are computed
+    auto state(Temperature T, Pressure P, VectorConstRef n, bool derivatives = true) const -> AqueousMixtureState;
 
 private:
     /// The index of the water species
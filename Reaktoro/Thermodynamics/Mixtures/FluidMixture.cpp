@@ -30,12 +30,12 @@ FluidMixture::FluidMixture(const std::vector<FluidSpecies>& species)
 FluidMixture::~FluidMixture()
 {}
 
-auto FluidMixture::state(Temperature T, Pressure P, VectorConstRef n) const -> FluidMixtureState
+auto FluidMixture::state(Temperature T, Pressure P, VectorConstRef n, bool derivatives) const -> FluidMixtureState
 {
     FluidMixtureState res;
     res.T = T;
     res.P = P;
-    res.x = moleFractions(n);
+    res.x = moleFractions(n, derivatives);
     return res;
 }
 
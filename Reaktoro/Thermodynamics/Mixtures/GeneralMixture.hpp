@@ -103,14 +103,16 @@ public:
 
     /// Calculates the mole fractions of the species and their partial derivatives
     /// @param n The molar abundance of the species (in units of mol)
+    /// @param derivatives The flag that indicates if the partial molar derivatives are computed
     /// @return The mole fractions and their partial derivatives
-    auto moleFractions(VectorConstRef n) const -> ChemicalVector;
+    auto moleFractions(VectorConstRef n, bool derivatives = true) const -> ChemicalVector;
 
     /// Calculate the state of the mixture.
     /// @param T The temperature (in units of K)
     /// @param P The pressure (in units of Pa)
     /// @param n The molar amounts of the species in the mixture (in units of mol)
-    auto state(Temperature T, Pressure P, VectorConstRef n) const -> MixtureState;
+    /// @param derivatives The flag that indicates if the partial molar derivatives are computed
+    auto state(Temperature T, Pressure P, VectorConstRef n, bool derivatives = true) const -> MixtureState;
 
 private:
     /// The name of mixture
@@ -195,20 +197,21 @@ auto GeneralMixture<SpeciesType>::chargesSpecies() const -> Vector
 }
 
 template<class SpeciesType>
-auto GeneralMixture<SpeciesType>::moleFractions(VectorConstRef n) const -> ChemicalVector
+auto GeneralMixture<SpeciesType>::moleFractions(VectorConstRef n, bool derivatives) const -> ChemicalVector
 {
     const unsigned nspecies = numSpecies();
+    const unsigned nd = derivatives ? nspecies : 0;
     if(nspecies == 1)
     {
-        ChemicalVector x(1);
+        ChemicalVector x(1, nd);
         x.val[0] = 1.0;
         return x;
     }
-    ChemicalVector x(nspecies);
+    ChemicalVector x(nspecies, nd);
     const double nt = n.sum();
     if(nt == 0.0) return x;
     x.val = n/nt;
-    for(unsigned i = 0; i < nspecies; ++i)
+    for(unsigned i = 0; i < nd; ++i)
     {
         x.ddn.row(i).fill(-x.val[i]/nt);
         x.ddn(i, i) += 1.0/nt;
@@ -217,12 +220,12 @@ auto GeneralMixture<SpeciesType>::moleFractions(VectorConstRef n) const -> Chemi
 }
 
 template<class SpeciesType>
-auto GeneralMixture<SpeciesType>::state(Temperature T, Pressure P, VectorConstRef n) const -> MixtureState
+auto GeneralMixture<SpeciesType>::state(Temperature T, Pressure P, VectorConstRef n, bool derivatives) const -> MixtureState
 {
     MixtureState res;
     res.T = T;
     res.P = P;
-    res.x = moleFractions(n);
+    res.x = moleFractions(n, derivatives);
     return res;
 }
 
@@ -34,12 +34,12 @@ MineralMixture::MineralMixture(const MineralSpecies& species)
 MineralMixture::~MineralMixture()
 {}
 
-auto MineralMixture::state(Temperature T, Pressure P, VectorConstRef n) const -> MineralMixtureState
+auto MineralMixture::state(Temperature T, Pressure P, VectorConstRef n, bool derivatives) const -> MineralMixtureState
 {
     MineralMixtureState res;
     res.T = T;
     res.P = P;
-    res.x = moleFractions(n);
+    res.x = moleFractions(n, derivatives);
     return res;
 }
 
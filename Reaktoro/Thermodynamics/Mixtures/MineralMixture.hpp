@@ -55,7 +55,8 @@ public:
     /// @param T The temperature (in units of K)
     /// @param P The pressure (in units of Pa)
     /// @param n The molar amounts of the species in the mixture (in units of mol)
-    auto state(Temperature T, Pressure P, VectorConstRef n) const -> MineralMixtureState;
+    /// @param derivatives The flag that indicates if the partial molar derivatives are computed
+    auto state(Temperature T, Pressure P, VectorConstRef n, bool derivatives = true) const -> MineralMixtureState;
 };
 
 } // namespace Reaktoro
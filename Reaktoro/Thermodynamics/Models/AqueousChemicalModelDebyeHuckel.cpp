@@ -94,7 +94,7 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // Auxiliary constant references
         const auto& I = state.Ie;            // ionic strength
@@ -121,6 +121,9 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
 		B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
 		sigmacoeff = (2.0/3.0)*A*I*sqrtI;
 
+        // Ensure sigma has as many molar derivatives as the ionic strength, since it can be set to a constant below
+        sigma.ddn.resize(I.ddn.size());
+
         // Loop over all neutral species in the mixture
         for(Index i = 0; i < num_neutral_species; ++i)
         {
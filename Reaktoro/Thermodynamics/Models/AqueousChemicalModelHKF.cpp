@@ -332,7 +332,7 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // Auxiliary references
         auto& ln_g = res.ln_activity_coefficients;
@@ -363,8 +363,8 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
         const double bNaCl = solventParamNaCl(T.val, P.val);
         const double bNapClm = shortRangeInteractionParamNaCl(T.val, P.val);
 
-        // The osmotic coefficient of the aqueous phase
-        ChemicalScalar phi(num_species);
+        // The osmotic coefficient of the aqueous phase (without molar derivatives if these are not computed)
+        ChemicalScalar phi(res.derivatives ? num_species : 0);
 
         // Loop over all neutral species in the mixture
         for(auto i = 0; i < num_neutral_species; ++i)
@@ -32,7 +32,7 @@ auto aqueousChemicalModelIdeal(const AqueousMixture& mixture) -> PhaseChemicalMo
     PhaseChemicalModel f = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // The ln of water mole fraction
         ChemicalScalar ln_xw = log(state.x[iH2O]);
@@ -18,6 +18,7 @@
 #include "AqueousChemicalModelPitzerHMW.hpp"
 
 // C++ includes
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -473,46 +474,85 @@ const std::vector<double> Aphi_data =
     0.31695465, 0.32925197, 0.34262585, 0.35747187, 0.37383264, 0.39162945, 0.41072659, 0.43094633, 0.45206745, 0.47381721, 0.49585921, 0.51777702, 0.53905156, 0.55902802, 0.57686399
 };
 
+/// The coefficients of single-salt interaction parameters indexed by the pair (cation, anion).
+using SingleSaltParamData = std::map<std::pair<std::string, std::string>, std::vector<double>>;
+
+/// The values of mixing interaction parameters indexed by the set of the names of the interacting species.
+using MixingParamData = std::map<std::set<std::string>, double>;
+
+/// Index the lines of single-salt parameter data (beta0data, beta1data, beta2data, cphidata).
+/// Only the first line of a pair cation and anion is used, as when the lines are searched in order.
+auto indexSingleSaltParamData(const std::vector<std::string>& data) -> SingleSaltParamData
+{
+    SingleSaltParamData indexed;
+    for(const auto& line : data)
+    {
+        auto words = split(line, " ");
+
+        std::vector<double> c(words.size() - 2);
+
+        for(unsigned i = 0; i < c.size(); ++i)
+            c[i] = tofloat(words[i + 2]);
+
+        indexed.emplace(std::make_pair(words[0], words[1]), c);
+    }
+    return indexed;
+}
+
+/// Index the lines of mixing parameter data with given number of interacting species in each line.
+auto indexMixingParamData(const std::vector<std::string>& data, unsigned num_species) -> MixingParamData
+{
+    MixingParamData indexed;
+    for(const auto& line : data)
+    {
+        std::vector<std::string> words = split(line, " ");
+        std::set<std::string> names(words.begin(), words.begin() + num_species);
+        indexed.emplace(names, tofloat(words[num_species]));
+    }
+    return indexed;
+}
+
+/// Return the value of a mixing parameter, or zero if the interacting species have no data.
+auto mixingParam(const MixingParamData& data, const std::set<std::string>& species) -> double
+{
+    auto iter = data.find(species);
+    return iter != data.end() ? iter->second : 0.0;
+}
+
 /// Creates a function of temperature (in units of K) that computes a single-salt interaction parameter.
 /// @param cation The name of the cation
 /// @param anion The name of the anion
-/// @param data The data from which the function will be created (beta0data, beta1data, beta2data, cphidata)
+/// @param data The indexed data from which the function will be created (beta0data, beta1data, beta2data, cphidata)
 /// @return The function of temperature that computes the interaction parameter
-auto createSingleSaltParamFunction(std::string cation, std::string anion, const std::vector<std::string>& data) -> std::function<double(double)>
+auto createSingleSaltParamFunction(std::string cation, std::string anion, const SingleSaltParamData& data) -> std::function<double(double)>
 {
-    // Iterate over all lines of data and find the one with the pair cation and anion
-    for(const auto& line : data)
-    {
-        auto words = split(line, " ");
+    // Find the coefficients of the pair cation and anion
+    auto iter = data.find(std::make_pair(cation, anion));
 
-        if(cation == words[0] && anion == words[1])
-        {
-            const double Tr = 298.15;
+    // Return a zero function in case the pair cation and anion does not have Pitzer data
+    if(iter == data.end())
+        return [=](double T) { return 0.0; };
 
-            std::vector<double> c(words.size() - 2);
+    const double Tr = 298.15;
 
-            for(unsigned i = 0; i < c.size(); ++i)
-                c[i] = tofloat(words[i + 2]);
+    const std::vector<double> c = iter->second;
 
-            if(c.size() == 1)
-                return [=](double T) { return c[0]; };
+    if(c.size() == 1)
+        return [=](double T) { return c[0]; };
 
-            if(c.size() == 2)
-                return [=](double T) { return c[0] + c[1]*(T - Tr); };
+    if(c.size() == 2)
+        return [=](double T) { return c[0] + c[1]*(T - Tr); };
 
-            if(c.size() == 5)
-                return [=](double T) { return c[0] + c[1]*(1/T - 1/Tr) + c[2]*std::log(T/Tr) + c[3]*(T - Tr) + c[4]*(T*T - Tr*Tr); };
+    if(c.size() == 5)
+        return [=](double T) { return c[0] + c[1]*(1/T - 1/Tr) + c[2]*std::log(T/Tr) + c[3]*(T - Tr) + c[4]*(T*T - Tr*Tr); };
 
-            RuntimeError("Cannot create the single salt parameter function of Pitzer model.",
-                "The number of coefficients for the equation is not supported");
-        }
-    }
+    RuntimeError("Cannot create the single salt parameter function of Pitzer model.",
+        "The number of coefficients for the equation is not supported");
 
-    // Return a zero function in case the pair cation and anion does not have Pitzer data
-    return [=](double T) { return 0.0; };
+    return {};
 }
 
-auto createSingleSaltParamTable(const std::vector<std::string>& cations, const std::vector<std::string>& anions, const std::vector<std::string>& data) -> Table2D<std::function<double(double)>>
+auto createSingleSaltParamTable(const std::vector<std::string>& cations, const std::vector<std::string>& anions, const SingleSaltParamData& data) -> Table2D<std::function<double(double)>>
 {
     Table2D<std::function<double(double)>> table = initTable2D<std::function<double(double)>>(cations.size(), anions.size());
 
@@ -525,88 +565,50 @@ auto createSingleSaltParamTable(const std::vector<std::string>& cations, const s
 
 auto createBeta0Table(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
 {
-    return createSingleSaltParamTable(cations, anions, beta0_data);
+    static const SingleSaltParamData data = indexSingleSaltParamData(beta0_data);
+    return createSingleSaltParamTable(cations, anions, data);
 }
 
 auto createBeta1Table(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
 {
-    return createSingleSaltParamTable(cations, anions, beta1_data);
+    static const SingleSaltParamData data = indexSingleSaltParamData(beta1_data);
+    return createSingleSaltParamTable(cations, anions, data);
 }
 
 auto createBeta2Table(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
 {
-    return createSingleSaltParamTable(cations, anions, beta2_data);
+    static const SingleSaltParamData data = indexSingleSaltParamData(beta2_data);
+    return createSingleSaltParamTable(cations, anions, data);
 }
 
 auto createCphiTable(const std::vector<std::string>& cations, const std::vector<std::string>& anions) -> Table2D<std::function<double(double)>>
 {
-    return createSingleSaltParamTable(cations, anions, Cphi_data);
+    static const SingleSaltParamData data = indexSingleSaltParamData(Cphi_data);
+    return createSingleSaltParamTable(cations, anions, data);
 }
 
 auto theta(std::string ion1, std::string ion2) -> double
 {
-    std::set<std::string> ions = {ion1, ion2};
-
-    for(const auto& line : theta_data)
-    {
-        std::vector<std::string> words = split(line, " ");
-
-        // Get the first two names in the current string line
-        std::set<std::string> names(words.begin(), words.begin() + 2);
-
-        if(ions == names)
-            return tofloat(words[2]);
-    }
-
-    return 0.0;
+    static const MixingParamData data = indexMixingParamData(theta_data, 2);
+    return mixingParam(data, {ion1, ion2});
 }
 
 auto psi(std::string ion1, std::string ion2, std::string ion3) -> double
 {
-    std::set<std::string> ions = {ion1, ion2, ion3};
-
-    for(const auto& line : psi_data)
-    {
-        std::vector<std::string> words = split(line, " ");
-        std::set<std::string> names(words.begin(), words.begin() + 3);
-
-        if(ions == names)
-            return tofloat(words[3]);
-    }
-
-    return 0.0;
+    static const MixingParamData data = indexMixingParamData(psi_data, 3);
+    return mixingParam(data, {ion1, ion2, ion3});
 }
 
 auto lambda(std::string neutral, std::string ion) -> double
 {
-    std::set<std::string> species = {neutral, ion};
-
-    for(const auto& line : lambda_data)
-    {
-        std::vector<std::string> words = split(line, " ");
-        std::set<std::string> names(words.begin(), words.begin() + 2);
-
-        if(species == names)
-            return tofloat(words[2]);
-    }
-
-    return 0.0;
+    static const MixingParamData data = indexMixingParamData(lambda_data, 2);
+    return mixingParam(data, {neutral, ion});
 }
 
 auto zeta(std::string neutral, std::string cation, std::string anion) -> double
 {
-    std::set<std::string> species = {neutral, cation, anion};
-
-    for(const auto& line : zeta_data)
-    {
-        std::vector<std::string> words = split(line, " ");
-        std::set<std::string> names(words.begin(), words.begin() + 3);
-
-        if(species == names)
-            return tofloat(words[3]);
-    }
-
-    return 0.0;
+    static const MixingParamData data = indexMixingParamData(zeta_data, 3);
+    return mixingParam(data, {neutral, cation, anion});
 }
 
 auto createThetaTable(const std::vector<std::string>& ions1, const std::vector<std::string>& ions2) -> Table2D<double>
@@ -1046,8 +1048,8 @@ auto lnActivityCoefficientCation(const AqueousMixtureState& state, const PitzerP
     // The vector of molalities of all aqueous species
     const ChemicalVector& m = state.m;
 
-    // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
+    // The number of species for the molar derivatives, which is zero if these are not computed
+    const unsigned nspecies = m.ddn.cols();
 
     // The electrical charge of the M-th cation
     const double zM = pitzer.z_cations[M];
@@ -1139,8 +1141,8 @@ auto lnActivityCoefficientAnion(const AqueousMixtureState& state, const PitzerPa
     // The molalities of all aqueous species
     const ChemicalVector& m = state.m;
 
-    // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
+    // The number of species for the molar derivatives, which is zero if these are not computed
+    const unsigned nspecies = m.ddn.cols();
 
     // The electrical charge of the X-th anion
     const double zX = pitzer.z_anions[X];
@@ -1232,8 +1234,8 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     // The vector of molalities of all aqueous species
     const ChemicalVector& m = state.m;
 
-    // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
+    // The number of species for the molar derivatives, which is zero if these are not computed
+    const unsigned nspecies = m.ddn.cols();
 
     // The ionic strength of the aqueous mixture
     const ChemicalScalar& I = state.Ie;
@@ -1356,8 +1358,8 @@ auto lnActivityCoefficientNeutral(const AqueousMixtureState& state, const Pitzer
     // The vector of molalities of all aqueous species
     const ChemicalVector& m = state.m;
 
-    // The number of species in the mixture
-    const unsigned nspecies = m.val.size();
+    // The number of species for the molar derivatives, which is zero if these are not computed
+    const unsigned nspecies = m.ddn.cols();
 
     // The log of the activity coefficient of the N-th neutral species
     ChemicalScalar ln_gammaN(nspecies);
@@ -1397,7 +1399,7 @@ auto aqueousChemicalModelPitzerHMW(const AqueousMixture& mixture) -> PhaseChemic
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // Calculate the activity coefficients of the cations
         for(unsigned M = 0; M < pitzer.idx_cations.size(); ++M)
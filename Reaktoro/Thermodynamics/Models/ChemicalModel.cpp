@@ -23,26 +23,33 @@ ChemicalModelResult::ChemicalModelResult()
 {}
 
 ChemicalModelResult::ChemicalModelResult(Index nphases, Index nspecies)
-: ln_activity_coefficients(nspecies),
-  ln_activities(nspecies),
-  partial_molar_volumes(nspecies),
-  phase_molar_volumes(nphases, nspecies),
-  phase_residual_molar_gibbs_energies(nphases, nspecies),
-  phase_residual_molar_enthalpies(nphases, nspecies),
-  phase_residual_molar_heat_capacities_cp(nphases, nspecies),
-  phase_residual_molar_heat_capacities_cv(nphases, nspecies)
+: ChemicalModelResult(nphases, nspecies, true)
 {}
 
+ChemicalModelResult::ChemicalModelResult(Index nphases, Index nspecies, bool derivatives)
+{
+    resize(nphases, nspecies, derivatives);
+}
+
 auto ChemicalModelResult::resize(Index nphases, Index nspecies) -> void
 {
-    ln_activity_coefficients.resize(nspecies);
-    ln_activities.resize(nspecies);
-    partial_molar_volumes.resize(nspecies);
-    phase_molar_volumes.resize(nphases, nspecies);
-    phase_residual_molar_gibbs_energies.resize(nphases, nspecies);
-    phase_residual_molar_enthalpies.resize(nphases, nspecies);
-    phase_residual_molar_heat_capacities_cp.resize(nphases, nspecies);
-    phase_residual_molar_heat_capacities_cv.resize(nphases, nspecies);
+    resize(nphases, nspecies, with_derivatives);
+}
+
+auto ChemicalModelResult::resize(Index nphases, Index nspecies, bool derivatives) -> void
+{
+    // The number of species for the molar derivatives, which is zero if these are not computed
+    const Index nd = derivatives ? nspecies : 0;
+
+    with_derivatives = derivatives;
+    ln_activity_coefficients.resize(nspecies, nd);
+    ln_activities.resize(nspecies, nd);
+    partial_molar_volumes.resize(nspecies, nd);
+    phase_molar_volumes.resize(nphases, nd);
+    phase_residual_molar_gibbs_energies.resize(nphases, nd);
+    phase_residual_molar_enthalpies.resize(nphases, nd);
+    phase_residual_molar_heat_capacities_cp.resize(nphases, nd);
+    phase_residual_molar_heat_capacities_cv.resize(nphases, nd);
 }
 
 auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index nspecies) -> PhaseChemicalModelResult
@@ -55,7 +62,8 @@ auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index ns
         row(phase_residual_molar_gibbs_energies, iphase, ispecies, nspecies),
         row(phase_residual_molar_enthalpies, iphase, ispecies, nspecies),
         row(phase_residual_molar_heat_capacities_cp, iphase, ispecies, nspecies),
-        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies)
+        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies),
+        with_derivatives
     };
 }
 
@@ -69,7 +77,8 @@ auto ChemicalModelResult::phaseProperties(Index iphase, Index ispecies, Index ns
         row(phase_residual_molar_gibbs_energies, iphase, ispecies, nspecies),
         row(phase_residual_molar_enthalpies, iphase, ispecies, nspecies),
         row(phase_residual_molar_heat_capacities_cp, iphase, ispecies, nspecies),
-        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies)
+        row(phase_residual_molar_heat_capacities_cv, iphase, ispecies, nspecies),
+        with_derivatives
     };
 }
 
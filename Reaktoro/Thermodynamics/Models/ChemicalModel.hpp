@@ -37,11 +37,28 @@ public:
     /// @param nspecies The number of species in the chemical system.
     ChemicalModelResult(Index nphases, Index nspecies);
 
+    /// Construct a ChemicalModelResultBase instance with allocated memory
+    /// @param nphases The number of phases in the chemical system.
+    /// @param nspecies The number of species in the chemical system.
+    /// @param derivatives The flag that indicates if the partial molar derivatives are computed.
+    ChemicalModelResult(Index nphases, Index nspecies, bool derivatives);
+
     /// Resize this ChemicalModelResultBase with a given number of species.
     /// @param nphases The number of phases in the chemical system.
     /// @param nspecies The number of species in the chemical system.
     auto resize(Index nphases, Index nspecies) -> void;
 
+    /// Resize this ChemicalModelResultBase with a given number of species.
+    /// @param nphases The number of phases in the chemical system.
+    /// @param nspecies The number of species in the chemical system.
+    /// @param derivatives The flag that indicates if the partial molar derivatives are computed.
+    auto resize(Index nphases, Index nspecies, bool derivatives) -> void;
+
+    /// Return true if the partial molar derivatives of the chemical properties are computed.
+    /// Otherwise, the chemical properties have no molar derivatives, which are skipped by
+    /// the chemical models so that only values and temperature and pressure derivatives are computed.
+    inline auto derivatives() const -> bool { return with_derivatives; }
+
     /// Return a view of the chemical properties of a phase.
     /// @param iphase The index of the phase.
     /// @param ispecies The index of the first species in the phase.
@@ -103,6 +120,9 @@ public:
     inline auto phaseResidualMolarHeatCapacitiesCv() const -> ChemicalVectorConstRef { return phase_residual_molar_heat_capacities_cv; }
 
 private:
+    /// The flag that indicates if the partial molar derivatives are computed.
+    bool with_derivatives = true;
+
     /// The natural log of the activity coefficients of the species.
     ChemicalVector ln_activity_coefficients;
 
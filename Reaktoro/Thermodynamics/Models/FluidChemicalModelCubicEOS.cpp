@@ -66,7 +66,7 @@ auto fluidChemicalModelCubicEOS(
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // The mole fractions of the species
         const auto& x = state.x;
@@ -32,7 +32,7 @@ auto fluidChemicalModelIdeal(const FluidMixture& mixture) -> PhaseChemicalModel
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // Calculate pressure in bar
         const ThermoScalar Pbar = 1e-5 * Pressure(P);
@@ -107,7 +107,7 @@ auto fluidChemicalModelSpycherPruessEnnis(const FluidMixture& mixture) -> PhaseC
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // Calculate the pressure in bar
         const auto Pb = convertPascalToBar(P);
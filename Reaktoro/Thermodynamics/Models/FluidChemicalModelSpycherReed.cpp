@@ -228,9 +228,6 @@ auto fluidChemicalModelSpycherReed(const FluidMixture& mixture) -> PhaseChemical
     // The number of species in the mixture
     const unsigned nspecies = mixture.numSpecies();
 
-    // An auxiliary zero ChemicalScalar instance
-    const ChemicalScalar zero(nspecies);
-
     // The universal gas constant of the phase (in units of J/(mol*K))
     const double R = universalGasConstant;
 
@@ -241,7 +238,13 @@ auto fluidChemicalModelSpycherReed(const FluidMixture& mixture) -> PhaseChemical
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the gaseous mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
+
+        // The number of species for the molar derivatives, which is zero if these are not computed
+        const unsigned nd = res.derivatives ? nspecies : 0;
+
+        // An auxiliary zero ChemicalScalar instance
+        const ChemicalScalar zero(nd);
 
         // The mole fractions of the species
         const auto& x = state.x;
@@ -280,7 +283,7 @@ auto fluidChemicalModelSpycherReed(const FluidMixture& mixture) -> PhaseChemical
         }
 
         // Calculate the coefficient Bmix, BmixT, and BmixTT
-        ChemicalScalar Bmix(nspecies), BmixT(nspecies), BmixTT(nspecies);
+        ChemicalScalar Bmix(nd), BmixT(nd), BmixTT(nd);
         for (int i = 0; i < 3; ++i) for (int k = 0; k < 3; ++k)
         {
             Bmix += y[i] * y[k] * B[i][k];
@@ -289,7 +292,7 @@ auto fluidChemicalModelSpycherReed(const FluidMixture& mixture) -> PhaseChemical
         }
 
         // Calculate the coefficient Cmix, CmixT, and CmixTT
-        ChemicalScalar Cmix(nspecies), CmixT(nspecies), CmixTT(nspecies);
+        ChemicalScalar Cmix(nd), CmixT(nd), CmixTT(nd);
         for (int i = 0; i < 3; ++i) for (int k = 0; k < 3; ++k) for (int l = 0; l < 3; ++l)
         {
             Cmix += y[i] * y[k] * y[l] * C[i][k][l];
@@ -31,7 +31,7 @@ auto mineralChemicalModelIdeal(const MineralMixture& mixture) -> PhaseChemicalMo
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the mineral mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         // Fill the chemical properties of the mineral phase
         res.ln_activities = log(state.x);
@@ -37,7 +37,7 @@ auto mineralChemicalModelRedlichKister(const MineralMixture& mixture, double a0,
     PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
     {
         // Evaluate the state of the mineral mixture
-        state = mixture.state(T, P, n);
+        state = mixture.state(T, P, n, res.derivatives);
 
         const auto RT = universalGasConstant * state.T;
 
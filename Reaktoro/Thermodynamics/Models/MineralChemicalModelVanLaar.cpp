@@ -39,7 +39,7 @@
 //
 //    PhaseChemicalModel f = [=](double T, double P, VectorConstRef n) mutable
 //    {
-//        state = mixture.state(T, P, n);
+//        state = mixture.state(T, P, n, res.derivatives);
 //
 //        const auto RT = universalGasConstant * state.T;
 //        const auto& x = state.x;
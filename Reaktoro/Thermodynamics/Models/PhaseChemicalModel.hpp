@@ -54,6 +54,12 @@ struct PhaseChemicalModelResultBase
 
     /// The residual molar isochoric heat capacity of the phase w.r.t. to its ideal state (in units of J/(mol*K)).
     ScalarType residual_molar_heat_capacity_cv;
+
+    /// The flag that indicates if the partial molar derivatives of the properties are computed.
+    /// If false, the properties above have no molar derivatives (i.e., their `ddn` members have
+    /// zero columns), and the chemical model computes only their values and their partial
+    /// temperature and pressure derivatives.
+    bool derivatives = true;
 };
 
 /// The chemical properties of the species in a phase.
@@ -72,7 +72,7 @@ struct AqueousPhase::Impl
         PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
         {
             // Evaluate the state of the aqueous mixture
-            state = mixture.state(T, P, n);
+            state = mixture.state(T, P, n, res.derivatives);
 
             // Evaluate the aqueous chemical model
 			base_model(res, T, P, n);
@@ -43,130 +43,237 @@
 namespace Reaktoro {
 namespace internal {
 
-using MineralCatalystFunction = std::function<ChemicalScalar(const ChemicalProperties&)>;
-using MineralMechanismFunction = std::function<ChemicalScalar(const ChemicalProperties&)>;
-
-auto mineralCatalystFunctionActivity(const MineralCatalyst& catalyst, const ChemicalSystem& system) -> MineralCatalystFunction
+/// The parameters of a mineral catalyst in the rate table of a mineral reaction.
+struct MineralCatalystParams
 {
-    const double power = catalyst.power;
-    const std::string species = catalyst.species;
-    const Index ispecies = system.indexSpeciesWithError(species);
+    /// The index of the catalyst species in the system
+    Index ispecies;
 
-    MineralCatalystFunction fn = [=](const ChemicalProperties& properties) mutable
-    {
-        const ChemicalVector& ln_a = properties.lnActivities();
-        ChemicalScalar ai = exp(ln_a[ispecies]);
-        ChemicalScalar res = pow(ai, power);
-        return res;
-    };
+    /// The power of the catalyst
+    double power;
 
-    return fn;
-}
+    /// The index of the first gaseous species if the catalyst is a partial pressure, unused if it is an activity
+    Index ifirst;
+
+    /// The number of gaseous species if the catalyst is a partial pressure, zero if it is an activity
+    Index num_gases;
 
-auto mineralCatalystFunctionPartialPressure(const MineralCatalyst& catalyst, const ChemicalSystem& system) -> MineralCatalystFunction
+    /// The index of the catalyst species in the ln activity weights if it is an activity, unused if it is a partial pressure
+    Index iweight;
+};
+
+/// The parameters of a mineral mechanism in the rate table of a mineral reaction.
+struct MineralMechanismParams
 {
-    const auto gas         = catalyst.species;                           // the species of the catalyst
-    const auto power       = catalyst.power;                             // the power of the catalyst
-    const auto idx_phase   = system.indexPhase("Gaseous");               // the index of the gaseous phase
-    const auto gases       = names(system.phase(idx_phase).species());   // the names of the gaseous species
-    const auto igases      = system.indicesSpecies(gases);               // the indices of the gaseous species
-    const auto ifirst      = system.indexFirstSpeciesInPhase(idx_phase); // the index of the first gaseous species
-    const auto igas        = index(gas, gases);                          // the index of the gaseous species
-    const auto num_gases   = gases.size();                               // the number of gases
-
-    ChemicalScalar res;
-
-    MineralCatalystFunction fn = [=](const ChemicalProperties& properties) mutable
-    {
-        // The pressure and composition of the system
-        const auto P = properties.pressure();
-        const auto n = properties.composition();
+    /// The kinetic rate constant of the mechanism at 298.15 K (in units of mol/(m2*s))
+    double kappa;
 
-        // The molar composition of the gaseous species
-        const auto ng = rows(n, ifirst, num_gases);
+    /// The Arrhenius activation energy of the mechanism (in units of kJ/mol)
+    double Ea;
 
-        // The total number of moles in the gaseous phase
-        const auto ngsum = sum(ng);
+    /// The power parameters p and q of the mechanism
+    double p, q;
 
-        // The mole fraction of the gas
-        const auto xi = ng[igas]/ngsum;
+    /// The range [begin, end) of the catalysts of the mechanism in the rate table
+    Index begin, end;
+};
+
+/// The rate table of a mineral reaction with the parameters of all its mechanisms and catalysts.
+/// The mechanisms are evaluated in a single loop, sharing the saturation index of the mineral.
+struct MineralRateTable
+{
+    /// The parameters of the mechanisms of the mineral reaction
+    std::vector<MineralMechanismParams> mechanisms;
 
-        // The pressure in units of bar
-        const auto Pbar = convertPascalToBar(P);
+    /// The parameters of the catalysts of all mechanisms
+    std::vector<MineralCatalystParams> catalysts;
 
-        // Evaluate the mineral catalyst function
-        res = pow(xi * Pbar, power);
+    /// The indices of the species in the mineral reaction
+    Indices ireaction;
 
-        return res;
-    };
+    /// The stoichiometries of the species in the mineral reaction
+    Vector stoichiometries;
 
-    return fn;
-}
+    /// The indices of the species whose ln activities contribute to the rate derivatives
+    Indices iactivities;
+
+    /// The weights of the ln activity derivatives of the species in `iactivities`
+    Vector weights;
+
+    /// The values of the catalyst contributions in the last evaluation
+    Vector values;
+};
 
-auto mineralCatalystFunction(const MineralCatalyst& catalyst, const ChemicalSystem& system) -> MineralCatalystFunction
+auto mineralCatalystParams(const MineralCatalyst& catalyst, const ChemicalSystem& system) -> MineralCatalystParams
 {
-    if (catalyst.quantity == "a" || catalyst.quantity == "activity")
-        return mineralCatalystFunctionActivity(catalyst, system);
+    MineralCatalystParams params;
+    params.power = catalyst.power;
+
+    if(catalyst.quantity == "a" || catalyst.quantity == "activity")
+    {
+        params.ispecies = system.indexSpeciesWithError(catalyst.species);
+        params.ifirst = 0;
+        params.num_gases = 0;
+    }
     else
-        return mineralCatalystFunctionPartialPressure(catalyst, system);
+    {
+        const auto idx_phase = system.indexPhase("Gaseous");             // the index of the gaseous phase
+        const auto gases     = names(system.phase(idx_phase).species()); // the names of the gaseous species
+        params.ifirst        = system.indexFirstSpeciesInPhase(idx_phase);
+        params.num_gases     = gases.size();
+        params.ispecies      = params.ifirst + index(catalyst.species, gases);
+    }
+
+    return params;
 }
 
-auto mineralMechanismFunction(const MineralMechanism& mechanism, const Reaction& reaction, const ChemicalSystem& system) -> ReactionRateFunction
+auto mineralRateTable(const std::vector<MineralMechanism>& mechanisms, const Reaction& reaction, const ChemicalSystem& system) -> MineralRateTable
 {
-    // The number of chemical species in the system
-    const unsigned num_species = system.numSpecies();
+    MineralRateTable table;
+
+    for(const MineralMechanism& mechanism : mechanisms)
+    {
+        MineralMechanismParams params;
+        params.kappa = mechanism.kappa;
+        params.Ea = mechanism.Ea;
+        params.p = mechanism.p;
+        params.q = mechanism.q;
+        params.begin = table.catalysts.size();
+        for(const MineralCatalyst& catalyst : mechanism.catalysts)
+            table.catalysts.push_back(mineralCatalystParams(catalyst, system));
+        params.end = table.catalysts.size();
+        table.mechanisms.push_back(params);
+    }
+
+    table.ireaction = reaction.indices();
+    table.stoichiometries = reaction.stoichiometries();
+
+    // The species whose ln activities appear in the saturation index or in activity catalysts
+    table.iactivities = table.ireaction;
+    for(MineralCatalystParams& catalyst : table.catalysts)
+    {
+        if(catalyst.num_gases)
+            continue;
+        catalyst.iweight = index(catalyst.ispecies, table.iactivities);
+        if(catalyst.iweight == table.iactivities.size())
+            table.iactivities.push_back(catalyst.ispecies);
+    }
+
+    table.weights = zeros(table.iactivities.size());
+    table.values = zeros(table.catalysts.size());
 
+    return table;
+}
+
+/// Calculate the sum of the mechanism functions of a mineral reaction, without its surface area.
+auto mineralMechanismsSum(MineralRateTable& table, const Reaction& reaction, const ChemicalProperties& properties, ChemicalScalarRef res) -> void
+{
     // The universal gas constant (in units of kJ/(mol*K))
     const double R = 8.3144621e-3;
 
-    // Create the mineral catalyst functions
-    std::vector<MineralCatalystFunction> catalysts;
-    for(const MineralCatalyst& catalyst : mechanism.catalysts)
-        catalysts.push_back(mineralCatalystFunction(catalyst, system));
+    // The temperature and pressure of the system
+    const double T = properties.temperature();
+    const double P = properties.pressure();
 
-    // Auxiliary variables
-    ChemicalScalar aux, f, g;
+    // The ln activities of the species and the amounts of the species
+    const ChemicalVectorConstRef ln_a = properties.lnActivities();
+    const auto& n = properties.composition().val;
 
-    // Define the mineral mechanism function
-    ReactionRateFunction fn = [=](const ChemicalProperties& properties) mutable
-    {
-        // The temperature and pressure of the system
-        const Temperature T = properties.temperature();
+    // Calculate the saturation index of the mineral once for all mechanisms
+    const ThermoScalar lnK = reaction.lnEquilibriumConstant(properties);
 
-        // The result of this function evaluation
-        ChemicalScalar res(num_species);
+    double lnOmega = -lnK.val;
+    for(Index i = 0; i < table.ireaction.size(); ++i)
+        lnOmega += table.stoichiometries[i] * ln_a.val[table.ireaction[i]];
 
-        // Calculate the saturation index of the mineral
-        const auto lnK = reaction.lnEquilibriumConstant(properties);
-        const auto lnQ = reaction.lnReactionQuotient(properties);
-        const auto lnOmega = lnQ - lnK;
+    const double Omega = std::exp(lnOmega);
 
-        // Calculate the rate constant for the current mechanism
-        const auto kappa = mechanism.kappa * exp(-mechanism.Ea/R * (1.0/T - 1.0/298.15));
+    // The derivative of the sum of the mechanisms w.r.t. the ln saturation index
+    double dlnOmega = 0.0;
 
-        // Calculate the saturation index
-        const auto Omega = exp(lnOmega);
+    // The weights of the ln activity derivatives contributed by activity catalysts
+    Vector& weights = table.weights;
+    weights.fill(0.0);
+
+    res.val = 0.0;
+    res.ddT = 0.0;
+    res.ddP = 0.0;
+    res.ddn.fill(0.0);
+
+    for(const MineralMechanismParams& mechanism : table.mechanisms)
+    {
+        // Calculate the rate constant for the current mechanism and its temperature derivative
+        const double kappa = mechanism.kappa * std::exp(-mechanism.Ea/R * (1.0/T - 1.0/298.15));
+        const double kappaT = kappa * mechanism.Ea/(R*T*T);
 
         // Calculate the p and q powers of the saturation index Omega
-        const auto pOmega = pow(Omega, mechanism.p);
-        const auto qOmega = pow(1 - pOmega, mechanism.q);
+        const double pOmega = std::pow(Omega, mechanism.p);
+        const double qOmega = std::pow(1 - pOmega, mechanism.q);
+        const double qOmega_lnOmega = -mechanism.q * std::pow(1 - pOmega, mechanism.q - 1) * mechanism.p * pOmega;
 
         // Calculate the function f
-        f = kappa * qOmega;
+        const double f = kappa * qOmega;
 
-        // Calculate the function g
-        g = ChemicalScalar(num_species, 1.0);
-
-        for(const MineralCatalystFunction& catalyst : catalysts)
-            g *= catalyst(properties);
+        // Calculate the function g as the product of the catalyst contributions
+        double g = 1.0;
+        for(Index j = mechanism.begin; j < mechanism.end; ++j)
+        {
+            const MineralCatalystParams& catalyst = table.catalysts[j];
+            table.values[j] = catalyst.num_gases ?
+                std::pow(n[catalyst.ispecies]/rows(n, catalyst.ifirst, catalyst.num_gases).sum() * convertPascalToBar(P), catalyst.power) :
+                std::pow(std::exp(ln_a.val[catalyst.ispecies]), catalyst.power);
+            g *= table.values[j];
+        }
+
+        // Accumulate the mechanism function and its derivatives w.r.t. temperature and the saturation index
+        res.val += f * g;
+        res.ddT += kappaT * qOmega * g;
+        dlnOmega += kappa * qOmega_lnOmega * g;
+
+        // Accumulate the derivatives of the catalyst contributions
+        for(Index j = mechanism.begin; j < mechanism.end; ++j)
+        {
+            const MineralCatalystParams& catalyst = table.catalysts[j];
+
+            // The product of f and all other catalyst contributions of the mechanism
+            double fothers = f;
+            for(Index l = mechanism.begin; l < mechanism.end; ++l)
+                if(l != j) fothers *= table.values[l];
+
+            if(catalyst.num_gases)
+            {
+                // The derivatives of the power of the partial pressure of the gas w.r.t. pressure and the gaseous amounts
+                const double ngsum = rows(n, catalyst.ifirst, catalyst.num_gases).sum();
+                const double xi = n[catalyst.ispecies]/ngsum;
+                const double Pbar = convertPascalToBar(P);
+                const double dc = catalyst.power * std::pow(xi * Pbar, catalyst.power - 1);
+                res.ddP += fothers * dc * xi * convertPascalToBar(1.0);
+                res.ddn.segment(catalyst.ifirst, catalyst.num_gases).array() -= fothers * dc * Pbar * xi/ngsum;
+                res.ddn[catalyst.ispecies] += fothers * dc * Pbar/ngsum;
+            }
+            else
+            {
+                // The derivative of the power of the activity w.r.t. the ln activity of the catalyst species
+                weights[catalyst.iweight] += fothers * catalyst.power * table.values[j];
+            }
+        }
+    }
 
-        // Calculate the resulting mechanism function
-        res = f * g;
+    // Add the contribution of the saturation index to the weights of the ln activity derivatives
+    for(Index i = 0; i < table.ireaction.size(); ++i)
+        weights[i] += dlnOmega * table.stoichiometries[i];
 
-        return res;
-    };
+    res.ddT -= dlnOmega * lnK.ddT;
+    res.ddP -= dlnOmega * lnK.ddP;
 
-    return fn;
+    // Accumulate only the rows of the ln activity derivatives of the species in the reaction and catalysts
+    for(Index i = 0; i < table.iactivities.size(); ++i)
+    {
+        const Index ispecies = table.iactivities[i];
+        res.ddT += weights[i] * ln_a.ddT[ispecies];
+        res.ddP += weights[i] * ln_a.ddP[ispecies];
+        res.ddn += weights[i] * ln_a.ddn.row(ispecies);
+    }
 }
 
 inline auto surfaceAreaUnitError(std::string unit) -> void
@@ -436,9 +543,6 @@ auto molarSurfaceArea(const MineralReaction& reaction, const ChemicalSystem& sys
 
 auto createReaction(const MineralReaction& mineralrxn, const ChemicalSystem& system) -> Reaction
 {
-    // The number of chemical species in the system
-    const unsigned num_species = system.numSpecies();
-
     // The index of the mineral
     const Index imineral = system.indexSpeciesWithError(mineralrxn.mineral());
 
@@ -456,35 +560,27 @@ auto createReaction(const MineralReaction& mineralrxn, const ChemicalSystem& sys
     if(mineralrxn.equilibriumConstant())
         reaction.setEquilibriumConstant(mineralrxn.equilibriumConstant());
 
-    // Create the mineral mechanism functions
-    std::vector<ReactionRateFunction> mechanisms;
-    for(const MineralMechanism& mechanism : mineralrxn.mechanisms())
-        mechanisms.push_back(mineralMechanismFunction(mechanism, reaction, system));
+    // Create the rate table of the mineral mechanisms
+    MineralRateTable table = mineralRateTable(mineralrxn.mechanisms(), reaction, system);
 
-    // The sum function of the mechanism contributions
-    ChemicalScalar f(num_species);
-
-    // The rate of the reaction
-    ChemicalScalar res;
-
-    // Create the mineral rate function
-    ReactionRateFunction rate;
+    // Create the mineral rate function, which writes the sum of the mechanism contributions into the result and scales it
+    ReactionRateRefFunction rate;
 
     if(mineralrxn.surfaceArea())
     {
-        rate = [=](const ChemicalProperties& properties)
-        {
-            // The mineral reaction rate using specified surface area
-            ChemicalScalar r(num_species);
+        // The surface area of the mineral
+        const double surface_area = mineralrxn.surfaceArea();
 
-            // Iterate over all mechanism functions
-            for(const ReactionRateFunction& mechanism : mechanisms)
-                r += mechanism(properties);
+        rate = [=](const ChemicalProperties& properties, ChemicalScalarRef res) mutable
+        {
+            // Evaluate all mechanism functions
+            mineralMechanismsSum(table, reaction, properties, res);
 
             // Multiply the mechanism contributions by the surface area of the mineral
-            r *= mineralrxn.surfaceArea();
-
-            return r;
+            res.val *= surface_area;
+            res.ddT *= surface_area;
+            res.ddP *= surface_area;
+            res.ddn *= surface_area;
         };
     }
     else
@@ -492,30 +588,21 @@ auto createReaction(const MineralReaction& mineralrxn, const ChemicalSystem& sys
         // The molar surface area of the mineral
         const double molar_surface_area = molarSurfaceArea(mineralrxn, system);
 
-        // The surface area of the mineral
-        const double surface_area = mineralrxn.surfaceArea();
-
-        rate = [=](const ChemicalProperties& properties) mutable
+        rate = [=](const ChemicalProperties& properties, ChemicalScalarRef res) mutable
         {
-            // The composition of the chemical system
-            const auto n = properties.composition();
-
-            // The number of moles of the mineral
-            auto nm = n[imineral];
-
-            // Prevent negative mole numbers here for the solution of the ODEs
-            nm.val = std::max(nm.val, 0.0);
-
-            // Iterate over all mechanism functions
-            f = 0.0;
-            for(const ReactionRateFunction& mechanism : mechanisms)
-                f += mechanism(properties);
+            // The number of moles of the mineral, preventing negative mole numbers here for the solution of the ODEs
+            const double nm = std::max(properties.composition().val[imineral], 0.0);
 
-            // Multiply the mechanism contributions by the molar surface area of the mineral
-            f *= molar_surface_area;
+            // Evaluate all mechanism functions
+            mineralMechanismsSum(table, reaction, properties, res);
 
             // The rate of the reaction and its partial derivatives
-            return nm * f;
+            const double f = res.val;
+            res.val *= molar_surface_area * nm;
+            res.ddT *= molar_surface_area * nm;
+            res.ddP *= molar_surface_area * nm;
+            res.ddn *= molar_surface_area * nm;
+            res.ddn[imineral] += molar_surface_area * f;
         };
     }
 
@@ -18,6 +18,8 @@
 #include "TransportSolver.hpp"
 
 // C++ includes
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 // Reaktoro includes
@@ -332,6 +334,13 @@ auto TransportSolver::step(VectorRef u) -> void
     step(u, zeros(u.size()));
 }
 
+auto TransportSolver::maxTimeStep(double courant) const -> double
+{
+    if(velocity == 0.0)
+        return std::numeric_limits<double>::infinity();
+    return courant * mesh_.dx()/std::abs(velocity);
+}
+
 ReactiveTransportSolver::ReactiveTransportSolver(const ChemicalSystem& system)
 : system_(system), equilibriumsolver(system)
 {
@@ -360,7 +369,17 @@ auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> vo
 
 auto ReactiveTransportSolver::setTimeStep(double val) -> void
 {
-    transportsolver.setTimeStep(val);
+    dt = val;
+}
+
+auto ReactiveTransportSolver::setTimeStepOptions(const AdaptiveTimeStepOptions& options) -> void
+{
+    this->options = options;
+}
+
+auto ReactiveTransportSolver::setSelectiveUpdateOptions(const SelectiveUpdateOptions& options) -> void
+{
+    selective = options;
 }
 
 auto ReactiveTransportSolver::output() -> ChemicalOutput
@@ -378,34 +397,121 @@ auto ReactiveTransportSolver::initialize(const ChemicalField& field) -> void
     bf.resize(num_cells, num_elements);
     bs.resize(num_cells, num_elements);
     b.resize(num_cells, num_elements);
+    T.resize(num_cells);
+    P.resize(num_cells);
+
+    bref.resize(num_cells, num_elements);
+    Tref.resize(num_cells);
+    Pref.resize(num_cells);
+    bdelta = zeros(num_cells, num_elements);
+    equilibrated.assign(num_cells, false);
 
+    transportsolver.setTimeStep(dt);
     transportsolver.initialize();
 }
 
 auto ReactiveTransportSolver::step(ChemicalField& field) -> void
 {
     const auto& mesh = transportsolver.mesh();
-    const auto& num_elements = system_.numElements();
     const auto& num_cells = mesh.numCells();
     const auto& ifs = system_.indicesFluidSpecies();
     const auto& iss = system_.indicesSolidSpecies();
 
-    // Collect the amounts of elements in the solid and fluid species
-    for(Index icell = 0; icell < num_cells; ++icell)
+    // The time step of this step, limited by the number of transport sub-steps if adaptive
+    double dtstep = dt;
+    if(options.active)
     {
-        bf.row(icell) = field[icell].elementAmountsInSpecies(ifs);
-        bs.row(icell) = field[icell].elementAmountsInSpecies(iss);
+        const double dtmax = options.max_substeps * transportsolver.maxTimeStep(options.courant);
+        dtstep = std::max(options.min_step, std::min({dt, dtmax, options.max_step}));
     }
 
-    // Transport the elements in the fluid species
-    for(Index ielement = 0; ielement < num_elements; ++ielement)
+    // Keep the chemical states at the beginning of the step in case the step needs to be repeated
+    if(options.active && options.max_retries)
+        states0 = field.states();
+
+    // The time step first attempted in this step
+    const double dtfirst = dtstep;
+
+    std::vector<EquilibriumResult> results;
+
+    bool failed = false;
+
+    for(Index iretry = 0; ; ++iretry)
     {
-        transportsolver.setBoundaryValue(bbc[ielement]);
-        transportsolver.step(bf.col(ielement));
+        // Collect the amounts of elements in the solid and fluid species, including the
+        // changes transported into the cells whose equilibrium calculation was skipped
+        for(Index icell = 0; icell < num_cells; ++icell)
+        {
+            bf.row(icell) = field[icell].elementAmountsInSpecies(ifs) + tr(bdelta.row(icell));
+            bs.row(icell) = field[icell].elementAmountsInSpecies(iss);
+        }
+
+        b0.noalias() = bf + bs;
+
+        // Transport the elements in the fluid species
+        transport(dtstep);
+
+        // Sum the amounts of elements distributed among fluid and solid species
+        b.noalias() = bf + bs;
+
+        // Equilibrate the chemical states of all cells with the transported amounts of elements
+        field.temperature(T);
+        field.pressure(P);
+
+        // Select the cells to be equilibrated, skipping the quiescent ones if selective update is active
+        icells.clear();
+        for(Index icell = 0; icell < num_cells; ++icell)
+            if(!selective.active || !quiescent(icell))
+                icells.push_back(icell);
+
+        if(icells.size() == num_cells)
+            results = equilibriumsolver.solve(field.states(), T, P, b);
+        else
+        {
+            std::vector<ChemicalState> states;
+            states.reserve(icells.size());
+            for(Index icell : icells)
+                states.push_back(field[icell]);
+
+            results = equilibriumsolver.solve(states, rows(T, icells), rows(P, icells), rows(b, icells));
+
+            for(Index k = 0; k < icells.size(); ++k)
+                field[icells[k]] = states[k];
+        }
+
+        // Accept the step unless an equilibrium calculation failed and the step can still be repeated with half the time step
+        failed = std::any_of(results.begin(), results.end(),
+            [](const EquilibriumResult& result) { return !result.optimum.succeeded; });
+
+        if(!options.active || !failed || iretry == options.max_retries || dtstep <= options.min_step)
+            break;
+
+        field.states() = states0;
+        dtstep = std::max(0.5 * dtstep, options.min_step);
+    }
+
+    // Keep the conditions of the equilibrated cells and the changes of the skipped cells yet to be equilibrated
+    skipped = num_cells - icells.size();
+
+    if(skipped)
+        for(Index icell = 0; icell < num_cells; ++icell)
+            bdelta.row(icell) = b.row(icell) - tr(field[icell].elementAmounts());
+
+    for(Index k = 0; k < icells.size(); ++k)
+    {
+        const Index icell = icells[k];
+        equilibrated[icell] = results[k].optimum.succeeded;
+        bref.row(icell) = b.row(icell);
+        Tref[icell] = T[icell];
+        Pref[icell] = P[icell];
+        bdelta.row(icell).fill(0.0);
     }
 
-    // Sum the amounts of elements distributed among fluid and solid species
-    b.noalias() = bf + bs;
+    // Advance the time and choose the time step of the next step. If halving the time step did not
+    // help all equilibrium calculations to converge, the time step is not the cause and is restored
+    t += dtstep;
+    if(options.active)
+        dt = nextTimeStep(failed ? dtfirst : dtstep, results);
 
     for(auto output : outputs)
     {
@@ -414,14 +520,8 @@ auto ReactiveTransportSolver::step(ChemicalField& field) -> void
     }
 
     for(Index icell = 0; icell < num_cells; ++icell)
-    {
-        const double T = field[icell].temperature();
-        const double P = field[icell].pressure();
-        equilibriumsolver.solve(field[icell], T, P, b.row(icell));
-
         for(auto output : outputs)
             output.update(field[icell], icell);
-    }
 
     for(auto output : outputs)
         output.close();
@@ -429,4 +529,81 @@ auto ReactiveTransportSolver::step(ChemicalField& field) -> void
     ++steps;
 }
 
+auto ReactiveTransportSolver::transport(double dt) -> void
+{
+    const auto& num_elements = system_.numElements();
+
+    // The number of transport steps that satisfy the Courant condition within the time step
+    Index substeps = 1;
+    if(options.active)
+    {
+        const double dtmax = transportsolver.maxTimeStep(options.courant);
+        substeps = std::max<Index>(1, Index(std::ceil(dt/dtmax)));
+    }
+
+    // Reassemble and factorize the diffusion matrix only if the transport time step has changed
+    const double dtsub = dt/substeps;
+    if(dtsub != transportsolver.timeStep())
+    {
+        transportsolver.setTimeStep(dtsub);
+        transportsolver.initialize();
+    }
+
+    for(Index ielement = 0; ielement < num_elements; ++ielement)
+    {
+        transportsolver.setBoundaryValue(bbc[ielement]);
+        for(Index isubstep = 0; isubstep < substeps; ++isubstep)
+            transportsolver.step(bf.col(ielement));
+    }
+}
+
+auto ReactiveTransportSolver::quiescent(Index icell) const -> bool
+{
+    if(!equilibrated[icell])
+        return false;
+
+    const double reltol = selective.reltol;
+    const double abstol = selective.abstol;
+
+    if(std::abs(T[icell] - Tref[icell]) > reltol * Tref[icell])
+        return false;
+
+    if(std::abs(P[icell] - Pref[icell]) > reltol * Pref[icell])
+        return false;
+
+    return ((b.row(icell) - bref.row(icell)).array().abs() <= abstol + reltol * bref.row(icell).array().abs()).all();
+}
+
+auto ReactiveTransportSolver::nextTimeStep(double dt, const std::vector<EquilibriumResult>& results) const -> double
+{
+    // The average number of equilibrium iterations per cell
+    double iterations = 0.0;
+    for(const EquilibriumResult& result : results)
+        iterations += result.optimum.iterations;
+    iterations /= std::max<Index>(results.size(), 1);
+
+    // The largest change of the amount of an element in a cell, relative to the largest amount of the element
+    double change = 0.0;
+    for(Index ielement = 0; ielement < b.cols(); ++ielement)
+    {
+        const double scale = std::max(b.col(ielement).cwiseAbs().maxCoeff(), b0.col(ielement).cwiseAbs().maxCoeff());
+        if(scale > 0.0)
+            change = std::max(change, (b.col(ielement) - b0.col(ielement)).cwiseAbs().maxCoeff()/scale);
+    }
+
+    // The factor of the time step, limited by the target change of the amounts of elements
+    double factor = options.max_factor;
+    if(change > 0.0)
+        factor = std::min(factor, options.target_change/change);
+
+    // Prevent the time step from increasing if the equilibrium calculations are costly. The number of
+    // iterations does not necessarily decrease with the time step, so it does not reduce the time step
+    if(iterations > options.target_iterations)
+        factor = std::min(factor, 1.0);
+
+    factor = std::max(factor, options.min_factor);
+
+    return std::max(options.min_step, std::min(factor * dt, options.max_step));
+}
+
 } // namespace Reaktoro
@@ -18,6 +18,7 @@
 #pragma once
 
 // C++ includes
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -80,6 +81,10 @@ public:
 
     auto operator[](Index index) -> ChemicalState& { return m_states[index]; }
 
+    auto states() const -> const std::vector<ChemicalState>& { return m_states; }
+
+    auto states() -> std::vector<ChemicalState>& { return m_states; }
+
     auto set(const ChemicalState& state) -> void;
 
     auto temperature(VectorRef values) -> void;
@@ -235,6 +240,14 @@ public:
     /// Return the mesh.
     auto mesh() const -> const Mesh& { return mesh_; }
 
+    /// Return the time step for the numerical solution of the transport problem.
+    auto timeStep() const -> double { return dt; }
+
+    /// Return the largest time step of the explicit advection step for a given Courant number.
+    /// @param courant The Courant number `v*dt/dx`, which cannot exceed one
+    /// @return The largest time step (in s), or infinity if the velocity is zero
+    auto maxTimeStep(double courant) const -> double;
+
     /// Initialize the transport solver before method @ref step is executed.
     /// Setup coefficient matrix of the diffusion problem and factorize.
     auto initialize() -> void;
@@ -277,6 +290,63 @@ private:
     Vector u0;
 };
 
+/// The options for the adaptive time stepping of ReactiveTransportSolver.
+struct AdaptiveTimeStepOptions
+{
+    /// The boolean flag that indicates if the time step of the reactive transport calculation is adapted.
+    /// Otherwise, every step uses the time step set with ReactiveTransportSolver::setTimeStep.
+    bool active = false;
+
+    /// The maximum Courant number `v*dt/dx` of the transport steps.
+    /// The flux limiters of the advection step can double the upwind flux, so that
+    /// the amounts of elements remain non-negative only for Courant numbers up to 0.5.
+    double courant = 0.5;
+
+    /// The maximum number of transport steps performed within one equilibrium step.
+    /// If larger than one, the transport equations are sub-cycled whenever the time step
+    /// allowed by the chemistry exceeds the time step allowed by the Courant number.
+    Index max_substeps = 1;
+
+    /// The target average number of equilibrium iterations per cell in a step.
+    /// The time step does not increase after a step that exceeds this number of iterations.
+    double target_iterations = 10.0;
+
+    /// The target maximum change of the amount of an element in a cell in a step.
+    /// The change is relative to the largest amount of the element among all cells.
+    double target_change = 0.5;
+
+    /// The smallest factor by which the time step can decrease from one step to the next.
+    double min_factor = 0.2;
+
+    /// The largest factor by which the time step can increase from one step to the next.
+    double max_factor = 2.0;
+
+    /// The minimum time step (in s).
+    double min_step = 0.0;
+
+    /// The maximum time step (in s).
+    double max_step = std::numeric_limits<double>::infinity();
+
+    /// The maximum number of times a step is repeated with half its time step if an equilibrium calculation fails.
+    Index max_retries = 3;
+};
+
+/// The options for the selective update of the chemical states in ReactiveTransportSolver.
+struct SelectiveUpdateOptions
+{
+    /// The boolean flag that indicates if the equilibrium calculation is skipped in quiescent cells.
+    /// A cell is quiescent if its amounts of elements, temperature and pressure are within the tolerances
+    /// below of those used in its last equilibrium calculation. The changes of the amounts of elements in
+    /// a skipped cell are not lost, but carried over until the cell is equilibrated again.
+    bool active = false;
+
+    /// The relative tolerance for the changes of the amounts of elements, temperature and pressure.
+    double reltol = 1e-6;
+
+    /// The absolute tolerance for the changes of the amounts of elements (in mol).
+    double abstol = 1e-14;
+};
+
 /// Use this class for solving reactive transport problems.
 class ReactiveTransportSolver
 {
@@ -294,6 +364,21 @@ public:
 
     auto setTimeStep(double val) -> void;
 
+    /// Set the options for the adaptive time stepping of the reactive transport calculation.
+    auto setTimeStepOptions(const AdaptiveTimeStepOptions& options) -> void;
+
+    /// Set the options for the selective update of the chemical states of quiescent cells.
+    auto setSelectiveUpdateOptions(const SelectiveUpdateOptions& options) -> void;
+
+    /// Return the number of cells whose equilibrium calculation was skipped in the last step.
+    auto numSkippedCells() const -> Index { return skipped; }
+
+    /// Return the time step of the next reactive transport step (in s).
+    auto timeStep() const -> double { return dt; }
+
+    /// Return the time of the reactive transport calculation, advanced in every step (in s).
+    auto time() const -> double { return t; }
+
     auto system() const -> const ChemicalSystem& { return system_; }
 
     auto output() -> ChemicalOutput;
@@ -303,6 +388,15 @@ public:
     auto step(ChemicalField& field) -> void;
 
 private:
+    /// Transport the amounts of elements in the fluid species over a time step, sub-cycling the transport steps if needed.
+    auto transport(double dt) -> void;
+
+    /// Return true if the changes in a cell since its last equilibrium calculation are within the tolerances.
+    auto quiescent(Index icell) const -> bool;
+
+    /// Return the time step for the next step, based on the equilibrium results and the changes of the amounts of elements.
+    auto nextTimeStep(double dt, const std::vector<EquilibriumResult>& results) const -> double;
+
     /// The chemical system common to all degrees of freedom in the chemical field.
     ChemicalSystem system_;
 
@@ -327,8 +421,53 @@ private:
     /// The amounts of an element on each cell of the mesh.
     Matrix b;
 
+    /// The temperature on each cell of the mesh (in units of K).
+    Vector T;
+
+    /// The pressure on each cell of the mesh (in units of Pa).
+    Vector P;
+
     /// The current number of steps in the solution of the reactive transport equations.
     Index steps = 0;
+
+    /// The options for the adaptive time stepping.
+    AdaptiveTimeStepOptions options;
+
+    /// The time step of the next reactive transport step (in s).
+    double dt = 0.0;
+
+    /// The time of the reactive transport calculation (in s).
+    double t = 0.0;
+
+    /// The amounts of an element on each cell of the mesh at the beginning of the step.
+    Matrix b0;
+
+    /// The chemical states of the field at the beginning of the step, restored if the step is repeated.
+    std::vector<ChemicalState> states0;
+
+    /// The options for the selective update of the chemical states.
+    SelectiveUpdateOptions selective;
+
+    /// The amounts of an element on each cell of the mesh in the last equilibrium calculation of the cell.
+    Matrix bref;
+
+    /// The temperature on each cell of the mesh in the last equilibrium calculation of the cell (in units of K).
+    Vector Tref;
+
+    /// The pressure on each cell of the mesh in the last equilibrium calculation of the cell (in units of Pa).
+    Vector Pref;
+
+    /// The changes of the amounts of elements on each cell of the mesh not yet equilibrated.
+    Matrix bdelta;
+
+    /// The flags that indicate which cells have been successfully equilibrated at least once.
+    std::vector<bool> equilibrated;
+
+    /// The indices of the cells equilibrated in the current step.
+    Indices icells;
+
+    /// The number of cells whose equilibrium calculation was skipped in the last step.
+    Index skipped = 0;
 };
 
 } // namespace Reaktoro
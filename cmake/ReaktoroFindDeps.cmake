@@ -1,6 +1,9 @@
 # Find Boost library
 find_package(Boost REQUIRED)
 
+# Find the threads library of the platform (e.g., pthreads)
+find_package(Threads REQUIRED)
+
 if(REAKTORO_USE_OPENLIBM)
     find_package(openlibm REQUIRED)
 endif()
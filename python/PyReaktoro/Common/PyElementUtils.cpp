@@ -0,0 +1,40 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+#include <PyReaktoro/PyReaktoro.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ElementUtils.hpp>
+
+namespace Reaktoro {
+
+void exportElementUtils(py::module& m)
+{
+    auto elements1 = static_cast<std::vector<std::string>(*)()>(elements);
+    auto elements2 = static_cast<std::map<std::string, double>(*)(std::string)>(elements);
+
+    auto molarMass1 = static_cast<double(*)(const std::map<std::string, double>&)>(molarMass);
+    auto molarMass2 = static_cast<double(*)(std::string)>(molarMass);
+
+    m.def("elements", elements1);
+    m.def("elements", elements2);
+    m.def("atomicMass", atomicMass);
+    m.def("molarMass", molarMass1);
+    m.def("molarMass", molarMass2);
+    m.def("charge", charge);
+}
+
+} // namespace Reaktoro
@@ -19,12 +19,30 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Units.hpp>
+#include <Reaktoro/Common/UnitsVector.hpp>
 
 namespace Reaktoro {
 
 void exportUnits(py::module& m)
 {
-    m.def("convert", units::convert);
+    auto convert1 = static_cast<double(*)(double, const std::string&, const std::string&)>(units::convert);
+    auto convert2 = static_cast<Vector(*)(VectorConstRef, const std::string&, const std::string&)>(units::convert);
+
+    auto call1 = &units::UnitConverter::operator();
+    auto call2 = [](const units::UnitConverter& converter, VectorConstRef values) { return units::convert(values, converter); };
+
+    py::class_<units::UnitConverter>(m, "UnitConverter")
+        .def(py::init<>())
+        .def(py::init<const std::string&, const std::string&>())
+        .def("scale", &units::UnitConverter::scale)
+        .def("offset", &units::UnitConverter::offset)
+        .def("__call__", call1)
+        .def("__call__", call2)
+        ;
+
+    m.def("converter", units::converter, py::return_value_policy::copy);
+    m.def("convert", convert1);
+    m.def("convert", convert2);
     m.def("convertible", units::convertible);
 }
 
@@ -60,12 +60,24 @@ void exportChemicalOutput(py::module& m)
         .def("precision", &ChemicalOutput::precision)
         .def("scientific", &ChemicalOutput::scientific)
         .def("terminal", &ChemicalOutput::terminal)
+        .def("asynchronous", &ChemicalOutput::asynchronous)
+        .def("binary", &ChemicalOutput::binary)
+        .def("compression", &ChemicalOutput::compression)
+        .def("chunksize", &ChemicalOutput::chunksize)
         .def("quantities", &ChemicalOutput::quantities)
         .def("headings", &ChemicalOutput::headings)
         .def("open", &ChemicalOutput::open)
         .def("update", &ChemicalOutput::update)
         .def("close", &ChemicalOutput::close)
         ;
+
+    py::class_<ChemicalOutputData>(m, "ChemicalOutputData")
+        .def_readwrite("headings", &ChemicalOutputData::headings)
+        .def_readwrite("quantities", &ChemicalOutputData::quantities)
+        .def_readwrite("values", &ChemicalOutputData::values)
+        ;
+
+    m.def("readChemicalOutput", readChemicalOutput);
 }
 
 } // namespace Reaktoro
@@ -59,6 +59,7 @@ void exportChemicalPlot(py::module& m)
         .def("xlogscale", &ChemicalPlot::xlogscale, py::arg("base")=10)
         .def("ylogscale", &ChemicalPlot::ylogscale, py::arg("base")=10)
         .def("frequency", &ChemicalPlot::frequency)
+        .def("asynchronous", &ChemicalPlot::asynchronous)
         .def("__lshift__", lshift, py::return_value_policy::reference_internal)
         .def("open", &ChemicalPlot::open)
         .def("update", &ChemicalPlot::update)
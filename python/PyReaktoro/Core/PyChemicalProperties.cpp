@@ -33,10 +33,12 @@ void exportChemicalProperties(py::module& m)
     py::class_<ChemicalProperties>(m, "ChemicalProperties")
         .def(py::init<>())
         .def(py::init<const ChemicalSystem&>())
+        .def(py::init<const ChemicalSystem&, bool>())
         .def("update", update1)
         .def("update", update2)
         .def("update", update3)
         .def("update", update4)
+        .def("derivatives", &ChemicalProperties::derivatives)
         .def("temperature", &ChemicalProperties::temperature)
         .def("pressure", &ChemicalProperties::pressure)
         .def("composition", &ChemicalProperties::composition)
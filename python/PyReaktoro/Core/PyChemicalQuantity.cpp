@@ -44,6 +44,7 @@ void exportChemicalQuantity(py::module& m)
         .def("tag", &ChemicalQuantity::tag)
         .def("update", update1, py::return_value_policy::reference_internal)
         .def("update", update2, py::return_value_policy::reference_internal)
+        .def("bind", &ChemicalQuantity::bind, py::return_value_policy::reference_internal, py::keep_alive<1, 2>())
         .def("value", &ChemicalQuantity::value)
         .def("__call__", &ChemicalQuantity::value)
         ;
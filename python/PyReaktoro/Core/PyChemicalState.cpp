@@ -102,6 +102,9 @@ void exportChemicalState(py::module& m)
     auto phaseAmount3 = static_cast<double(ChemicalState::*)(Index, std::string) const>(&ChemicalState::phaseAmount);
     auto phaseAmount4 = static_cast<double(ChemicalState::*)(std::string, std::string) const>(&ChemicalState::phaseAmount);
 
+    auto properties1 = static_cast<ChemicalProperties(ChemicalState::*)() const>(&ChemicalState::properties);
+    auto properties2 = static_cast<ChemicalProperties(ChemicalState::*)(bool) const>(&ChemicalState::properties);
+
     auto output1 = static_cast<void(ChemicalState::*)(std::ostream&, int) const>(&ChemicalState::output);
     auto output2 = static_cast<void(ChemicalState::*)(std::string const&, int) const>(&ChemicalState::output);
 
@@ -167,7 +170,8 @@ void exportChemicalState(py::module& m)
         .def("phaseAmount", phaseAmount3)
         .def("phaseAmount", phaseAmount4)
         .def("phaseStabilityIndices", &ChemicalState::phaseStabilityIndices)
-        .def("properties", &ChemicalState::properties, py::keep_alive<1, 0>()) // keep returned ChemicalProperties object alive until ChemicalState object is garbage collected!
+        .def("properties", properties1, py::keep_alive<1, 0>()) // keep returned ChemicalProperties object alive until ChemicalState object is garbage collected!
+        .def("properties", properties2, py::keep_alive<1, 0>())
         .def("output", output1, py::arg("out"), py::arg("precision") = 6)
         .def("output", output2, py::arg("out"), py::arg("precision") = 6)
         .def("__repr__", [](const ChemicalState& self) { std::stringstream ss; ss << self; return ss.str(); })
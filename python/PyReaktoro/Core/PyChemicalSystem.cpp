@@ -75,6 +75,8 @@ void exportChemicalSystem(py::module& m)
         .def("indexSpeciesWithError", &ChemicalSystem::indexSpeciesWithError)
         .def("indexSpeciesAny", &ChemicalSystem::indexSpeciesAny)
         .def("indexSpeciesAnyWithError", &ChemicalSystem::indexSpeciesAnyWithError)
+        .def("indexSpeciesAlternative", &ChemicalSystem::indexSpeciesAlternative)
+        .def("indexSpeciesAlternativeWithError", &ChemicalSystem::indexSpeciesAlternativeWithError)
         .def("indexPhase", &ChemicalSystem::indexPhase)
         .def("indexPhaseWithError", &ChemicalSystem::indexPhaseWithError)
         .def("indexPhaseWithSpecies", &ChemicalSystem::indexPhaseWithSpecies)
@@ -32,12 +32,14 @@ void exportReaction(py::module& m)
     auto rate1 = static_cast<const ReactionRateFunction&(Reaction::*)() const>(&Reaction::rate);
     auto rate2 = static_cast<ChemicalScalar(Reaction::*)(const ChemicalProperties&) const>(&Reaction::rate);
 
+    auto setRate = static_cast<void(Reaction::*)(const ReactionRateFunction&)>(&Reaction::setRate);
+
     py::class_<Reaction>(m, "Reaction")
         .def(py::init<>())
         .def(py::init<const ReactionEquation&, const ChemicalSystem&>())
         .def("setName", &Reaction::setName)
         .def("setEquilibriumConstant", &Reaction::setEquilibriumConstant)
-        .def("setRate", &Reaction::setRate)
+        .def("setRate", setRate)
         .def("name", &Reaction::name)
         .def("equilibriumConstant", &Reaction::equilibriumConstant, py::return_value_policy::reference_internal)
         .def("equation", &Reaction::equation, py::return_value_policy::reference_internal)
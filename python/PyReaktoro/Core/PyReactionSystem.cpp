@@ -33,6 +33,8 @@ void exportReactionSystem(py::module& m)
     auto reaction1 = static_cast<const Reaction&(ReactionSystem::*)(Index) const>(&ReactionSystem::reaction);
     auto reaction2 = static_cast<const Reaction&(ReactionSystem::*)(std::string) const>(&ReactionSystem::reaction);
 
+    auto rates1 = static_cast<ChemicalVector(ReactionSystem::*)(const ChemicalProperties&) const>(&ReactionSystem::rates);
+
     py::class_<ReactionSystem>(m, "ReactionSystem")
         .def(py::init<>())
         .def(py::init<const ChemicalSystem&, const std::vector<Reaction>&>())
@@ -46,7 +48,7 @@ void exportReactionSystem(py::module& m)
         .def("system", &ReactionSystem::system, py::return_value_policy::reference_internal)
         .def("lnEquilibriumConstants", &ReactionSystem::lnEquilibriumConstants)
         .def("lnReactionQuotients", &ReactionSystem::lnReactionQuotients)
-        .def("rates", &ReactionSystem::rates)
+        .def("rates", rates1)
         ;
 }
 
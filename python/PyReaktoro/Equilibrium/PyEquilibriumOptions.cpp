@@ -36,15 +36,30 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol)
         ;
 
+    py::class_<BatchEquilibriumOptions>(m, "BatchEquilibriumOptions")
+        .def_readwrite("threads", &BatchEquilibriumOptions::threads)
+        .def_readwrite("reorder", &BatchEquilibriumOptions::reorder)
+        ;
+
+    py::class_<PruningEquilibriumOptions>(m, "PruningEquilibriumOptions")
+        .def_readwrite("active", &PruningEquilibriumOptions::active)
+        .def_readwrite("amount", &PruningEquilibriumOptions::amount)
+        .def_readwrite("potential", &PruningEquilibriumOptions::potential)
+        ;
+
     py::class_<EquilibriumOptions>(m, "EquilibriumOptions")
         .def(py::init<>())
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
         .def_readwrite("warmstart", &EquilibriumOptions::warmstart)
+        .def_readwrite("predictor", &EquilibriumOptions::predictor)
+        .def_readwrite("simplex", &EquilibriumOptions::simplex)
         .def_readwrite("hessian", &EquilibriumOptions::hessian)
         .def_readwrite("method", &EquilibriumOptions::method)
         .def_readwrite("optimum", &EquilibriumOptions::optimum)
         .def_readwrite("nonlinear", &EquilibriumOptions::nonlinear)
         .def_readwrite("smart", &EquilibriumOptions::smart)
+        .def_readwrite("batch", &EquilibriumOptions::batch)
+        .def_readwrite("pruning", &EquilibriumOptions::pruning)
         ;
 }
 
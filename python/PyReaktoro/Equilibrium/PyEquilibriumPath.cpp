@@ -30,6 +30,7 @@ namespace Reaktoro {
 void exportEquilibriumPath(py::module& m)
 {
     py::class_<EquilibriumPathOptions>(m, "EquilibriumPathOptions")
+        .def(py::init<>())
         .def_readwrite("equilibrium", &EquilibriumPathOptions::equilibrium)
         .def_readwrite("ode", &EquilibriumPathOptions::ode)
         ;
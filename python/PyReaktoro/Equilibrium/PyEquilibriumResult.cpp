@@ -28,10 +28,22 @@ void exportEquilibriumResult(py::module& m)
         .def_readwrite("succeeded", &SmartEquilibriumResult::succeeded)
         ;
 
+    py::class_<EquilibriumPredictorResult>(m, "EquilibriumPredictorResult")
+        .def_readwrite("predictions", &EquilibriumPredictorResult::predictions)
+        .def_readwrite("iterations_saved", &EquilibriumPredictorResult::iterations_saved)
+        ;
+
+    py::class_<EquilibriumPruningResult>(m, "EquilibriumPruningResult")
+        .def_readwrite("passes", &EquilibriumPruningResult::passes)
+        .def_readwrite("species", &EquilibriumPruningResult::species)
+        ;
+
     py::class_<EquilibriumResult>(m, "EquilibriumResult")
         .def(py::init<>())
         .def_readwrite("optimum", &EquilibriumResult::optimum)
         .def_readwrite("smart", &EquilibriumResult::smart)
+        .def_readwrite("predictor", &EquilibriumResult::predictor)
+        .def_readwrite("pruning", &EquilibriumResult::pruning)
         ;
 }
 
@@ -37,6 +37,19 @@ void exportEquilibriumSolver(py::module& m)
     auto solve3 = static_cast<EquilibriumResult(EquilibriumSolver::*)(ChemicalState&, const EquilibriumProblem&)>(&EquilibriumSolver::solve);
     auto solve4 = static_cast<EquilibriumResult(EquilibriumSolver::*)(ChemicalState&)>(&EquilibriumSolver::solve);
 
+    // The batch solve method receives a list of states that are updated in place
+    auto solve5 = [](EquilibriumSolver& self, py::list states, VectorConstRef T, VectorConstRef P, MatrixConstRef be)
+    {
+        std::vector<ChemicalState> batch;
+        batch.reserve(states.size());
+        for(auto item : states)
+            batch.push_back(item.cast<ChemicalState>());
+        auto results = self.solve(batch, T, P, be);
+        for(std::size_t i = 0; i < batch.size(); ++i)
+            states[i].cast<ChemicalState&>() = batch[i];
+        return results;
+    };
+
     auto approximate1 = static_cast<EquilibriumResult(EquilibriumSolver::*)(ChemicalState&, double, double, VectorConstRef)>(&EquilibriumSolver::approximate);
     auto approximate2 = static_cast<EquilibriumResult(EquilibriumSolver::*)(ChemicalState&, const EquilibriumProblem&)>(&EquilibriumSolver::approximate);
     auto approximate3 = static_cast<EquilibriumResult(EquilibriumSolver::*)(ChemicalState&)>(&EquilibriumSolver::approximate);
@@ -53,6 +66,7 @@ void exportEquilibriumSolver(py::module& m)
         .def("solve", solve2)
         .def("solve", solve3)
         .def("solve", solve4)
+        .def("solve", solve5)
         .def("properties", &EquilibriumSolver::properties, py::return_value_policy::reference_internal)
         .def("sensitivity", &EquilibriumSolver::sensitivity, py::return_value_policy::reference_internal)
 //        .def("dndT", &EquilibriumSolver::dndT, py::return_value_policy::reference_internal)
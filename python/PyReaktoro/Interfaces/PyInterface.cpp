@@ -101,6 +101,11 @@ public:
     {
         PYBIND11_OVERLOAD_PURE(std::shared_ptr<Interface>, Interface, clone);
     }
+
+    auto share() const -> std::shared_ptr<Interface>
+    {
+        PYBIND11_OVERLOAD(std::shared_ptr<Interface>, Interface, share);
+    }
 };
 
 void exportInterface(py::module& m)
@@ -124,6 +129,7 @@ void exportInterface(py::module& m)
         .def("properties", properties1)
         .def("properties", properties2)
         .def("clone", &Interface::clone)
+        .def("share", &Interface::share)
         .def("formulaMatrix", &Interface::formulaMatrix)
         .def("indexElement", &Interface::indexElement)
         .def("indexSpecies", &Interface::indexSpecies)
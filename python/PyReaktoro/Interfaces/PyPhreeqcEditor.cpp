@@ -34,6 +34,7 @@ auto exportPhreeqcEditor(py::module& m) -> void
         .def("setAqueousPhase", &PhreeqcEditor::setAqueousPhase)
         .def("setGaseousPhase", &PhreeqcEditor::setGaseousPhase)
         .def("setMineralPhases", &PhreeqcEditor::setMineralPhases)
+        .def("setNativeModels", &PhreeqcEditor::setNativeModels)
         ;
 }
 
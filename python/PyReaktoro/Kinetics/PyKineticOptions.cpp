@@ -29,11 +29,18 @@ void exportKineticOptions(py::module& m)
         .def_readwrite("format", &KineticOutputOptions::format)
         ;
 
+    py::class_<BatchKineticOptions>(m, "BatchKineticOptions")
+        .def_readwrite("threads", &BatchKineticOptions::threads)
+        .def_readwrite("reorder", &BatchKineticOptions::reorder)
+        .def_readwrite("warmstart", &BatchKineticOptions::warmstart)
+        ;
+
     py::class_<KineticOptions>(m, "KineticOptions")
         .def(py::init<>())
         .def_readwrite("equilibrium", &KineticOptions::equilibrium)
         .def_readwrite("ode", &KineticOptions::ode)
         .def_readwrite("output", &KineticOptions::output)
+        .def_readwrite("batch", &KineticOptions::batch)
         ;
 }
 
@@ -31,6 +31,20 @@ void exportKineticSolver(py::module& m)
     auto step1 = static_cast<double(KineticSolver::*)(ChemicalState&, double)>(&KineticSolver::step);
     auto step2 = static_cast<double(KineticSolver::*)(ChemicalState&, double, double)>(&KineticSolver::step);
 
+    auto solve1 = static_cast<void(KineticSolver::*)(ChemicalState&, double, double)>(&KineticSolver::solve);
+
+    // The batch solve method receives a list of states that are updated in place
+    auto solve2 = [](KineticSolver& self, py::list states, double t, double dt)
+    {
+        std::vector<ChemicalState> batch;
+        batch.reserve(states.size());
+        for(auto item : states)
+            batch.push_back(item.cast<ChemicalState>());
+        self.solve(batch, t, dt);
+        for(std::size_t i = 0; i < batch.size(); ++i)
+            states[i].cast<ChemicalState&>() = batch[i];
+    };
+
     py::class_<KineticSolver>(m, "KineticSolver")
         .def(py::init<const ReactionSystem&>())
         .def("setOptions", &KineticSolver::setOptions)
@@ -42,7 +56,8 @@ void exportKineticSolver(py::module& m)
         .def("initialize", &KineticSolver::initialize)
         .def("step", step1)
         .def("step", step2)
-        .def("solve", &KineticSolver::solve)
+        .def("solve", solve1)
+        .def("solve", solve2)
         ;
 }
 
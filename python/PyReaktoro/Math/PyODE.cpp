@@ -34,9 +34,21 @@ void exportODE(py::module& m)
         .value("Newton", ODEIterationMode::Newton)
         ;
 
+    py::enum_<ODELinearSolver>(m, "ODELinearSolver")
+        .value("Dense", ODELinearSolver::Dense)
+        .value("Banded", ODELinearSolver::Banded)
+        .value("KrylovSparseLU", ODELinearSolver::KrylovSparseLU)
+        .value("Krylov", ODELinearSolver::Krylov)
+        ;
+
     py::class_<ODEOptions>(m, "ODEOptions")
         .def(py::init<>())
         .def_readwrite("step", &ODEOptions::step)
+        .def_readwrite("iteration", &ODEOptions::iteration)
+        .def_readwrite("linear_solver", &ODEOptions::linear_solver)
+        .def_readwrite("upper_bandwidth", &ODEOptions::upper_bandwidth)
+        .def_readwrite("lower_bandwidth", &ODEOptions::lower_bandwidth)
+        .def_readwrite("max_krylov_dimension", &ODEOptions::max_krylov_dimension)
         .def_readwrite("stability_limit_detection", &ODEOptions::stability_limit_detection)
         .def_readwrite("initial_step", &ODEOptions::initial_step)
         .def_readwrite("stop_time", &ODEOptions::stop_time)
@@ -55,38 +67,44 @@ void exportODE(py::module& m)
         .def_readwrite("abstols", &ODEOptions::abstols)
         ;
 
-//
-//    auto function1 = static_cast<const ODEFunction&(ODEProblem::*)() const>(&ODEProblem::function);
-//    auto function2 = static_cast<int(ODEProblem::*)(double, VectorConstRef, VectorReff) const>(&ODEProblem::function);
-//
-//    auto jacobian1 = static_cast<const ODEJacobian&(ODEProblem::*)() const>(&ODEProblem::jacobian);
-//    auto jacobian2 = static_cast<int(ODEProblem::*)(double, VectorConstRef, MatrixReff) const>(&ODEProblem::jacobian);
-//
-//    py::class_<ODEProblem>(m, "ODEProblem")
-//        .def(py::init<>())
-//        .def("setNumEquations", &ODEProblem::setNumEquations)
-//        .def("setFunction", &ODEProblem::setFunction)
-//        .def("setJacobian", &ODEProblem::setJacobian)
-//        .def("initialized", &ODEProblem::initialized)
-//        .def("numEquations", &ODEProblem::numEquations)
-//        .def("function", function1, py::return_value_policy::reference_internal)
-//        .def("jacobian", jacobian1, py::return_value_policy::reference_internal)
-//        .def("function", function2)
-//        .def("jacobian", jacobian2)
-//        ;
-//
-//    auto integrate1 = static_cast<void(ODESolver::*)(double&, VectorRef)>(&ODESolver::integrate);
-//    auto integrate2 = static_cast<void(ODESolver::*)(double&, VectorRef, double)>(&ODESolver::integrate);
-//
-//    py::class_<ODESolver>(m, "ODESolver")
-//        .def(py::init<>())
-//        .def("setOptions", &ODESolver::setOptions)
-//        .def("setProblem", &ODESolver::setProblem)
-//        .def("initialize", &ODESolver::initialize)
-//        .def("integrate", integrate1)
-//        .def("integrate", integrate2)
-//        .def("solve", &ODESolver::solve)
-//        ;
+    // The functions of the problem are wrapped so that they return their results to Python,
+    // instead of writing them on arguments that Python cannot modify in place
+    auto setFunction = [](ODEProblem& self, std::function<Vector(double, Vector)> f)
+    {
+        self.setFunction([=](double t, VectorConstRef y, VectorRef res) { res = f(t, y); return 0; });
+    };
+
+    auto setJacobian = [](ODEProblem& self, std::function<Matrix(double, Vector)> J)
+    {
+        self.setJacobian([=](double t, VectorConstRef y, MatrixRef res) { res = J(t, y); return 0; });
+    };
+
+    py::class_<ODEProblem>(m, "ODEProblem")
+        .def(py::init<>())
+        .def("setNumEquations", &ODEProblem::setNumEquations)
+        .def("setFunction", setFunction)
+        .def("setJacobian", setJacobian)
+        .def("initialized", &ODEProblem::initialized)
+        .def("numEquations", &ODEProblem::numEquations)
+        ;
+
+    // The integration methods return the new time and variables, instead of updating their arguments
+    auto integrate1 = [](ODESolver& self, double t, Vector y) { self.integrate(t, y); return py::make_tuple(t, y); };
+    auto integrate2 = [](ODESolver& self, double t, Vector y, double tfinal) { self.integrate(t, y, tfinal); return py::make_tuple(t, y); };
+    auto solve = [](ODESolver& self, double t, double dt, Vector y) { self.solve(t, dt, y); return py::make_tuple(t, y); };
+
+    py::class_<ODESolver>(m, "ODESolver")
+        .def(py::init<>())
+        .def("setOptions", &ODESolver::setOptions)
+        .def("setProblem", &ODESolver::setProblem)
+        .def("initialize", &ODESolver::initialize)
+        .def("reinitialize", &ODESolver::reinitialize)
+        .def("lastStep", &ODESolver::lastStep)
+        .def("numSteps", &ODESolver::numSteps)
+        .def("integrate", integrate1)
+        .def("integrate", integrate2)
+        .def("solve", solve)
+        ;
 }
 
 } // namespace Reaktoro
@@ -39,6 +39,8 @@ void exportOptimumOptions(py::module& m)
         .def_readwrite("mu", &OptimumParamsIpNewton::mu)
         .def_readwrite("tau", &OptimumParamsIpNewton::tau)
         .def_readwrite("step", &OptimumParamsIpNewton::step)
+        .def_readwrite("max_reuse", &OptimumParamsIpNewton::max_reuse)
+        .def_readwrite("reuse_contraction", &OptimumParamsIpNewton::reuse_contraction)
         ;
 
     py::class_<OptimumParamsIpActive>(m, "OptimumParamsIpActive")
@@ -24,6 +24,7 @@ namespace Reaktoro {
 // Common module
 extern void exportAutoDiff(py::module& m);
 extern void exportEigen(py::module& m);
+extern void exportElementUtils(py::module& m);
 extern void exportIndex(py::module& m);
 extern void exportOpenlibm(py::module& m);
 extern void exportMatrix(py::module& m);
@@ -125,6 +126,7 @@ PYBIND11_MODULE(PyReaktoro, m)
 
     // Common module
     exportAutoDiff(m);
+    exportElementUtils(m);
     exportIndex(m);
     exportOpenlibm(m);
     exportMatrix(m);
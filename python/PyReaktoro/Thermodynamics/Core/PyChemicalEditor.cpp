@@ -78,6 +78,8 @@ void exportChemicalEditor(py::module& m)
         .def(py::init<const ThermoFun::Database&>())
         .def("setTemperatures", setTemperatures)
         .def("setPressures", setPressures)
+        .def("setThreads", &ChemicalEditor::setThreads)
+        .def("setCacheDirectory", &ChemicalEditor::setCacheDirectory)
         .def("addPhase", addPhase1, py::return_value_policy::reference_internal)
         .def("addPhase", addPhase2, py::return_value_policy::reference_internal)
         .def("addPhase", addPhase3, py::return_value_policy::reference_internal)
@@ -48,6 +48,8 @@ void exportDatabase(py::module& m)
         .def(py::init<>())
         .def(py::init<std::string>())
         .def(py::init<const ThermoFun::Database&>())
+        .def("save", &Database::save)
+        .def("digest", &Database::digest)
         .def("elements", &Database::elements)
 		.def("addElement", &Database::addElement)
         .def("aqueousSpecies", aqueousSpecies1)
@@ -26,6 +26,18 @@ namespace Reaktoro {
 
 void exportThermo(py::module& m)
 {
+    // The methods over arrays of temperatures and pressures return a new matrix, since numpy arrays are row-major by default
+    using BatchMethod = void(Thermo::*)(VectorConstRef, VectorConstRef, const std::vector<std::string>&, MatrixRef) const;
+    auto batch = [](BatchMethod method)
+    {
+        return [=](const Thermo& thermo, VectorConstRef T, VectorConstRef P, const std::vector<std::string>& names) -> Matrix
+        {
+            Matrix res(T.size(), names.size());
+            (thermo.*method)(T, P, names, res);
+            return res;
+        };
+    };
+
     py::class_<Thermo>(m, "Thermo")
         .def(py::init<const Database&>())
         .def("standardPartialMolarGibbsEnergy", &Thermo::standardPartialMolarGibbsEnergy, (py::arg("T"), py::arg("P"), "species"))
@@ -48,6 +60,17 @@ void exportThermo(py::module& m)
         .def("standardPartialMolarHeatCapacityConstV", &Thermo::standardPartialMolarHeatCapacityConstV)
         .def("lnEquilibriumConstant", &Thermo::lnEquilibriumConstant)
         .def("logEquilibriumConstant", &Thermo::logEquilibriumConstant)
+        .def("setThreads", &Thermo::setThreads)
+        .def("standardPartialMolarGibbsEnergies", batch(&Thermo::standardPartialMolarGibbsEnergies))
+        .def("standardPartialMolarHelmholtzEnergies", batch(&Thermo::standardPartialMolarHelmholtzEnergies))
+        .def("standardPartialMolarInternalEnergies", batch(&Thermo::standardPartialMolarInternalEnergies))
+        .def("standardPartialMolarEnthalpies", batch(&Thermo::standardPartialMolarEnthalpies))
+        .def("standardPartialMolarEntropies", batch(&Thermo::standardPartialMolarEntropies))
+        .def("standardPartialMolarVolumes", batch(&Thermo::standardPartialMolarVolumes))
+        .def("standardPartialMolarHeatCapacitiesConstP", batch(&Thermo::standardPartialMolarHeatCapacitiesConstP))
+        .def("standardPartialMolarHeatCapacitiesConstV", batch(&Thermo::standardPartialMolarHeatCapacitiesConstV))
+        .def("lnEquilibriumConstants", batch(&Thermo::lnEquilibriumConstants))
+        .def("logEquilibriumConstants", batch(&Thermo::logEquilibriumConstants))
         ;
 }
 
@@ -77,6 +77,8 @@ void exportTransportSolver(py::module& m)
         .def("setBoundaryValue", &TransportSolver::setBoundaryValue)
         .def("setTimeStep", &TransportSolver::setTimeStep)
         .def("mesh", &TransportSolver::mesh, py::return_value_policy::reference_internal)
+        .def("timeStep", &TransportSolver::timeStep)
+        .def("maxTimeStep", &TransportSolver::maxTimeStep)
         .def("initialize", &TransportSolver::initialize)
         .def("step", step1)
         .def("step", step2)
@@ -85,6 +87,27 @@ void exportTransportSolver(py::module& m)
 
 void exportReactiveTransportSolver(py::module& m)
 {
+    py::class_<AdaptiveTimeStepOptions>(m, "AdaptiveTimeStepOptions")
+        .def(py::init<>())
+        .def_readwrite("active", &AdaptiveTimeStepOptions::active)
+        .def_readwrite("courant", &AdaptiveTimeStepOptions::courant)
+        .def_readwrite("max_substeps", &AdaptiveTimeStepOptions::max_substeps)
+        .def_readwrite("target_iterations", &AdaptiveTimeStepOptions::target_iterations)
+        .def_readwrite("target_change", &AdaptiveTimeStepOptions::target_change)
+        .def_readwrite("min_factor", &AdaptiveTimeStepOptions::min_factor)
+        .def_readwrite("max_factor", &AdaptiveTimeStepOptions::max_factor)
+        .def_readwrite("min_step", &AdaptiveTimeStepOptions::min_step)
+        .def_readwrite("max_step", &AdaptiveTimeStepOptions::max_step)
+        .def_readwrite("max_retries", &AdaptiveTimeStepOptions::max_retries)
+        ;
+
+    py::class_<SelectiveUpdateOptions>(m, "SelectiveUpdateOptions")
+        .def(py::init<>())
+        .def_readwrite("active", &SelectiveUpdateOptions::active)
+        .def_readwrite("reltol", &SelectiveUpdateOptions::reltol)
+        .def_readwrite("abstol", &SelectiveUpdateOptions::abstol)
+        ;
+
     py::class_<ReactiveTransportSolver>(m, "ReactiveTransportSolver")
         .def(py::init<const ChemicalSystem&>())
         .def("setMesh", &ReactiveTransportSolver::setMesh)
@@ -92,6 +115,11 @@ void exportReactiveTransportSolver(py::module& m)
         .def("setDiffusionCoeff", &ReactiveTransportSolver::setDiffusionCoeff)
         .def("setBoundaryState", &ReactiveTransportSolver::setBoundaryState)
         .def("setTimeStep", &ReactiveTransportSolver::setTimeStep)
+        .def("setTimeStepOptions", &ReactiveTransportSolver::setTimeStepOptions)
+        .def("setSelectiveUpdateOptions", &ReactiveTransportSolver::setSelectiveUpdateOptions)
+        .def("numSkippedCells", &ReactiveTransportSolver::numSkippedCells)
+        .def("timeStep", &ReactiveTransportSolver::timeStep)
+        .def("time", &ReactiveTransportSolver::time)
         .def("system", &ReactiveTransportSolver::system, py::return_value_policy::reference_internal)
         .def("output", &ReactiveTransportSolver::output)
         .def("initialize", &ReactiveTransportSolver::initialize)
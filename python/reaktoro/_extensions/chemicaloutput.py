@@ -1,7 +1,78 @@
+import struct
+import zlib
+
 import numpy as np
 import pandas as pd
 from reaktoro.PyReaktoro import ChemicalOutput
 
+_BINARY_MAGIC = b"RKTOUTBN"
+_BINARY_VERSION = 1
+
+
+def _read_binary_output(filename):
+    """
+    Read the headings, quantity names and values of a file written by ChemicalOutput in binary format.
+    All numbers in the file are stored in little-endian byte order.
+
+    :return:
+        A tuple with the list of headings, the list of quantity names, and a numpy array
+        with one row per update and one column per heading.
+    """
+    with open(filename, "rb") as file:
+        content = file.read()
+
+    if content[:8] != _BINARY_MAGIC:
+        raise ValueError(f"The file `{filename}` was not written by ChemicalOutput in binary format.")
+
+    version, compression, num_columns = struct.unpack_from("<III", content, 8)
+    if version != _BINARY_VERSION:
+        raise ValueError(f"The version {version} of the binary format of file `{filename}` is not supported.")
+
+    offset = 20
+
+    def read_string():
+        nonlocal offset
+        (length,) = struct.unpack_from("<I", content, offset)
+        string = content[offset + 4:offset + 4 + length].decode()
+        offset += 4 + length
+        return string
+
+    headings, quantities = [], []
+    for _ in range(num_columns):
+        headings.append(read_string())
+        quantities.append(read_string())
+
+    chunks = []
+    while offset < len(content):
+        num_rows, num_bytes = struct.unpack_from("<QQ", content, offset)
+        payload = content[offset + 16:offset + 16 + num_bytes]
+        offset += 16 + num_bytes
+        if compression > 0:
+            shuffled = np.frombuffer(zlib.decompress(payload), dtype=np.uint8)
+            payload = shuffled.reshape(8, -1).T.tobytes()
+        chunk = np.frombuffer(payload, dtype="<f8").reshape(num_columns, num_rows).T
+        chunks.append(chunk)
+
+    values = np.vstack(chunks) if chunks else np.empty((0, num_columns))
+    return headings, quantities, values
+
+
+def _is_binary_output(filename):
+    with open(filename, "rb") as file:
+        return file.read(8) == _BINARY_MAGIC
+
+
+def read_chemical_output(filename):
+    """
+    Read a file written by ChemicalOutput in binary format into a pandas DataFrame.
+
+    :return:
+        A pandas DataFrame with the headings of the file as columns.
+    :rtype pd.DataFrame:
+    """
+    headings, _, values = _read_binary_output(filename)
+    return pd.DataFrame(values, columns=headings)
+
 
 def _ChemicalOutput_to_array(self):
     """
@@ -11,6 +82,8 @@ def _ChemicalOutput_to_array(self):
         An numpy array with data from ChemicalOutput.
     :rtype numpy.ndarray:
     """
+    if _is_binary_output(self.filename()):
+        return _read_binary_output(self.filename())[2]
     output_array = np.loadtxt(self.filename(), skiprows=1)
     return output_array
 
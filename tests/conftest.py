@@ -11,6 +11,8 @@ from reaktoro import (
     Partition,
     EquilibriumProblem,
     EquilibriumInverseProblem,
+    ReactionSystem,
+    equilibrate,
 )
 
 import thermofun.PyThermoFun as thermofun
@@ -40,6 +42,37 @@ def equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar():
     return (system, problem)
 
 
+@pytest.fixture(scope="function")
+def equilibrium_problem_with_h2o_co2_nacl_caco3_mgco3_undersaturated_minerals_60C_100bar():
+    """
+    Build a problem with 1 kg of H2O, 1 mol of CO2, 0.1 mol of NaCl, 10 mmol
+    of CaCO3 and 5 mmol of MgCO3 at 60 °C and 100 bar, in which Halite,
+    Calcite, Magnesite and Dolomite are undersaturated
+    """
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3 MgCO3 CO2")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Halite")
+    editor.addMineralPhase("Calcite")
+    editor.addMineralPhase("Magnesite")
+    editor.addMineralPhase("Dolomite")
+
+    system = ChemicalSystem(editor)
+
+    problem = EquilibriumProblem(system)
+    problem.add("H2O", 1, "kg")
+    problem.add("CO2", 1, "mol")
+    problem.add("NaCl", 0.1, "mol")
+    problem.add("CaCO3", 10, "mmol")
+    problem.add("MgCO3", 5, "mmol")
+    problem.setTemperature(60, "celsius")
+    problem.setPressure(100, "bar")
+
+    return (system, problem)
+
+
 @pytest.fixture(scope="function")
 def equilibrium_problem_with_h2o_co2_nacl_halite_dissolved_60C_300bar():
     """
@@ -289,6 +322,60 @@ def equilibrium_inverse_with_h2o_nacl_caco3_co2_calcite_fixed_phase_volume():
     return (system, problem)
 
 
+@pytest.fixture(scope="function")
+def kinetic_problem_with_h2o_nacl_co2_calcite_magnesite_dolomite():
+    """
+    Build a kinetic problem with 1 kg of H2O, 1 mol of NaCl and 1 mol of CO2
+    in equilibrium, and 100 g of Calcite and 50 g of Dolomite dissolving and
+    Magnesite precipitating kinetically
+    """
+    database = Database("supcrt98.xml")
+
+    editor = ChemicalEditor(database)
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCO3 MgCO3 HCl")
+    editor.addGaseousPhase(["H2O(g)", "CO2(g)"])
+    editor.addMineralPhase("Calcite")
+    editor.addMineralPhase("Magnesite")
+    editor.addMineralPhase("Dolomite")
+    editor.addMineralPhase("Halite")
+
+    calcite_reaction = editor.addMineralReaction("Calcite")
+    calcite_reaction.setEquation("Calcite = Ca++ + CO3--")
+    calcite_reaction.addMechanism("logk = -5.81 mol/(m2*s); Ea = 23.5 kJ/mol")
+    calcite_reaction.addMechanism("logk = -0.30 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    calcite_reaction.setSpecificSurfaceArea(10, "cm2/g")
+
+    magnesite_reaction = editor.addMineralReaction("Magnesite")
+    magnesite_reaction.setEquation("Magnesite = Mg++ + CO3--")
+    magnesite_reaction.addMechanism("logk = -9.34 mol/(m2*s); Ea = 23.5 kJ/mol")
+    magnesite_reaction.addMechanism("logk = -6.38 mol/(m2*s); Ea = 14.4 kJ/mol; a[H+] = 1.0")
+    magnesite_reaction.setSpecificSurfaceArea(10, "cm2/g")
+
+    dolomite_reaction = editor.addMineralReaction("Dolomite")
+    dolomite_reaction.setEquation("Dolomite = Ca++ + Mg++ + 2*CO3--")
+    dolomite_reaction.addMechanism("logk = -7.53 mol/(m2*s); Ea = 52.2 kJ/mol")
+    dolomite_reaction.addMechanism("logk = -3.19 mol/(m2*s); Ea = 36.1 kJ/mol; a[H+] = 0.5")
+    dolomite_reaction.setSpecificSurfaceArea(10, "cm2/g")
+
+    system = ChemicalSystem(editor)
+    reactions = ReactionSystem(editor)
+
+    partition = Partition(system)
+    partition.setKineticSpecies(["Calcite", "Magnesite", "Dolomite"])
+
+    problem = EquilibriumProblem(system)
+    problem.setPartition(partition)
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 1, "mol")
+    problem.add("CO2", 1, "mol")
+
+    state = equilibrate(problem)
+    state.setSpeciesMass("Calcite", 100, "g")
+    state.setSpeciesMass("Dolomite", 50, "g")
+
+    return (reactions, partition, state)
+
+
 @pytest.fixture(scope="function")
 def state_regression(num_regression, request):
 
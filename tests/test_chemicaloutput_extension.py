@@ -6,6 +6,7 @@ import pandas as pd
 import pytest
 from reaktoro import ChemicalEditor, ChemicalSystem, ReactionSystem, Partition, ChemicalState
 from reaktoro import EquilibriumProblem, equilibrate, KineticPath
+from reaktoro import readChemicalOutput, read_chemical_output
 
 
 @pytest.fixture
@@ -123,3 +124,40 @@ def test_chemicaloutput_to_dataframe(
 
     assert type(output_df) is pd.DataFrame
     assert list(output_df.columns) == list(dict_with_properties_to_output.keys())
+
+
+@pytest.mark.parametrize("compression", [0, 6])
+@pytest.mark.parametrize("asynchronous", [False, True])
+def test_chemicaloutput_binary(
+    brine_co2_path: Tuple[KineticPath, ChemicalState],
+    tmp_path: pathlib.Path,
+    dict_with_properties_to_output: Dict,
+    compression: int,
+    asynchronous: bool,
+):
+    path, state = brine_co2_path
+
+    text_output = path.output()
+    text_output.filename(str(tmp_path / "test_output_path.txt"))
+    text_output.precision(16)
+    for property_name, unit in dict_with_properties_to_output.items():
+        text_output.add(unit, property_name)
+    path.solve(ChemicalState(state), 0.0, 25.0, "hours")
+
+    binary_output = path.output()
+    binary_output.filename(str(tmp_path / "test_output_path.bin"))
+    binary_output.binary(True)
+    binary_output.compression(compression)
+    binary_output.chunksize(7)
+    binary_output.asynchronous(asynchronous)
+    for property_name, unit in dict_with_properties_to_output.items():
+        binary_output.add(unit, property_name)
+    path.solve(ChemicalState(state), 0.0, 25.0, "hours")
+
+    data = readChemicalOutput(binary_output.filename())
+
+    assert data.headings == list(dict_with_properties_to_output.keys())
+    assert data.quantities == list(dict_with_properties_to_output.values())
+    assert np.allclose(data.values, text_output.to_array(), rtol=1e-14)
+    assert np.array_equal(binary_output.to_array(), data.values)
+    assert list(read_chemical_output(binary_output.filename()).columns) == data.headings
@@ -67,3 +67,20 @@ def test_chemical_properties_partial_volumes(chemical_system, chemical_propertie
     only_updated_by_temperature_and_pressure.update(chemical_properties.temperature().val, chemical_properties.pressure().val)
     for pVol in only_updated_by_temperature_and_pressure.partialMolarVolumes().val:
         assert pVol == 0.0
+
+
+def test_chemical_properties_without_derivatives(chemical_system, chemical_properties):
+    T = chemical_properties.temperature().val
+    P = chemical_properties.pressure().val
+    n = chemical_properties.composition().val
+
+    properties = ChemicalProperties(chemical_system, False)
+    properties.update(T, P, n)
+
+    assert chemical_properties.derivatives()
+    assert not properties.derivatives()
+    assert properties.lnActivities().ddn.shape[1] == 0
+    assert properties.lnActivities().val == pytest.approx(chemical_properties.lnActivities().val)
+    assert properties.lnActivities().ddT == pytest.approx(chemical_properties.lnActivities().ddT)
+    assert properties.phaseVolumes().val == pytest.approx(chemical_properties.phaseVolumes().val)
+    assert properties.phaseMasses().val == pytest.approx(chemical_properties.phaseMasses().val)
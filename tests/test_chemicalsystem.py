@@ -15,9 +15,11 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+import threading
+
 from reaktoro import *
 from pytest import approx, raises
-from numpy import array
+from numpy import array, array_equal
 
 
 def names(objects):
@@ -144,6 +146,35 @@ def test_chemical_system():
     with raises(RuntimeError):
         assert system.indexSpeciesWithError("AaBb2")
 
+    # The alternative names of the aqueous species are not recognized by indexSpecies
+    assert system.indexSpecies("H2O") == Ns
+    assert system.indexSpecies("H[+]") == Ns
+    assert system.indexSpecies("CO3-2") == Ns
+    assert system.indexSpecies("CO2") == Ns
+
+    # -------------------------------------------------------------------------
+    # Check method ChemicalSystem::indexSpeciesAlternative
+    # -------------------------------------------------------------------------
+    for i, species in enumerate(system.species()):
+        assert system.indexSpeciesAlternative(species.name()) == i
+
+    assert system.indexSpeciesAlternative("H2O") == system.indexSpecies("H2O(l)")
+    assert system.indexSpeciesAlternative("H2O@") == system.indexSpecies("H2O(l)")
+    assert system.indexSpeciesAlternative("H[+]") == system.indexSpecies("H+")
+    assert system.indexSpeciesAlternative("CO3-2") == system.indexSpecies("CO3--")
+    assert system.indexSpeciesAlternative("CO3[2-]") == system.indexSpecies("CO3--")
+    assert system.indexSpeciesAlternative("CO2") == system.indexSpecies("CO2(aq)")
+    assert system.indexSpeciesAlternative("CO2@") == system.indexSpecies("CO2(aq)")
+    assert system.indexSpeciesAlternativeWithError("OH[-]") == system.indexSpecies("OH-")
+
+    # Only the aqueous species have alternative names
+    assert system.indexSpeciesAlternative("CO2(g)") == system.indexSpecies("CO2(g)")
+    assert system.indexSpeciesAlternative("Graphite(aq)") == Ns
+    assert system.indexSpeciesAlternative("AaBb2") == Ns
+
+    with raises(RuntimeError):
+        assert system.indexSpeciesAlternativeWithError("AaBb2")
+
     # -------------------------------------------------------------------------
     # Check method ChemicalSystem::indexSpeciesAny
     # -------------------------------------------------------------------------
@@ -281,3 +312,95 @@ def test_chemical_system():
     assert all(system.properties(T, P, n).phaseVolumes().val == properties.phaseVolumes().val)
     assert all(system.properties(T, P, n).lnActivities().val == properties.lnActivities().val)
     assert all(system.properties(T, P, n).chemicalPotentials().val == properties.chemicalPotentials().val)
+
+
+def test_chemical_system_ambiguous_alternative_names():
+    """Test the alternative names of aqueous species shared by more than one species."""
+
+    def element(name):
+        e = Element()
+        e.setName(name)
+        return e
+
+    Ca, C, O, Z = element("Ca"), element("C"), element("O"), element("Z")
+
+    def species(name, elements):
+        s = Species()
+        s.setName(name)
+        s.setFormula(name)
+        s.setElements(elements)
+        return s
+
+    aqueous = Phase()
+    aqueous.setName("Aqueous")
+    aqueous.setSpecies([
+        species("Ca++", {Ca: 1, Z: 2}),
+        species("Ca+2", {Ca: 1, Z: 2}),
+        species("CO2(aq)", {C: 1, O: 2}),
+        species("CO2@", {C: 1, O: 2}),
+        species("CO3--", {C: 1, O: 3, Z: -2}),
+    ])
+
+    gaseous = Phase()
+    gaseous.setName("Gaseous")
+    gaseous.setSpecies([species("CO2", {C: 1, O: 2})])
+
+    system = ChemicalSystem([aqueous, gaseous])
+    Ns = system.numSpecies()
+
+    # The names of the species take precedence over the alternative names of other species
+    assert system.indexSpeciesAlternative("Ca++") == 0
+    assert system.indexSpeciesAlternative("Ca+2") == 1
+    assert system.indexSpeciesAlternative("CO2(aq)") == 2
+    assert system.indexSpeciesAlternative("CO2@") == 3
+    assert system.indexSpeciesAlternative("CO2") == 5
+
+    # The alternative names shared by Ca++ and Ca+2, and by CO2(aq) and CO2@, are ambiguous
+    assert system.indexSpeciesAlternative("Ca[2+]") == Ns
+    assert system.indexSpeciesAlternative("CO2,aq") == Ns
+
+    with raises(RuntimeError):
+        system.indexSpeciesAlternativeWithError("Ca[2+]")
+
+    # The alternative names of a single species are not ambiguous
+    assert system.indexSpeciesAlternative("CO3-2") == 4
+    assert system.indexSpeciesAlternative("CO3[2-]") == 4
+
+
+def test_chemical_system_properties_in_many_threads(chemical_system):
+    """Test the properties of a ChemicalSystem evaluated in many threads, each with its own copy of the chemical model."""
+    P = 1e5
+    n = array([55, 1e-7, 1e-7, 0.1, 0.5, 0.01, 1.0, 0.001, 1.0])
+
+    # The temperatures used by each thread, so that the threads do not share the same inputs
+    nthreads = 4
+    temperatures = [300.0 + 10.0 * i for i in range(nthreads)]
+
+    def evaluate(T):
+        properties = chemical_system.properties(T, P, n)
+        return (
+            array(properties.standardPartialMolarGibbsEnergies().val),
+            array(properties.lnActivityCoefficients().val),
+            array(properties.lnActivities().val),
+            array(properties.phaseVolumes().val),
+        )
+
+    # Evaluate the properties of the system in each thread many times at the same time
+    barrier = threading.Barrier(nthreads)
+    results = [None] * nthreads
+
+    def work(i):
+        barrier.wait()
+        for k in range(10):
+            results[i] = evaluate(temperatures[i])
+
+    threads = [threading.Thread(target=work, args=(i,)) for i in range(nthreads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    # Assert the properties are the same as those evaluated serially
+    for T, result in zip(temperatures, results):
+        for actual, expected in zip(result, evaluate(T)):
+            assert array_equal(actual, expected)
@@ -15,7 +15,10 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with this library. If not, see <http://www.gnu.org/licenses/>.
 
-from reaktoro import EquilibriumSolver, ChemicalState, EquilibriumProblem, equilibrate
+import numpy as np
+import pytest
+
+from reaktoro import EquilibriumSolver, EquilibriumOptions, ChemicalState, EquilibriumProblem, equilibrate
 
 
 def _create_equilibrium_problem(partition_with_inert_gaseous_phase):
@@ -96,3 +99,202 @@ def test_equilibrium_solver_with_chemical_state(partition_with_inert_gaseous_pha
     assert state.speciesAmount('CO2(g)') == 1.0
     assert state.speciesAmount('H2O(g)') == 0.001
 
+
+
+def test_equilibrium_solver_with_batch_of_states(equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar):
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar
+
+    T = problem.temperature()
+    P = problem.pressure()
+    b = problem.elementAmounts()
+
+    # Solve a batch of problems with scaled amounts of elements, given in non-sorted order
+    scales = [2.0, 0.5, 1.0]
+    states = [ChemicalState(system) for scale in scales]
+
+    solver = EquilibriumSolver(system)
+    results = solver.solve(states, np.full(3, T), np.full(3, P), np.array([scale * b for scale in scales]))
+
+    # Assert each state in the batch is the same as the one computed individually
+    for scale, state, result in zip(scales, states, results):
+        expected = ChemicalState(system)
+        EquilibriumSolver(system).solve(expected, T, P, scale * b)
+
+        assert result.optimum.succeeded
+        assert np.allclose(state.speciesAmounts(), expected.speciesAmounts(), rtol=1e-6, atol=1e-12)
+
+
+@pytest.mark.parametrize("threads", [1, 3], ids=["one thread", "three threads"])
+@pytest.mark.parametrize("reorder", [True, False], ids=["reordered", "in given order"])
+def test_equilibrium_solver_with_batch_of_states_at_different_conditions(equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar, reorder, threads):
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar
+
+    # Solve a batch of problems at different temperatures, pressures and amounts of elements
+    T = problem.temperature() + np.array([0.0, 20.0, -10.0, 40.0, 5.0])
+    P = problem.pressure() + np.array([0.0, 50.0, -100.0, 20.0, 0.0]) * 1e5
+    b = np.array([scale * problem.elementAmounts() for scale in [2.0, 0.5, 1.0, 1.5, 0.8]])
+
+    options = EquilibriumOptions()
+    options.batch.reorder = reorder
+    options.batch.threads = threads
+
+    states = [ChemicalState(system) for i in range(len(T))]
+
+    solver = EquilibriumSolver(system)
+    solver.setOptions(options)
+    results = solver.solve(states, T, P, b)
+
+    # Assert each state in the batch is the same as the one computed individually
+    for i, (state, result) in enumerate(zip(states, results)):
+        expected = ChemicalState(system)
+        EquilibriumSolver(system).solve(expected, T[i], P[i], b[i])
+
+        assert result.optimum.succeeded
+        assert np.allclose(state.speciesAmounts(), expected.speciesAmounts(), rtol=1e-6, atol=1e-12)
+
+
+def test_equilibrium_solver_with_reused_kkt_decompositions(equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar):
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar
+
+    # Solve the problem without and with the simplified Newton mode of IpNewton
+    def solve(max_reuse):
+        options = EquilibriumOptions()
+        options.optimum.tolerance = 1e-8
+        options.optimum.ipnewton.max_reuse = max_reuse
+        options.optimum.ipnewton.reuse_contraction = 0.9
+
+        state = ChemicalState(system)
+        solver = EquilibriumSolver(system)
+        solver.setOptions(options)
+        result = solver.solve(state, problem)
+
+        assert result.optimum.succeeded
+
+        return state.speciesAmounts(), solver.sensitivity().dndb
+
+    n0, dndb0 = solve(0)
+    n1, dndb1 = solve(10)
+
+    # Assert the species amounts are the same
+    assert np.allclose(n1, n0, rtol=1e-6, atol=1e-12)
+
+    # Assert the sensitivities are computed with a KKT decomposition at the final iterate
+    assert np.linalg.norm(dndb1 - dndb0) < 2e-4 * np.linalg.norm(dndb0)
+
+
+def test_equilibrium_solver_with_predicted_initial_guesses(equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar):
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar
+
+    T = problem.temperature()
+    P = problem.pressure()
+    b = problem.elementAmounts()
+
+    # Solve a ramp of temperature, pressure and amounts of elements without and with the predictor
+    def solve(predictor):
+        options = EquilibriumOptions()
+        options.predictor = predictor
+
+        state = ChemicalState(system)
+        solver = EquilibriumSolver(system)
+        solver.setOptions(options)
+
+        amounts = []
+        predictions = 0
+        for k in range(11):
+            result = solver.solve(state, T + 2.0 * k, P + 1e5 * k, (1.0 + 0.01 * k) * b)
+            assert result.optimum.succeeded
+            amounts.append(state.speciesAmounts())
+            predictions += result.predictor.predictions
+
+        return amounts, predictions
+
+    amounts0, predictions0 = solve(False)
+    amounts1, predictions1 = solve(True)
+
+    # Assert every calculation after the first one was predicted from the last state
+    assert predictions0 == 0
+    assert predictions1 == 10
+
+    # Assert the predicted initial guesses converge to the same states
+    for n1, n0 in zip(amounts1, amounts0):
+        assert np.allclose(n1, n0, rtol=1e-6, atol=1e-12)
+
+
+def test_equilibrium_solver_with_pruned_inactive_phases(equilibrium_problem_with_h2o_co2_nacl_caco3_mgco3_undersaturated_minerals_60C_100bar):
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_caco3_mgco3_undersaturated_minerals_60C_100bar
+
+    T = problem.temperature()
+    P = problem.pressure()
+    b = problem.elementAmounts()
+
+    # Solve a sequence of problems without and with the pruning of the undersaturated minerals
+    def solve(pruning):
+        options = EquilibriumOptions()
+        options.pruning.active = pruning
+
+        state = ChemicalState(system)
+        solver = EquilibriumSolver(system)
+        solver.setOptions(options)
+
+        amounts, results = [], []
+        for k in range(5):
+            result = solver.solve(state, T + 5.0 * k, P, (1.0 + 0.1 * k) * b)
+            assert result.optimum.succeeded
+            amounts.append(state.speciesAmounts())
+            results.append(result)
+
+        return amounts, results
+
+    amounts0, results0 = solve(False)
+    amounts1, results1 = solve(True)
+
+    # Assert the minerals are undersaturated, so that they can be pruned
+    minerals = ["Halite", "Calcite", "Magnesite", "Dolomite"]
+    for mineral in minerals:
+        assert amounts0[-1][system.indexSpecies(mineral)] < 1e-12
+
+    # Assert no phase is pruned unless requested
+    for result in results0:
+        assert result.pruning.passes == 0
+
+    # Assert the optimisation passes of every calculation are performed without the undersaturated minerals
+    for result in results1:
+        assert result.pruning.passes > 0
+        assert result.pruning.species == len(minerals)
+
+    # Assert the reduced problems converge to the same states as the full problems
+    for n1, n0 in zip(amounts1, amounts0):
+        assert np.allclose(n1, n0, rtol=1e-6, atol=1e-12)
+
+
+def test_equilibrium_solver_with_simplex_cold_starts(equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar):
+    (system, problem) = equilibrium_problem_with_h2o_co2_nacl_halite_60C_300bar
+
+    T = problem.temperature()
+    P = problem.pressure()
+    b = problem.elementAmounts()
+
+    # Solve problems from uninitialized states, whose cold-start approximations are
+    # re-optimized from the last simplex basis when the simplex method is used
+    def solve(simplex):
+        options = EquilibriumOptions()
+        options.simplex = simplex
+
+        solver = EquilibriumSolver(system)
+        solver.setOptions(options)
+
+        amounts = []
+        for k in range(6):
+            state = ChemicalState(system)
+            result = solver.solve(state, T, P, (1.0 + 0.2 * k) * b)
+            assert result.optimum.succeeded
+            amounts.append(state.speciesAmounts())
+
+        return amounts
+
+    amounts0 = solve(False)
+    amounts1 = solve(True)
+
+    # Assert the simplex initial guesses converge to the same states
+    for n1, n0 in zip(amounts1, amounts0):
+        assert np.allclose(n1, n0, rtol=1e-6, atol=1e-12)
@@ -0,0 +1,106 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import numpy as np
+import pytest
+
+from reaktoro import KineticOptions, KineticSolver, ODELinearSolver
+
+
+def _solve_kinetic_problem(reactions, partition, state, options, t, dt):
+    solver = KineticSolver(reactions)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+    solver.solve(state, t, dt)
+
+
+def _create_kinetic_options():
+    # Use tight tolerances, so that different integrations of the same problem can be compared
+    options = KineticOptions()
+    options.ode.reltol = 1e-6
+    options.ode.abstol = 1e-14
+    return options
+
+
+@pytest.mark.parametrize(
+    "linear_solver",
+    [ODELinearSolver.KrylovSparseLU, ODELinearSolver.Krylov],
+    ids=["krylov-sparse-lu", "krylov"],
+)
+def test_kinetic_solver_with_linear_solvers(kinetic_problem_with_h2o_nacl_co2_calcite_magnesite_dolomite, linear_solver):
+    (reactions, partition, initial_state) = kinetic_problem_with_h2o_nacl_co2_calcite_magnesite_dolomite
+
+    dt = 24 * 3600
+
+    # Integrate with the dense linear solver
+    expected = initial_state.clone()
+    _solve_kinetic_problem(reactions, partition, expected, _create_kinetic_options(), 0, dt)
+
+    # Integrate with the given linear solver
+    options = _create_kinetic_options()
+    options.ode.linear_solver = linear_solver
+
+    state = initial_state.clone()
+    _solve_kinetic_problem(reactions, partition, state, options, 0, dt)
+
+    # Assert the kinetic path has advanced and reached the same state
+    assert state.speciesAmount("Calcite") < initial_state.speciesAmount("Calcite")
+    assert np.allclose(state.speciesAmounts(), expected.speciesAmounts(), rtol=1e-4, atol=1e-12)
+
+
+@pytest.mark.parametrize("threads", [1, 3], ids=["one-thread", "three-threads"])
+@pytest.mark.parametrize("reorder", [True, False], ids=["reorder", "no-reorder"])
+@pytest.mark.parametrize("warmstart", [True, False], ids=["warmstart", "no-warmstart"])
+def test_kinetic_solver_with_batch_of_states(kinetic_problem_with_h2o_nacl_co2_calcite_magnesite_dolomite, reorder, warmstart, threads):
+    (reactions, partition, initial_state) = kinetic_problem_with_h2o_nacl_co2_calcite_magnesite_dolomite
+
+    dt = 24 * 3600
+
+    # Create states with different amounts of the dissolving minerals
+    scales = [1.0, 0.5, 2.0, 0.1]
+    initial_states = []
+    for scale in scales:
+        state = initial_state.clone()
+        state.setSpeciesMass("Calcite", 100 * scale, "g")
+        state.setSpeciesMass("Dolomite", 50 / scale, "g")
+        initial_states.append(state)
+
+    # Integrate the batch of states over two consecutive time intervals
+    options = _create_kinetic_options()
+    options.batch.reorder = reorder
+    options.batch.warmstart = warmstart
+    options.batch.threads = threads
+
+    solver = KineticSolver(reactions)
+    solver.setOptions(options)
+    solver.setPartition(partition)
+
+    states = [state.clone() for state in initial_states]
+    solver.solve(states, 0, dt / 4)
+    solver.solve(states, dt / 4, dt / 4)
+
+    # Assert each state in the batch is the one obtained by integrating it alone
+    for state, initial in zip(states, initial_states):
+        solver = KineticSolver(reactions)
+        solver.setOptions(_create_kinetic_options())
+        solver.setPartition(partition)
+
+        expected = initial.clone()
+        solver.solve(expected, 0, dt / 4)
+        solver.solve(expected, dt / 4, dt / 4)
+
+        assert np.allclose(state.speciesAmounts(), expected.speciesAmounts(), rtol=1e-5, atol=1e-12)
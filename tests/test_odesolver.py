@@ -0,0 +1,71 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import numpy as np
+import pytest
+
+from reaktoro import ODELinearSolver, ODEOptions, ODEProblem, ODESolver
+
+
+def _diffusion_matrix(num_points):
+    # The tridiagonal matrix of the discretized one-dimensional diffusion equation
+    A = -2.0 * np.eye(num_points) + np.eye(num_points, k=1) + np.eye(num_points, k=-1)
+    return 100.0 * A
+
+
+@pytest.mark.parametrize("with_jacobian", [True, False], ids=["jacobian", "finite-differences"])
+@pytest.mark.parametrize(
+    "linear_solver",
+    [ODELinearSolver.Dense, ODELinearSolver.Banded],
+    ids=["dense", "banded"],
+)
+def test_ode_solver_with_tridiagonal_jacobian(linear_solver, with_jacobian):
+    num_points = 50
+    A = _diffusion_matrix(num_points)
+
+    y0 = np.zeros(num_points)
+    y0[20:30] = 1.0
+
+    tfinal = 0.01
+
+    # The exact solution of y' = A*y, with A symmetric
+    (eigenvalues, eigenvectors) = np.linalg.eigh(A)
+    expected = eigenvectors @ np.diag(np.exp(eigenvalues * tfinal)) @ eigenvectors.T @ y0
+
+    problem = ODEProblem()
+    problem.setNumEquations(num_points)
+    problem.setFunction(lambda t, y: A @ y)
+    if with_jacobian:
+        problem.setJacobian(lambda t, y: A)
+
+    # The Jacobian has only one diagonal above and below the main one
+    options = ODEOptions()
+    options.reltol = 1e-8
+    options.abstol = 1e-12
+    options.linear_solver = linear_solver
+    options.upper_bandwidth = 1
+    options.lower_bandwidth = 1
+
+    solver = ODESolver()
+    solver.setOptions(options)
+    solver.setProblem(problem)
+    solver.initialize(0.0, y0)
+
+    (t, y) = solver.solve(0.0, tfinal, y0)
+
+    assert t == pytest.approx(tfinal)
+    assert np.allclose(y, expected, rtol=0, atol=1e-7)
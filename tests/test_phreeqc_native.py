@@ -0,0 +1,175 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+import numpy as np
+import pytest
+from pathlib import Path
+from reaktoro import ChemicalState, ChemicalSystem, Phreeqc, PhreeqcEditor, waterMolarMass
+
+# The universal gas constant used in Reaktoro (in units of J/(mol*K))
+R = 8.3144621
+
+# The directory of the PHREEQC databases distributed with Reaktoro, such as pitzer.dat and sit.dat
+DATABASES = Path(__file__).resolve().parents[1] / "databases" / "phreeqc"
+
+# The elements and the composition of the brine used in the comparisons
+ELEMENTS = "Na Cl Ca Mg C S"
+
+SOLUTION = """
+    units mol/kgw
+    Na    0.5
+    Cl    0.55
+    Ca    0.02
+    Mg    0.05
+    C     0.002
+    S(6)  0.03
+    pH    7.5
+"""
+
+
+def _database_path(path):
+    # all '\' (from Windows path format) needs to be change to '/'.
+    return '/'.join([i.replace('\\', '') for i in path.parts])
+
+
+def _create_engine_and_native_systems(database, temperature):
+    """Return the Phreeqc instance, its system and state, and the native system for the brine."""
+    phreeqc = Phreeqc(database)
+    phreeqc.execute("SOLUTION\n    temp {}\n{}\nEND\n".format(temperature, SOLUTION))
+    engine = phreeqc.system()
+    state = phreeqc.state(engine)
+
+    editor = PhreeqcEditor(database)
+    editor.setAqueousPhase(ELEMENTS)
+    editor.setNativeModels(True)
+    native = ChemicalSystem(editor)
+
+    return phreeqc, engine, state, native
+
+
+def _native_indices(engine, native):
+    """Return the indices in the native system of the species in the Phreeqc system, or None if missing."""
+    indices = []
+    for i in range(engine.numSpecies()):
+        j = native.indexSpecies(engine.species(i).name())
+        indices.append(j if j < native.numSpecies() else None)
+    return indices
+
+
+def _native_properties(engine, state, native):
+    """Return the properties of the Phreeqc and native systems evaluated at the state of the Phreeqc system."""
+    T = state.temperature()
+    P = state.pressure()
+    n = np.array(state.speciesAmounts())
+    nn = np.full(native.numSpecies(), 1e-20)
+    for i, j in enumerate(_native_indices(engine, native)):
+        if j is not None:
+            nn[j] = n[i]
+    return engine.properties(T, P, n), native.properties(T, P, nn)
+
+
+@pytest.mark.parametrize("temperature", [25.0, 60.0, 90.0])
+@pytest.mark.parametrize("filename", ["phreeqc.dat", "pitzer.dat", "sit.dat"])
+def test_phreeqc_native_models_against_engine(shared_datadir, filename, temperature):
+    """Test the native models of a PHREEQC database against the PHREEQC engine."""
+    path = shared_datadir / filename if filename == "phreeqc.dat" else DATABASES / filename
+    database = _database_path(path)
+    phreeqc, engine, state, native = _create_engine_and_native_systems(database, temperature)
+    properties_engine, properties_native = _native_properties(engine, state, native)
+
+    T = state.temperature()
+    indices = _native_indices(engine, native)
+    n = np.array(state.speciesAmounts())
+
+    # The equilibrium constants of the reactions in the PHREEQC engine, with the native standard molar Gibbs
+    # energies of the species (the electron is not in the native system, and its Gibbs energy is zero)
+    G = np.array(properties_native.standardPartialMolarGibbsEnergies().val)
+    G = np.array([G[j] if j is not None else 0.0 for j in indices])
+    S = np.array(phreeqc.stoichiometricMatrix())
+    lnK_engine = np.array(phreeqc.lnEquilibriumConstants())
+    lnK_native = -S.dot(G)/(R*T)
+    assert lnK_native == pytest.approx(lnK_engine, abs=1e-6)
+
+    # The activity coefficients of the solutes present in the solution
+    ln_g_engine = np.array(properties_engine.lnActivityCoefficients().val)
+    ln_g_native = np.array(properties_native.lnActivityCoefficients().val)
+    for i, j in enumerate(indices):
+        if j is None or engine.species(i).name() == "H2O" or n[i] < 1e-12:
+            continue
+        assert ln_g_native[j] == pytest.approx(ln_g_engine[i], abs=1e-4)
+
+    # The activity of water, which the engine calculates from the osmotic coefficient only in the
+    # Pitzer and SIT models (it uses the mole fraction of water in the ion-association model)
+    if filename != "phreeqc.dat":
+        iwater = engine.indexSpecies("H2O")
+        jwater = native.indexSpecies("H2O")
+        ln_aw_engine = properties_engine.lnActivities().val[iwater]
+        ln_aw_native = properties_native.lnActivities().val[jwater]
+        assert ln_aw_native == pytest.approx(ln_aw_engine, abs=1e-6)
+
+    # The density of water, from its standard molar volume, which is 18.016/rho cm3/mol in PHREEQC
+    # (PHREEQC scales the saturation pressure of water by its activity, hence the small differences)
+    iwater = engine.indexSpecies("H2O")
+    jwater = native.indexSpecies("H2O")
+    rho_engine = 18.016e-3/properties_engine.standardPartialMolarVolumes().val[iwater]
+    rho_native = waterMolarMass/properties_native.standardPartialMolarVolumes().val[jwater]
+    assert rho_native == pytest.approx(rho_engine, rel=1e-5)
+
+
+def test_phreeqc_native_element_molar_masses(shared_datadir):
+    """Test the molar masses of the elements in the native system, in kg/mol as in the PHREEQC engine."""
+    database = _database_path(shared_datadir / 'phreeqc.dat')
+    phreeqc, engine, state, native = _create_engine_and_native_systems(database, 25.0)
+
+    for i in range(engine.numElements()):
+        element = engine.element(i)
+        if element.name() == "e":
+            continue  # the electron is not in the native system
+        j = native.indexElement(element.name())
+        assert j < native.numElements()
+        assert native.element(j).molarMass() == pytest.approx(element.molarMass(), rel=1e-12)
+
+    # The molar mass of water from the molar masses of its elements (in units of kg/mol)
+    water = native.species(native.indexSpecies("H2O"))
+    assert water.molarMass() == pytest.approx(waterMolarMass, rel=1e-3)
+
+
+@pytest.mark.parametrize("filename", ["phreeqc.dat", "pitzer.dat", "sit.dat"])
+def test_phreeqc_native_models_without_derivatives(shared_datadir, filename):
+    """Test the native models of a PHREEQC database evaluated without derivatives against those evaluated with them."""
+    path = shared_datadir / filename if filename == "phreeqc.dat" else DATABASES / filename
+    database = _database_path(path)
+    phreeqc, engine, state, native = _create_engine_and_native_systems(database, 60.0)
+
+    n = np.array(state.speciesAmounts())
+    nn = np.full(native.numSpecies(), 1e-20)
+    for i, j in enumerate(_native_indices(engine, native)):
+        if j is not None:
+            nn[j] = n[i]
+
+    native_state = ChemicalState(native)
+    native_state.setTemperature(state.temperature())
+    native_state.setPressure(state.pressure())
+    native_state.setSpeciesAmounts(nn)
+
+    expected = native_state.properties()
+    actual = native_state.properties(False)
+
+    assert np.array(actual.lnActivities().ddn).size == 0
+    assert np.array_equal(actual.lnActivityCoefficients().val, expected.lnActivityCoefficients().val)
+    assert np.array_equal(actual.lnActivities().val, expected.lnActivities().val)
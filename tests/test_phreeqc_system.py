@@ -0,0 +1,183 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import threading
+
+import numpy as np
+import pytest
+from reaktoro import Phreeqc
+
+
+def _create_phreeqc(shared_datadir):
+    # all '\' (from Windows path format) needs to be change to '/'.
+    database_path = '/'.join([i.replace('\\', '') for i in (shared_datadir / 'phreeqc.dat').parts])
+    input_path = '/'.join([i.replace('\\', '') for i in (shared_datadir / 'IW.pqi').parts])
+
+    phreeqc = Phreeqc(database_path)
+    phreeqc.execute(input_path)
+
+    return phreeqc
+
+
+def test_phreeqc_system_properties_in_many_threads(shared_datadir):
+    """Test the properties of a Phreeqc chemical system evaluated in many threads."""
+    phreeqc = _create_phreeqc(shared_datadir)
+    system = phreeqc.system()
+    state = phreeqc.state(system)
+
+    P = state.pressure()
+    n = state.speciesAmounts()
+
+    # The temperatures used by each thread, so that the threads do not share the same inputs
+    nthreads = 4
+    temperatures = [state.temperature() + 10.0 * i for i in range(nthreads)]
+
+    def evaluate(T):
+        properties = system.properties(T, P, n)
+        return (
+            np.array(properties.standardPartialMolarGibbsEnergies().val),
+            np.array(properties.lnActivityCoefficients().val),
+            np.array(properties.lnActivities().val),
+            np.array(properties.phaseVolumes().val),
+        )
+
+    # Evaluate the properties of the system in each thread many times at the same time
+    barrier = threading.Barrier(nthreads)
+    results = [None] * nthreads
+
+    def work(i):
+        barrier.wait()
+        for k in range(10):
+            results[i] = evaluate(temperatures[i])
+
+    threads = [threading.Thread(target=work, args=(i,)) for i in range(nthreads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    # Assert the properties are the same as those evaluated serially
+    for T, result in zip(temperatures, results):
+        for actual, expected in zip(result, evaluate(T)):
+            assert np.array_equal(actual, expected)
+
+
+def test_phreeqc_system_evaluated_serially_on_the_phreeqc_instance(shared_datadir):
+    """Test that a Phreeqc chemical system evaluated in one thread uses the Phreeqc instance instead of a clone."""
+    phreeqc = _create_phreeqc(shared_datadir)
+    system = phreeqc.system()
+    state = phreeqc.state(system)
+
+    T = state.temperature() + 10.0
+    system.properties(T, state.pressure(), state.speciesAmounts())
+
+    assert phreeqc.temperature() == T
+
+
+def test_phreeqc_system_properties_in_many_threads_after_input_file_changes(shared_datadir, tmp_path):
+    """Test that the clones of a Phreeqc instance execute the input script files as they were when executed."""
+    input_file = tmp_path / 'IW.pqi'
+    input_file.write_text((shared_datadir / 'IW.pqi').read_text())
+
+    # all '\' (from Windows path format) needs to be change to '/'.
+    database_path = '/'.join([i.replace('\\', '') for i in (shared_datadir / 'phreeqc.dat').parts])
+    input_path = '/'.join([i.replace('\\', '') for i in input_file.parts])
+
+    phreeqc = Phreeqc(database_path)
+    phreeqc.execute(input_path)
+
+    system = phreeqc.system()
+    state = phreeqc.state(system)
+
+    P = state.pressure()
+    n = state.speciesAmounts()
+
+    # Overwrite the input script file before any clone of the Phreeqc instance is created
+    input_file.write_text("this is not a PHREEQC script")
+
+    nthreads = 4
+    temperatures = [state.temperature() + 10.0 * i for i in range(nthreads)]
+
+    def evaluate(T):
+        properties = system.properties(T, P, n)
+        return np.array(properties.lnActivities().val)
+
+    barrier = threading.Barrier(nthreads)
+    results = [None] * nthreads
+
+    def work(i):
+        barrier.wait()
+        for k in range(10):
+            results[i] = evaluate(temperatures[i])
+
+    threads = [threading.Thread(target=work, args=(i,)) for i in range(nthreads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for T, result in zip(temperatures, results):
+        assert np.array_equal(result, evaluate(T))
+
+
+@pytest.mark.parametrize(
+    "factor",
+    [
+        pytest.param(1.0, id="ionic strength unchanged"),
+        pytest.param(1.0005, id="ionic strength changed by less than 0.1%"),
+        pytest.param(1.1, id="ionic strength increased"),
+        pytest.param(0.5, id="ionic strength decreased"),
+    ],
+)
+def test_phreeqc_system_properties_with_cached_thermodynamic_updates(shared_datadir, factor):
+    """
+    Test the properties of a Phreeqc chemical system evaluated after others at the same
+    temperature and pressure, which reuse the last thermodynamic updates, against those
+    evaluated after others at a different temperature, which do not.
+    """
+    phreeqc = _create_phreeqc(shared_datadir)
+    system = phreeqc.system()
+    state = phreeqc.state(system)
+
+    # The ionic strength corrections of PHREEQC are pressure corrections, so use a pressure other than 1 atm
+    T = state.temperature()
+    P = 200e5
+    n = np.array(state.speciesAmounts())
+
+    # The species amounts with the ionic strength changed by adding or removing NaCl
+    n1 = n.copy()
+    n1[system.indexSpecies("Na+")] *= factor
+    n1[system.indexSpecies("Cl-")] *= factor
+
+    def evaluate(T, n):
+        properties = system.properties(T, P, n)
+        return (
+            np.array(properties.lnActivityCoefficients().val),
+            np.array(properties.lnActivities().val),
+            np.array(properties.phaseVolumes().val),
+        )
+
+    system.properties(T, P, n)
+    actual = evaluate(T, n1)
+
+    system.properties(T + 10.0, P, n1)
+    expected = evaluate(T, n1)
+
+    # Assert the cached updates give the same properties, even for changes of ionic strength
+    # below the tolerance with which PHREEQC itself would skip its ionic strength corrections
+    for a, e in zip(actual, expected):
+        assert np.array_equal(a, e)
@@ -0,0 +1,57 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import threading
+
+import numpy as np
+
+
+def test_reaction_system_rates_in_many_threads(kinetic_problem_with_h2o_nacl_co2_calcite_magnesite_dolomite):
+    """Test the rates of a ReactionSystem evaluated in many threads, each with its own copy of the reactions."""
+    (reactions, partition, state) = kinetic_problem_with_h2o_nacl_co2_calcite_magnesite_dolomite
+
+    system = reactions.system()
+    P = state.pressure()
+    n = state.speciesAmounts()
+
+    # The temperatures used by each thread, so that the threads do not share the same inputs
+    nthreads = 4
+    temperatures = [state.temperature() + 10.0 * i for i in range(nthreads)]
+
+    def evaluate(T):
+        rates = reactions.rates(system.properties(T, P, n))
+        return np.array(rates.val), np.array(rates.ddT), np.array(rates.ddn)
+
+    # Evaluate the rates of the reactions in each thread many times at the same time
+    barrier = threading.Barrier(nthreads)
+    results = [None] * nthreads
+
+    def work(i):
+        barrier.wait()
+        for k in range(10):
+            results[i] = evaluate(temperatures[i])
+
+    threads = [threading.Thread(target=work, args=(i,)) for i in range(nthreads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    # Assert the rates are the same as those evaluated serially
+    for T, result in zip(temperatures, results):
+        for actual, expected in zip(result, evaluate(T)):
+            assert np.array_equal(actual, expected)
@@ -0,0 +1,229 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright (C) 2014-2018 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+import numpy as np
+import pytest
+
+from reaktoro import (
+    AdaptiveTimeStepOptions,
+    ChemicalEditor,
+    ChemicalField,
+    ChemicalSystem,
+    EquilibriumProblem,
+    Mesh,
+    ReactiveTransportSolver,
+    SelectiveUpdateOptions,
+    equilibrate,
+)
+
+day = 24 * 3600
+
+
+def _create_chemical_system():
+    editor = ChemicalEditor()
+    editor.addAqueousPhaseWithElementsOf("H2O NaCl CaCl2 MgCl2 CO2")
+    editor.addMineralPhase("Quartz")
+    editor.addMineralPhase("Calcite")
+    editor.addMineralPhase("Dolomite")
+    return ChemicalSystem(editor)
+
+
+def _create_initial_state(system, reactive):
+    """
+    Create a brine filling 10% of the volume of a cell, with Quartz and Calcite in
+    the remaining volume if reactive
+    """
+    problem = EquilibriumProblem(system)
+    problem.setTemperature(60, "celsius")
+    problem.setPressure(100, "bar")
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 0.7, "mol")
+    if reactive:
+        problem.add("CaCO3", 10, "mol")
+        problem.add("SiO2", 10, "mol")
+
+    state = equilibrate(problem)
+    state.scalePhaseVolume("Aqueous", 0.1, "m3")
+    if reactive:
+        state.scalePhaseVolume("Quartz", 0.882, "m3")
+        state.scalePhaseVolume("Calcite", 0.018, "m3")
+
+    return state
+
+
+def _create_boundary_state(system, reactive):
+    """
+    Create the injected brine, with CO2 that dissolves Calcite and precipitates Dolomite if reactive
+    """
+    problem = EquilibriumProblem(system)
+    problem.setTemperature(60, "celsius")
+    problem.setPressure(100, "bar")
+    problem.add("H2O", 1, "kg")
+    problem.add("NaCl", 0.9, "mol")
+    problem.add("MgCl2", 0.05, "mol")
+    problem.add("CaCl2", 0.01, "mol")
+    if reactive:
+        problem.add("CO2", 0.75, "mol")
+
+    state = equilibrate(problem)
+    state.scaleVolume(0.1, "m3")
+
+    return state
+
+
+def _solve_reactive_transport_problem(system, reactive, dt, options, tfinal):
+    """
+    Inject the brine into a column of 20 cells at 1 m/day until the given final time,
+    and return the chemical field and the number of steps taken
+    """
+    num_cells = 20
+
+    field = ChemicalField(num_cells, _create_initial_state(system, reactive))
+
+    rt = ReactiveTransportSolver(system)
+    rt.setMesh(Mesh(num_cells, 0.0, 20.0))
+    rt.setVelocity(1.0 / day)
+    rt.setDiffusionCoeff(1e-9)
+    rt.setBoundaryState(_create_boundary_state(system, reactive))
+    rt.setTimeStep(dt)
+    rt.setTimeStepOptions(options)
+    rt.initialize(field)
+
+    # Shorten the last step so that all calculations end at the same time
+    num_steps = 0
+    while rt.time() < tfinal * (1 - 1e-12):
+        rt.setTimeStep(min(rt.timeStep(), tfinal - rt.time()))
+        rt.step(field)
+        num_steps += 1
+
+    assert rt.time() == pytest.approx(tfinal)
+
+    return (field, num_steps)
+
+
+def test_reactive_transport_solver_with_sub_cycled_transport_steps():
+    system = _create_chemical_system()
+
+    tfinal = 10 * day
+
+    # Solve with fixed time steps of a quarter day, a Courant number of 0.25
+    (expected, expected_steps) = _solve_reactive_transport_problem(
+        system, False, 0.25 * day, AdaptiveTimeStepOptions(), tfinal)
+
+    # Solve with fixed time steps of one day, each performing four transport steps of a quarter day
+    options = AdaptiveTimeStepOptions()
+    options.active = True
+    options.courant = 0.25
+    options.max_substeps = 4
+    options.min_factor = 1.0
+    options.max_factor = 1.0
+
+    (field, num_steps) = _solve_reactive_transport_problem(system, False, 1.0 * day, options, tfinal)
+
+    assert num_steps == expected_steps / 4
+
+    # Assert the transported amounts of elements are the same, since the brines do not react with the minerals
+    for icell in range(field.size()):
+        assert np.allclose(field[icell].elementAmounts(), expected[icell].elementAmounts(), rtol=1e-5, atol=1e-10)
+
+
+def test_reactive_transport_solver_with_adaptive_time_steps():
+    system = _create_chemical_system()
+
+    tfinal = 10 * day
+
+    # Solve with fixed time steps of a tenth of a day
+    (expected, expected_steps) = _solve_reactive_transport_problem(
+        system, True, 0.1 * day, AdaptiveTimeStepOptions(), tfinal)
+
+    # Solve with adaptive time steps starting at a tenth of a day
+    options = AdaptiveTimeStepOptions()
+    options.active = True
+    options.max_substeps = 4
+
+    (field, num_steps) = _solve_reactive_transport_problem(system, True, 0.1 * day, options, tfinal)
+
+    assert num_steps < expected_steps
+
+    # Assert the amount of dissolved minerals, which depends on the time steps, is close
+    initial_state = _create_initial_state(system, True)
+
+    def dissolved(field):
+        return sum(
+            initial_state.speciesAmount("Calcite") - field[icell].speciesAmount("Calcite") - field[icell].speciesAmount("Dolomite")
+            for icell in range(field.size())
+        )
+
+    assert dissolved(field) == pytest.approx(dissolved(expected), rel=0.1)
+
+
+def _solve_reactive_transport_problem_with_selective_updates(system, options, num_steps):
+    """
+    Inject the reactive brine into a column of 20 cells at 1 m/day with time steps of half a day,
+    and return the chemical field and the total number of cells whose equilibrium calculation was skipped
+    """
+    num_cells = 20
+
+    field = ChemicalField(num_cells, _create_initial_state(system, True))
+
+    rt = ReactiveTransportSolver(system)
+    rt.setMesh(Mesh(num_cells, 0.0, 20.0))
+    rt.setVelocity(1.0 / day)
+    rt.setDiffusionCoeff(1e-9)
+    rt.setBoundaryState(_create_boundary_state(system, True))
+    rt.setTimeStep(0.5 * day)
+    rt.setSelectiveUpdateOptions(options)
+    rt.initialize(field)
+
+    num_skipped_cells = 0
+    for i in range(num_steps):
+        rt.step(field)
+        num_skipped_cells += rt.numSkippedCells()
+
+    return (field, num_skipped_cells)
+
+
+def test_reactive_transport_solver_with_selective_updates():
+    system = _create_chemical_system()
+
+    num_steps = 20
+
+    # Solve with the equilibrium calculations of all cells in every step
+    (expected, _) = _solve_reactive_transport_problem_with_selective_updates(system, SelectiveUpdateOptions(), num_steps)
+
+    # Assert zero tolerances only skip the cells with no change, and so give the same states
+    options = SelectiveUpdateOptions()
+    options.active = True
+    options.reltol = 0.0
+    options.abstol = 0.0
+
+    (field, _) = _solve_reactive_transport_problem_with_selective_updates(system, options, num_steps)
+
+    for icell in range(field.size()):
+        assert np.allclose(field[icell].speciesAmounts(), expected[icell].speciesAmounts(), rtol=1e-12, atol=1e-16)
+
+    # Assert small tolerances skip the cells ahead of the dissolution front and give close states
+    options.reltol = 1e-6
+    options.abstol = 1e-10
+
+    (field, num_skipped_cells) = _solve_reactive_transport_problem_with_selective_updates(system, options, num_steps)
+
+    assert num_skipped_cells > 0
+
+    for icell in range(field.size()):
+        assert np.allclose(field[icell].elementAmounts(), expected[icell].elementAmounts(), rtol=1e-3, atol=1e-8)
+        assert np.allclose(field[icell].speciesAmounts(), expected[icell].speciesAmounts(), rtol=1e-3, atol=1e-8)
@@ -0,0 +1,48 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Convert a database to the binary format that Database reads without parsing.
+// Usage: database-converter <source> <target>
+// The source is a `xml` database file, the name of a built-in database (e.g., supcrt98.xml),
+// or a ThermoFun database file in `json` format.
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// C++ includes
+#include <iostream>
+
+// ThermoFun includes
+#include <ThermoFun/ThermoFun.h>
+
+int main(int argc, char** argv)
+{
+    if(argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <source> <target>" << std::endl;
+        return 1;
+    }
+
+    const std::string source = argv[1];
+    const std::string target = argv[2];
+
+    const bool thermofun = source.size() > 5 && source.substr(source.size() - 5) == ".json";
+
+    const Database database = thermofun ? Database(ThermoFun::Database(source)) : Database(source);
+
+    database.save(target);
+}
@@ -0,0 +1,58 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Print a file written by ChemicalOutput in binary format as a text table.
+// Usage: output-reader <filename> [precision]
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// C++ includes
+#include <iomanip>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    if(argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <filename> [precision]" << std::endl;
+        return 1;
+    }
+
+    const ChemicalOutputData data = readChemicalOutput(argv[1]);
+
+    const int precision = argc > 2 ? std::atoi(argv[2]) : 6;
+
+    auto spacing = [](const std::string& word)
+    {
+        return word.size() + std::max(5, 25 - static_cast<int>(word.size()));
+    };
+
+    std::cout << std::setprecision(precision);
+
+    for(const auto& heading : data.headings)
+        std::cout << std::left << std::setw(spacing(heading)) << heading;
+
+    for(Index i = 0; i < Index(data.values.rows()); ++i)
+    {
+        std::cout << '\n';
+        for(Index j = 0; j < data.headings.size(); ++j)
+            std::cout << std::left << std::setw(spacing(data.headings[j])) << data.values(i, j);
+    }
+
+    std::cout << std::endl;
+}